@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_art.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_ART_HPP
+#define ITERATOR_ART_HPP
+
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+// A position in a radix tree is a leaf, the inner node that holds it and its
+// byte there: a step looks for the next byte in that node, going up while
+// there is none, then down to the edge of that subtree.
+template < class T, class Node >
+class iterator_art : public ft::iterator<std::bidirectional_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::reference;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::iterator_category;
+  typedef Node          node_type;
+  typedef Node *        nodePointer;
+
+private:
+  nodePointer const * _root;
+  nodePointer   _node;
+  int           _byte;
+  pointer       _leaf;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_art ( )
+  : _root(nullptr) , _node(nullptr) , _byte(0) , _leaf(nullptr)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_art ( nodePointer const * root, nodePointer node, int byte, pointer leaf ) : _root(root) , _node(node) , _byte(byte) , _leaf(leaf)
+  { }
+
+  // ========>> Converter <<========
+  operator iterator_art<const T, Node>() const { return iterator_art<const T, Node>(_root, _node, _byte, _leaf); }
+
+  // ========>> Base <<========
+  nodePointer const * baseRoot() const { return (_root); }
+  nodePointer   base() const           { return (_node); }
+  int           byte() const           { return (_byte); }
+  pointer       leaf() const           { return (_leaf); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (*_leaf); }
+  pointer   operator-> () const { return (_leaf); }
+
+  // ========>> Increment Operators <<========
+  iterator_art & operator++ () {
+    nodePointer leaf;
+    if ( _leaf == nullptr ) {
+      _node = nullptr;
+      leaf = (*_root) ? Node::first(_node, _byte, *_root) : nullptr;
+    } else
+      leaf = Node::after(_node, _byte);
+    _set(leaf);
+    return (*this);
+  }
+  iterator_art operator++ ( int ) {
+    iterator_art tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  // ========>> Decrement Operators <<========
+  iterator_art & operator-- () {
+    nodePointer leaf;
+    if ( _leaf == nullptr ) {
+      _node = nullptr;
+      leaf = (*_root) ? Node::last(_node, _byte, *_root) : nullptr;
+    } else
+      leaf = Node::before(_node, _byte);
+    _set(leaf);
+    return (*this);
+  }
+  iterator_art operator-- ( int ) {
+    iterator_art tmp(*this);
+    --(*this);
+    return (tmp);
+  }
+
+private:
+  void _set ( nodePointer leaf )
+  {
+    if (leaf == nullptr) {
+      _node = nullptr;
+      _byte = 0;
+      _leaf = nullptr;
+    } else
+      _leaf = Node::template leaf<value_type>(leaf);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2, class Node > bool operator== ( const iterator_art<T1, Node> & lhs, const iterator_art<T2, Node> & rhs ) { return (lhs.leaf() == rhs.leaf()); }
+template < class T1, class T2, class Node > bool operator!= ( const iterator_art<T1, Node> & lhs, const iterator_art<T2, Node> & rhs ) { return (!(lhs == rhs)); }
+}
+
+#endif
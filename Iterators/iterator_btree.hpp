@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_btree.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_BTREE_HPP
+#define ITERATOR_BTREE_HPP
+
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+// A position in a B-tree is a node and an index among its values. Inner nodes
+// hold values too, so a step goes down to the edge of a child subtree or up
+// past the last child of a parent.
+template < class T, class Node >
+class iterator_btree : public ft::iterator<std::bidirectional_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::reference;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::iterator_category;
+  typedef Node          node_type;
+  typedef Node *        nodePointer;
+
+private:
+  nodePointer const * _root;
+  nodePointer   _p;
+  int           _index;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_btree ( )
+  : _root(nullptr) , _p(nullptr) , _index(0)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_btree ( nodePointer const * root, nodePointer p, int index ) : _root(root) , _p(p) , _index(index)
+  { }
+
+  // ========>> Converter <<========
+  operator iterator_btree<const T, Node>() const { return iterator_btree<const T, Node>(_root, _p, _index); }
+
+  // ========>> Base <<========
+  nodePointer const * baseRoot() const { return (_root); }
+  nodePointer   base() const           { return (_p); }
+  int           index() const          { return (_index); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (_p->value(_index)); }
+  pointer   operator-> () const { return (&_p->value(_index)); }
+
+  // ========>> Increment Operators <<========
+  iterator_btree & operator++ () {
+    if ( _p == nullptr ) {
+      _p = *_root;
+      while (_p && _p->_children)
+        _p = _p->_children[0];
+      _index = 0;
+      if (_p && _p->_count == 0)
+        _p = nullptr;
+    } else if ( _p->_children ) {
+      _p = _p->_children[_index + 1];
+      while (_p->_children)
+        _p = _p->_children[0];
+      _index = 0;
+    } else if ( ++_index == _p->_count ) {
+      while (_p->_parent && _p->_position == _p->_parent->_count)
+        _p = _p->_parent;
+      _index = _p->_position;
+      _p = _p->_parent;
+      if (_p == nullptr)
+        _index = 0;
+    }
+    return (*this);
+  }
+  iterator_btree operator++ ( int ) {
+    iterator_btree tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  // ========>> Decrement Operators <<========
+  iterator_btree & operator-- () {
+    if ( _p == nullptr ) {
+      _p = *_root;
+      while (_p && _p->_children)
+        _p = _p->_children[_p->_count];
+      _index = (_p) ? _p->_count - 1 : 0;
+      if (_p && _p->_count == 0)
+        _p = nullptr;
+    } else if ( _p->_children ) {
+      _p = _p->_children[_index];
+      while (_p->_children)
+        _p = _p->_children[_p->_count];
+      _index = _p->_count - 1;
+    } else if ( _index-- == 0 ) {
+      while (_p->_parent && _p->_position == 0)
+        _p = _p->_parent;
+      _index = _p->_position - 1;
+      _p = _p->_parent;
+      if (_p == nullptr)
+        _index = 0;
+    }
+    return (*this);
+  }
+  iterator_btree operator-- ( int ) {
+    iterator_btree tmp(*this);
+    --(*this);
+    return (tmp);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2, class Node > bool operator== ( const iterator_btree<T1, Node> & lhs, const iterator_btree<T2, Node> & rhs ) { return (lhs.base() == rhs.base() && lhs.index() == rhs.index()); }
+template < class T1, class T2, class Node > bool operator!= ( const iterator_btree<T1, Node> & lhs, const iterator_btree<T2, Node> & rhs ) { return (!(lhs == rhs)); }
+}
+
+#endif
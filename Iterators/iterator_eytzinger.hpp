@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_eytzinger.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_EYTZINGER_HPP
+#define ITERATOR_EYTZINGER_HPP
+
+#include "iterator_traits.hpp"
+#include <cstddef>
+
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_PREFETCH(p) __builtin_prefetch(p)
+#else
+# define FT_PREFETCH(p) ((void)0)
+#endif
+
+namespace ft
+{
+// ========>> Eytzinger Indices <<========
+// A sorted sequence stored as an implicit tree in breadth-first order: the
+// root is at 1 and the children of i are at 2i and 2i+1, so a search reads a
+// predictable sequence of slots. 0 stands for the end.
+struct eytzinger {
+  static std::size_t first ( std::size_t n )
+  {
+    if (n == 0) return (0);
+    std::size_t i = 1;
+    while (2 * i <= n) i = 2 * i;
+    return (i);
+  }
+  static std::size_t last ( std::size_t n )
+  {
+    if (n == 0) return (0);
+    std::size_t i = 1;
+    while (2 * i + 1 <= n) i = 2 * i + 1;
+    return (i);
+  }
+  static std::size_t next ( std::size_t i, std::size_t n )
+  {
+    if (2 * i + 1 <= n) {
+      i = 2 * i + 1;
+      while (2 * i <= n) i = 2 * i;
+    } else {
+      i = climb(i, 1);
+    }
+    return (i);
+  }
+  static std::size_t prev ( std::size_t i, std::size_t n )
+  {
+    if (i == 0) return (last(n));
+    if (2 * i <= n) {
+      i = 2 * i;
+      while (2 * i + 1 <= n) i = 2 * i + 1;
+    } else {
+      i = climb(i, 0);
+    }
+    return (i);
+  }
+  // Branch-free descents: each step only picks a child, and the 16
+  // descendants four levels down share one cache line for small keys, so
+  // they are fetched while the next levels are compared.
+  template < class Key, class Probe, class Compare >
+  static std::size_t lower_bound ( const Key * slots, std::size_t n, const Probe & k, Compare comp )
+  {
+    std::size_t i = 1;
+    while (i <= n) {
+      std::size_t ahead = 16 * i;
+      FT_PREFETCH(slots + ((ahead <= n) ? ahead : 0));
+      i = 2 * i + comp(slots[i], k);
+    }
+    return (climb(i, 1));
+  }
+  template < class Key, class Probe, class Compare >
+  static std::size_t upper_bound ( const Key * slots, std::size_t n, const Probe & k, Compare comp )
+  {
+    std::size_t i = 1;
+    while (i <= n) {
+      std::size_t ahead = 16 * i;
+      FT_PREFETCH(slots + ((ahead <= n) ? ahead : 0));
+      i = 2 * i + !comp(k, slots[i]);
+    }
+    return (climb(i, 1));
+  }
+  // Up past the ancestors reached from a right (1) or left (0) child, then
+  // one more step: the end of a search path gives its answer the same way.
+  static std::size_t climb ( std::size_t i, std::size_t side )
+  {
+    while (i && (i & 1) == side) i >>= 1;
+    return (i >> 1);
+  }
+};
+
+template < class T >
+class iterator_eytzinger : public ft::iterator<std::bidirectional_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::reference;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::iterator_category;
+
+private:
+  pointer     _slots;
+  std::size_t _size;
+  std::size_t _i;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_eytzinger ( ) : _slots(nullptr) , _size(0) , _i(0)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_eytzinger ( pointer slots, std::size_t size, std::size_t i ) : _slots(slots) , _size(size) , _i(i)
+  { }
+
+  // ========>> Base <<========
+  std::size_t base ( ) const { return (_i); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (_slots[_i]); }
+  pointer   operator-> () const { return (&_slots[_i]); }
+
+  // ========>> Increment Operators <<========
+  iterator_eytzinger & operator++ () { _i = eytzinger::next(_i, _size); return (*this); }
+  iterator_eytzinger operator++ ( int ) {
+    iterator_eytzinger tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  // ========>> Decrement Operators <<========
+  iterator_eytzinger & operator-- () { _i = eytzinger::prev(_i, _size); return (*this); }
+  iterator_eytzinger operator-- ( int ) {
+    iterator_eytzinger tmp(*this);
+    --(*this);
+    return (tmp);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2 > bool operator== ( const iterator_eytzinger<T1> & lhs, const iterator_eytzinger<T2> & rhs ) { return (lhs.base() == rhs.base()); }
+template < class T1, class T2 > bool operator!= ( const iterator_eytzinger<T1> & lhs, const iterator_eytzinger<T2> & rhs ) { return (lhs.base() != rhs.base()); }
+}
+
+#endif
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_hash.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_HASH_HPP
+#define ITERATOR_HASH_HPP
+
+#include "iterator_traits.hpp"
+#include "../utilities/hash_group.hpp"
+
+namespace ft
+{
+// Walks the slots of an open-addressing table in memory order, skipping a
+// group of empty or deleted slots at a time; it stops at the sentinel that
+// follows the last slot.
+template < class T >
+class iterator_hash : public ft::iterator<std::forward_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::forward_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::forward_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::forward_iterator_tag, T>::reference;
+  using typename ft::iterator<std::forward_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::forward_iterator_tag, T>::iterator_category;
+
+private:
+  const hash_ctrl * _ctrl;
+  T               * _slot;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_hash ( ) : _ctrl(nullptr) , _slot(nullptr)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_hash ( const hash_ctrl * ctrl, T * slot ) : _ctrl(ctrl) , _slot(slot)
+  { _skip(); }
+
+  // ========>> Converter <<========
+  operator iterator_hash<const T>() const { return iterator_hash<const T>(_ctrl, _slot); }
+
+  // ========>> Base <<========
+  const hash_ctrl * ctrl ( ) const { return (_ctrl); }
+  T *               base ( ) const { return (_slot); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (*_slot); }
+  pointer   operator-> () const { return (_slot); }
+
+  // ========>> Increment Operators <<========
+  iterator_hash & operator++ () {
+    ++_ctrl;
+    ++_slot;
+    _skip();
+    return (*this);
+  }
+  iterator_hash operator++ ( int ) {
+    iterator_hash tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+private:
+  void _skip ( void )
+  {
+    while (_ctrl && *_ctrl < hash_ctrl_sentinel) {
+      int n = __builtin_ctz(~hash_group(_ctrl).match_empty_or_deleted());
+      _ctrl += n;
+      _slot += n;
+    }
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2 > bool operator== ( const iterator_hash<T1> & lhs, const iterator_hash<T2> & rhs ) { return (lhs.ctrl() == rhs.ctrl()); }
+template < class T1, class T2 > bool operator!= ( const iterator_hash<T1> & lhs, const iterator_hash<T2> & rhs ) { return (lhs.ctrl() != rhs.ctrl()); }
+}
+
+#endif
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_persistent.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_PERSISTENT_HPP
+#define ITERATOR_PERSISTENT_HPP
+
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+// Nodes of a persistent tree are shared between versions and have no parent,
+// so a step asks the tree for the neighbour of the current key: O(log n).
+template < class T, class Tree >
+class iterator_persistent : public ft::iterator<std::bidirectional_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::reference;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::bidirectional_iterator_tag, T>::iterator_category;
+  typedef typename Tree::Node   node_type;
+  typedef node_type *           nodePointer;
+
+private:
+  const Tree  * _tree;
+  nodePointer _p;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_persistent ( ) : _tree(nullptr) , _p(nullptr)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_persistent ( const Tree * tree, nodePointer p ) : _tree(tree) , _p(p)
+  { }
+
+  // ========>> Base <<========
+  nodePointer base ( ) const { return (_p); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (*_p->_value); }
+  pointer   operator-> () const { return (_p->_value); }
+
+  // ========>> Increment Operators <<========
+  iterator_persistent & operator++ () { _p = (_p) ? _tree->next(_p) : _tree->smallest(); return (*this); }
+  iterator_persistent operator++ ( int ) {
+    iterator_persistent tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  // ========>> Decrement Operators <<========
+  iterator_persistent & operator-- () { _p = (_p) ? _tree->prev(_p) : _tree->largest(); return (*this); }
+  iterator_persistent operator-- ( int ) {
+    iterator_persistent tmp(*this);
+    --(*this);
+    return (tmp);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2, class Tree > bool operator== ( const iterator_persistent<T1, Tree> & lhs, const iterator_persistent<T2, Tree> & rhs ) { return (lhs.base() == rhs.base()); }
+template < class T1, class T2, class Tree > bool operator!= ( const iterator_persistent<T1, Tree> & lhs, const iterator_persistent<T2, Tree> & rhs ) { return (lhs.base() != rhs.base()); }
+}
+
+#endif
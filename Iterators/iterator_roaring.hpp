@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_roaring.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_ROARING_HPP
+#define ITERATOR_ROARING_HPP
+
+#include "iterator_traits.hpp"
+#include <stdint.h>
+
+namespace ft
+{
+// Walks the chunks of a roaring_set in order, and the values of each chunk
+// from their position (see roaring_chunk). The values are not stored as
+// such, so they are read by value.
+template < class Chunk >
+class iterator_roaring : public ft::iterator<std::forward_iterator_tag, uint32_t, uint32_t, const uint32_t *, uint32_t> {
+public:
+  typedef uint32_t                        value_type;
+  typedef const uint32_t *                pointer;
+  typedef uint32_t                        reference;
+  typedef ptrdiff_t                       difference_type;
+  typedef std::forward_iterator_tag       iterator_category;
+
+private:
+  const Chunk   * _chunks;
+  size_t        _count;
+  size_t        _index;
+  uint32_t      _at;
+  uint32_t      _off;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_roaring ( ) : _chunks(nullptr) , _count(0) , _index(0) , _at(0) , _off(0)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_roaring ( const Chunk * chunks, size_t count, size_t index, uint32_t at, uint32_t off )
+  : _chunks(chunks) , _count(count) , _index(index) , _at(at) , _off(off)
+  { }
+
+  // ========>> Base <<========
+  size_t   index ( ) const { return (_index); }
+  uint32_t at ( ) const    { return (_at); }
+  uint32_t off ( ) const   { return (_off); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const
+  { return ((uint32_t(_chunks[_index].key) << 16) | _chunks[_index].value(_at, _off)); }
+
+  // ========>> Increment Operators <<========
+  iterator_roaring & operator++ () {
+    if (!_chunks[_index].next(_at, _off)) {
+      if (++_index < _count)
+        _chunks[_index].first(_at, _off);
+      else
+        _at = _off = 0;
+    }
+    return (*this);
+  }
+  iterator_roaring operator++ ( int ) {
+    iterator_roaring tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class Chunk > bool operator== ( const iterator_roaring<Chunk> & lhs, const iterator_roaring<Chunk> & rhs )
+{ return (lhs.index() == rhs.index() && lhs.at() == rhs.at() && lhs.off() == rhs.off()); }
+template < class Chunk > bool operator!= ( const iterator_roaring<Chunk> & lhs, const iterator_roaring<Chunk> & rhs ) { return (!(lhs == rhs)); }
+}
+
+#endif
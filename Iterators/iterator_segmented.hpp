@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_segmented.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_SEGMENTED_HPP
+#define ITERATOR_SEGMENTED_HPP
+
+#include "iterator_traits.hpp"
+#include <cstddef>
+
+namespace ft
+{
+// An index into the chunk table of a segmented_vector: element i lives in
+// chunk i / ChunkSize. The table moves when it grows, which invalidates the
+// iterators but never the elements.
+template < class T, std::size_t ChunkSize >
+class iterator_segmented : public ft::iterator<std::random_access_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::random_access_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::random_access_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::random_access_iterator_tag, T>::reference;
+  using typename ft::iterator<std::random_access_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::random_access_iterator_tag, T>::iterator_category;
+
+private:
+  pointer const * _chunks;
+  difference_type _i;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_segmented ( ) : _chunks(nullptr) , _i(0)
+  { }
+
+  // ========>> Custom Constructor <<========
+  iterator_segmented ( pointer const * chunks, difference_type i ) : _chunks(chunks) , _i(i)
+  { }
+
+  // ========>> Convertion <<========
+  operator iterator_segmented<const T, ChunkSize>() const { return iterator_segmented<const T, ChunkSize>(_chunks, _i); }
+
+  // ========>> Base <<========
+  difference_type base ( ) const { return (_i); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (_chunks[_i / ChunkSize][_i % ChunkSize]); }
+  pointer   operator-> () const { return (&**this); }
+
+  // ========>> Increment Operators <<========
+  iterator_segmented & operator++ () { ++_i; return (*this); }
+  iterator_segmented operator++ ( int ) {
+    iterator_segmented tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  // ========>> Decrement Operators <<========
+  iterator_segmented & operator-- () { --_i; return (*this); }
+  iterator_segmented operator-- ( int ) {
+    iterator_segmented tmp(*this);
+    --(*this);
+    return (tmp);
+  }
+
+  // ========>> Arithmetic Operators <<========
+  iterator_segmented operator- ( const difference_type & n ) const { return (iterator_segmented(_chunks, _i - n)); }
+  iterator_segmented operator+ ( const difference_type & n ) const { return (iterator_segmented(_chunks, _i + n)); }
+  friend iterator_segmented operator+ ( typename iterator_segmented::difference_type n, const iterator_segmented & it )
+  { return (it + n); }
+  iterator_segmented & operator-= ( const difference_type & n ) { _i -= n; return (*this); }
+  iterator_segmented & operator+= ( const difference_type & n ) { _i += n; return (*this); }
+
+  // ========>> Offset dereference operator <<========
+  reference operator[] ( const difference_type & n ) const { return (*(*this + n)); }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2, std::size_t C > typename iterator_segmented<T1, C>::difference_type operator- ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() - rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator== ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() == rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator!= ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() != rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator<  ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() <  rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator>  ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() >  rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator<= ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() <= rhs.base()); }
+template < class T1, class T2, std::size_t C > bool operator>= ( const iterator_segmented<T1, C> & lhs, const iterator_segmented<T2, C> & rhs ) { return (lhs.base() >= rhs.base()); }
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_skiplist.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ITERATOR_SKIPLIST_HPP
+#define ITERATOR_SKIPLIST_HPP
+
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+// Walks the bottom level of a lock-free skiplist, stepping over the nodes
+// being erased. It keeps its own epoch pin, so the node it stands on is not
+// reclaimed under it, and drops the pin at the end. Weakly consistent: it
+// sees every element present for the whole walk, and may or may not see the
+// ones inserted or erased meanwhile.
+template < class T, class Node, class Domain >
+class iterator_skiplist : public ft::iterator<std::forward_iterator_tag, T> {
+public:
+  using typename ft::iterator<std::forward_iterator_tag, T>::value_type;
+  using typename ft::iterator<std::forward_iterator_tag, T>::pointer;
+  using typename ft::iterator<std::forward_iterator_tag, T>::reference;
+  using typename ft::iterator<std::forward_iterator_tag, T>::difference_type;
+  using typename ft::iterator<std::forward_iterator_tag, T>::iterator_category;
+  typedef Node *                    nodePointer;
+  typedef typename Domain::record * recordPointer;
+
+private:
+  Domain        * _domain;
+  recordPointer _record;
+  nodePointer   _p;
+
+public:
+  // ========>> Default Constructor <<========
+  iterator_skiplist ( ) : _domain(nullptr) , _record(nullptr) , _p(nullptr)
+  { }
+
+  // ========>> Custom Constructor <<========
+  // Takes a pin of its own on record, which must already be pinned.
+  iterator_skiplist ( Domain * domain, recordPointer record, nodePointer p ) : _domain(domain) , _record(p ? record : nullptr) , _p(p)
+  { if (_record) _domain->retain(_record); }
+
+  // ========>> Copy Constructor <<========
+  iterator_skiplist ( const iterator_skiplist & x ) : _domain(x._domain) , _record(x._record) , _p(x._p)
+  { if (_record) _domain->retain(_record); }
+  template < class U >
+  iterator_skiplist ( const iterator_skiplist<U, Node, Domain> & x ) : _domain(x.domain()) , _record(x.record()) , _p(x.base())
+  { if (_record) _domain->retain(_record); }
+
+  // ========>> Destructor <<========
+  ~iterator_skiplist ( ) { if (_record) _domain->release(_record); }
+
+  // ========>> Copy Assignment Operator <<========
+  iterator_skiplist & operator= ( const iterator_skiplist & x ) {
+    if (x._record) x._domain->retain(x._record);
+    if (_record) _domain->release(_record);
+    _domain = x._domain;
+    _record = x._record;
+    _p = x._p;
+    return (*this);
+  }
+
+  // ========>> Base <<========
+  nodePointer   base ( ) const   { return (_p); }
+  Domain        * domain ( ) const { return (_domain); }
+  recordPointer record ( ) const { return (_record); }
+
+  // ========>> Dereferencing <<========
+  reference operator* () const  { return (*_p->_value); }
+  pointer   operator-> () const { return (_p->_value); }
+
+  // ========>> Increment Operators <<========
+  iterator_skiplist & operator++ () {
+    _p = _p->next(0);
+    while (_p && _p->isErased())
+      _p = _p->next(0);
+    if (!_p && _record) {
+      _domain->release(_record);
+      _record = nullptr;
+    }
+    return (*this);
+  }
+  iterator_skiplist operator++ ( int ) {
+    iterator_skiplist tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+};
+
+// ========>> Relational Operators <<========
+template < class T1, class T2, class Node, class Domain > bool operator== ( const iterator_skiplist<T1, Node, Domain> & lhs, const iterator_skiplist<T2, Node, Domain> & rhs ) { return (lhs.base() == rhs.base()); }
+template < class T1, class T2, class Node, class Domain > bool operator!= ( const iterator_skiplist<T1, Node, Domain> & lhs, const iterator_skiplist<T2, Node, Domain> & rhs ) { return (lhs.base() != rhs.base()); }
+}
+
+#endif
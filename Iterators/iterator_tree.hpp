@@ -17,6 +17,47 @@
 
 namespace ft
 {
+// ========>> Stepping <<========
+// Climbs parent pointers, or follows the in-order links of a threaded tree.
+template < bool Threads >
+struct tree_step {
+  template < class Node >
+  static Node * next ( Node * p )
+  {
+    if ( p->_right ) {
+      p = p->_right;
+      while (p->_left)
+        p = p->_left;
+    } else {
+      while (p && p->_isRight)
+        p = p->_parent;
+      if (p) p = p->_parent;
+    }
+    return (p);
+  }
+  template < class Node >
+  static Node * prev ( Node * p )
+  {
+    if ( p->_left ) {
+      p = p->_left;
+      while (p->_right)
+        p = p->_right;
+    } else {
+      while (p && !p->_isRight)
+        p = p->_parent;
+      if (p) p = p->_parent;
+    }
+    return (p);
+  }
+};
+template < >
+struct tree_step< true > {
+  template < class Node >
+  static Node * next ( Node * p ) { return (p->_next); }
+  template < class Node >
+  static Node * prev ( Node * p ) { return (p->_prev); }
+};
+
 template < class T, class Node>
 class iterator_tree : public ft::iterator<std::bidirectional_iterator_tag, T> {
 public:
@@ -25,6 +66,7 @@ public:
   using typename ft::iterator<std::bidirectional_iterator_tag, T>::reference;
   using typename ft::iterator<std::bidirectional_iterator_tag, T>::difference_type;
   using typename ft::iterator<std::bidirectional_iterator_tag, T>::iterator_category;
+  typedef Node          node_type;
   typedef Node *        nodePointer;
 
 private:
@@ -73,14 +115,8 @@ public:
       _p = *_root;
       while (_p && _p->_left)
         _p = _p->_left;
-    } else if ( _p->_right ) {
-      _p = _p->_right;
-      while (_p->_left)
-        _p = _p->_left;
     } else {
-      while (_p && _p->_isRight)
-        _p = _p->_parent;
-      if (_p) _p = _p->_parent;
+      _p = tree_step<Node::policy_type::threads>::next(_p);
     }
     return (*this);
   }
@@ -96,14 +132,8 @@ public:
       _p = *_root;
       while (_p && _p->_right)
         _p = _p->_right;
-    } else if ( _p->_left ) {
-      _p = _p->_left;
-      while (_p->_right)
-        _p = _p->_right;
     } else {
-      while (_p && !_p->_isRight)
-        _p = _p->_parent;
-      if (_p) _p = _p->_parent;
+      _p = tree_step<Node::policy_type::threads>::prev(_p);
     }
     return (*this);
   }
@@ -117,6 +147,37 @@ public:
 // ========>> Relational Operators <<========
 template < class Itr1, class Node1, class Itr2, class Node2 > bool operator== ( const iterator_tree<Itr1, Node1> & lhs, const iterator_tree<Itr2, Node2> & rhs ) { return (lhs.base() == rhs.base()); }
 template < class Itr1, class Node1, class Itr2, class Node2 > bool operator!= ( const iterator_tree<Itr1, Node1> & lhs, const iterator_tree<Itr2, Node2> & rhs ) { return (lhs.base() != rhs.base()); }
+
+// ========>> Distance <<========
+// Linear walk, or two O(log n) climbs when the nodes count their subtrees.
+template < bool Counts >
+struct tree_distance {
+  template < class Iterator >
+  static typename Iterator::difference_type get ( Iterator first, Iterator last )
+  {
+    typename Iterator::difference_type result = 0;
+    while (first != last) { ++first; ++result; }
+    return (result);
+  }
+};
+template < >
+struct tree_distance< true > {
+  template < class Iterator >
+  static typename Iterator::difference_type get ( Iterator first, Iterator last )
+  {
+    typedef typename Iterator::difference_type          difference_type;
+    typedef typename Iterator::nodePointer              nodePointer;
+    typedef typename Iterator::node_type::policy_type   policy_type;
+
+    nodePointer root = *first.baseRoot();
+    return (difference_type(policy_type::position(last.base(), root))
+      - difference_type(policy_type::position(first.base(), root)));
+  }
+};
+
+template < class T, class Node >
+typename iterator_tree<T, Node>::difference_type distance ( iterator_tree<T, Node> first, iterator_tree<T, Node> last )
+{ return (tree_distance<Node::policy_type::counts>::get(first, last)); }
 }
 
 #endif
@@ -0,0 +1,288 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   art_map.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ART_MAP_HPP
+#define ART_MAP_HPP
+
+#include "Iterators/iterator_art.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "art_tree.hpp"
+#include <stdexcept>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// ft::map on an adaptive radix tree: the keys are ordered by their encoding
+// (see art_key.hpp: integers by value, strings as std::less<std::string>), and
+// a lookup walks one small node per key byte instead of comparing keys.
+// Encoder replaces Compare; keys also need operator==.
+// Unlike ft::map, insert and erase invalidate every iterator, as nodes are
+// replaced when they grow or shrink; references to the values stay valid.
+template
+<
+class Key,
+class T,
+class Encoder = ft::art_key<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class art_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Encoder                                       key_encoder;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+
+  static const key_type & key_of ( const value_type & val ) { return (val.first); }
+private:
+  typedef ft::ArtTree<art_map>                          tree_type;
+  typedef typename tree_type::Node                      Node;
+  typedef typename tree_type::Position                  Position;
+public:
+  typedef ft::iterator_art<value_type, Node>            iterator;
+  typedef ft::iterator_art<const value_type, Node>      const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+private:
+  allocator_type  _alloc;
+  tree_type       _tree;
+
+public:
+  // [*] // explicit art_map ( const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > art_map ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type() );
+  // [*] // art_map ( const art_map& x );
+  // [*] // art_map& operator=( const art_map& other );
+  // [*] // ~art_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit art_map ( const allocator_type& alloc = allocator_type() )
+    : _alloc ( alloc )
+    , _tree ( _alloc )
+  { }
+  template < class InputIterator >
+  art_map ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _alloc ( alloc )
+    , _tree ( _alloc )
+  {
+    insert(first, last);
+  }
+  art_map ( const art_map& x )
+    : _alloc ( x._alloc )
+    , _tree ( x._tree, _alloc )
+  { }
+  art_map& operator=( const art_map& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~art_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // mapped_type& at (const key_type& k);
+  // [*] // const mapped_type& at (const key_type& k) const;
+  // [*] // mapped_type& operator[] (const key_type& k);
+  mapped_type& at (const key_type& k)
+  {
+    Position pos = _tree.find(k);
+    if ( pos.leaf )
+      return (pos.leaf->second);
+    else
+      throw (std::out_of_range("art_map::at : key not found"));
+  }
+  const mapped_type& at (const key_type& k) const
+  {
+    Position pos = _tree.find(k);
+    if ( pos.leaf )
+      return (pos.leaf->second);
+    else
+      throw (std::out_of_range("art_map::at : key not found"));
+  }
+  mapped_type& operator[] (const key_type& k)
+  {
+    Position pos = _tree.find(k);
+    if ( pos.leaf )
+      return (pos.leaf->second);
+    return (_tree.insert(ft::make_pair<key_type, mapped_type>(k, mapped_type())).first.leaf->second);
+  }
+
+  // [*] // iterator begin ( );
+  // [*] // const_iterator begin ( ) const;
+  // [*] // iterator end ( );
+  // [*] // const_iterator end ( ) const;
+  //
+  // [*] // reverse_iterator rbegin ( );
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // reverse_iterator rend ( );
+  // [*] // const_reverse_iterator rend ( ) const;
+  iterator       begin ( )       { return (_iterator(_tree.smallest())); }
+  const_iterator begin ( ) const { return (_iterator(_tree.smallest())); }
+  iterator       end ( )         { return (_iterator(Position())); }
+  const_iterator end ( ) const   { return (_iterator(Position())); }
+
+  reverse_iterator       rbegin ( )       { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  reverse_iterator       rend ( )         { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    ft::pair<Position, bool> result = _tree.insert(val);
+    return (ft::make_pair<iterator,bool>(_iterator(result.first), result.second));
+  }
+  iterator insert ( iterator position, const value_type& val ) // The hint is not needed: the path is the key.
+  {
+    (void)position;
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      _tree.insert(*(first++));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  { return (_tree.erase(k)); }
+  void erase ( iterator position )
+  { _tree.erase(Position(position.base(), position.byte(), position.leaf())); }
+  void erase ( iterator first, iterator last ) // Erasing replaces nodes, so each step searches again.
+  {
+    if (first == last) return ;
+    size_type n = 0;
+    for (iterator it = first; it != last; ++it)
+      ++n;
+    key_type k = first->first;
+    while (n--)
+      _tree.erase(_tree.lower_bound(k));
+  }
+
+  // [*] // void swap ( art_map& x );
+  void swap ( art_map& x )
+  { _tree.swap(x._tree); }
+
+  // [*] // void clear ( );
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  iterator find (const key_type& k)
+  { return (_iterator(_tree.find(k))); }
+  const_iterator find (const key_type& k) const
+  { return (_iterator(_tree.find(k))); }
+  size_type count( const key_type& k ) const
+  { return ((_tree.find(k).leaf) ? 1 : 0); }
+
+  // [*] // iterator lower_bound (const key_type& k);
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // iterator upper_bound (const key_type& k);
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  iterator lower_bound (const key_type& k)
+  { return (_iterator(_tree.lower_bound(k))); }
+  const_iterator lower_bound (const key_type& k) const
+  { return (_iterator(_tree.lower_bound(k))); }
+  iterator upper_bound (const key_type& k)
+  { return (_iterator(_tree.upper_bound(k))); }
+  const_iterator upper_bound (const key_type& k) const
+  { return (_iterator(_tree.upper_bound(k))); }
+
+  // [*] // pair<iterator,iterator>             equal_range (const key_type& k);
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  pair<iterator,iterator> equal_range (const key_type& k)
+  { return (ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
+  pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  { return (ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+  // [*] // pair<iterator,iterator>             prefix_range (const key_type& prefix);
+  // [*] // pair<const_iterator,const_iterator> prefix_range (const key_type& prefix) const;
+  // The keys that start with prefix, for keys that have prefixes (strings).
+  pair<iterator,iterator> prefix_range (const key_type& prefix)
+  {
+    ft::pair<Position, Position> range = _tree.prefix_range(prefix);
+    return (ft::make_pair<iterator, iterator>(_iterator(range.first), _iterator(range.second)));
+  }
+  pair<const_iterator,const_iterator> prefix_range (const key_type& prefix) const
+  {
+    ft::pair<Position, Position> range = _tree.prefix_range(prefix);
+    return (ft::make_pair<const_iterator, const_iterator>(_iterator(range.first), _iterator(range.second)));
+  }
+
+private:
+  iterator _iterator ( Position pos ) const
+  { return (iterator(_tree.base(), pos.node, pos.byte, pos.leaf)); }
+};
+
+template< class Key, class T, class Encoder, class Alloc >
+void swap (art_map<Key,T,Encoder,Alloc>& x, art_map<Key,T,Encoder,Alloc>& y)
+{
+  x.swap(y);
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator==( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator!=( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator<( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator>( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator<=( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class Key, class T, class Encoder, class Alloc >
+bool operator>=( const ft::art_map<Key,T,Encoder,Alloc>& lhs, const ft::art_map<Key,T,Encoder,Alloc>& rhs )
+{
+  return (!(lhs < rhs));
+}
+}
+
+#endif
@@ -0,0 +1,1039 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   art_tree.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ART_TREE_HPP
+#define ART_TREE_HPP
+
+#include "utils.hpp"
+#include "utilities/art_key.hpp"
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+// An inner node of an adaptive radix tree. It branches on one byte of the
+// encoded key, after skipping the _prefixLen bytes that all the keys below it
+// share. Only the first max_prefix bytes of that prefix are stored; the rest
+// are read back from a leaf when needed.
+// A child is either an inner node or a leaf: a pointer to the value, tagged
+// with its lowest bit.
+struct art_node {
+  enum { node4, node16, node48, node256 };
+  static const unsigned max_prefix = 8;
+
+  art_node        * _parent;
+  unsigned        _prefixLen;
+  unsigned char   _type;
+  unsigned char   _byte;     // Under which _parent holds this node.
+  unsigned short  _count;
+  unsigned char   _prefix[max_prefix];
+
+  static bool is_leaf ( const art_node * child ) { return (reinterpret_cast<uintptr_t>(child) & 1); }
+  template < class V >
+  static V * leaf ( const art_node * child ) { return (reinterpret_cast<V *>(reinterpret_cast<uintptr_t>(child) - 1)); }
+  template < class V >
+  static art_node * tag ( V * val ) { return (reinterpret_cast<art_node *>(reinterpret_cast<uintptr_t>(val) + 1)); }
+
+  static art_node ** find_child ( art_node * node, unsigned char b );
+  static art_node * next_child ( const art_node * node, int b, int & found ); // The first child after byte b.
+  static art_node * prev_child ( const art_node * node, int b, int & found ); // The last child before byte b.
+
+  // The leaves next to a position, given as the node holding it and its byte:
+  // nullptr past the edges, else the tagged leaf, with node and b moved to it.
+  static art_node * first ( art_node *& node, int & b, art_node * child );
+  static art_node * last ( art_node *& node, int & b, art_node * child );
+  static art_node * after ( art_node *& node, int & b );
+  static art_node * before ( art_node *& node, int & b );
+};
+
+// Up to 4 and 16 children, their bytes sorted.
+struct art_node4 : public art_node {
+  unsigned char _keys[4];
+  art_node      * _children[4];
+};
+struct art_node16 : public art_node {
+  unsigned char _keys[16];
+  art_node      * _children[16];
+};
+// Up to 48 children, _index[b] is the slot of byte b plus one, 0 for none.
+struct art_node48 : public art_node {
+  unsigned char _index[256];
+  art_node      * _children[48];
+};
+struct art_node256 : public art_node {
+  art_node      * _children[256];
+};
+
+inline art_node ** art_node::find_child ( art_node * node, unsigned char b )
+{
+  switch (node->_type) {
+  case node4: {
+    art_node4 * n = static_cast<art_node4 *>(node);
+    for (int i = 0; i < n->_count; ++i)
+      if (n->_keys[i] == b)
+        return (&n->_children[i]);
+    return (nullptr);
+  }
+  case node16: {
+    art_node16 * n = static_cast<art_node16 *>(node);
+#if defined(__SSE2__)
+    __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->_keys));
+    unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(b)), keys));
+    mask &= (1u << n->_count) - 1;
+    return ((mask) ? &n->_children[__builtin_ctz(mask)] : nullptr);
+#else
+    for (int i = 0; i < n->_count; ++i)
+      if (n->_keys[i] == b)
+        return (&n->_children[i]);
+    return (nullptr);
+#endif
+  }
+  case node48: {
+    art_node48 * n = static_cast<art_node48 *>(node);
+    return ((n->_index[b]) ? &n->_children[n->_index[b] - 1] : nullptr);
+  }
+  default: {
+    art_node256 * n = static_cast<art_node256 *>(node);
+    return ((n->_children[b]) ? &n->_children[b] : nullptr);
+  }
+  }
+}
+
+inline art_node * art_node::next_child ( const art_node * node, int b, int & found )
+{
+  switch (node->_type) {
+  case node4:
+  case node16: {
+    const unsigned char * keys = (node->_type == node4) ? static_cast<const art_node4 *>(node)->_keys
+                                                        : static_cast<const art_node16 *>(node)->_keys;
+    art_node * const * children = (node->_type == node4) ? static_cast<const art_node4 *>(node)->_children
+                                                         : static_cast<const art_node16 *>(node)->_children;
+    for (int i = 0; i < node->_count; ++i)
+      if (keys[i] > b) {
+        found = keys[i];
+        return (children[i]);
+      }
+    return (nullptr);
+  }
+  case node48: {
+    const art_node48 * n = static_cast<const art_node48 *>(node);
+    for (int i = b + 1; i < 256; ++i)
+      if (n->_index[i]) {
+        found = i;
+        return (n->_children[n->_index[i] - 1]);
+      }
+    return (nullptr);
+  }
+  default: {
+    const art_node256 * n = static_cast<const art_node256 *>(node);
+    for (int i = b + 1; i < 256; ++i)
+      if (n->_children[i]) {
+        found = i;
+        return (n->_children[i]);
+      }
+    return (nullptr);
+  }
+  }
+}
+
+inline art_node * art_node::prev_child ( const art_node * node, int b, int & found )
+{
+  switch (node->_type) {
+  case node4:
+  case node16: {
+    const unsigned char * keys = (node->_type == node4) ? static_cast<const art_node4 *>(node)->_keys
+                                                        : static_cast<const art_node16 *>(node)->_keys;
+    art_node * const * children = (node->_type == node4) ? static_cast<const art_node4 *>(node)->_children
+                                                         : static_cast<const art_node16 *>(node)->_children;
+    for (int i = node->_count; i-- > 0; )
+      if (keys[i] < b) {
+        found = keys[i];
+        return (children[i]);
+      }
+    return (nullptr);
+  }
+  case node48: {
+    const art_node48 * n = static_cast<const art_node48 *>(node);
+    for (int i = b - 1; i >= 0; --i)
+      if (n->_index[i]) {
+        found = i;
+        return (n->_children[n->_index[i] - 1]);
+      }
+    return (nullptr);
+  }
+  default: {
+    const art_node256 * n = static_cast<const art_node256 *>(node);
+    for (int i = b - 1; i >= 0; --i)
+      if (n->_children[i]) {
+        found = i;
+        return (n->_children[i]);
+      }
+    return (nullptr);
+  }
+  }
+}
+
+inline art_node * art_node::first ( art_node *& node, int & b, art_node * child )
+{
+  while (!is_leaf(child)) {
+    node = child;
+    child = next_child(node, -1, b);
+  }
+  return (child);
+}
+
+inline art_node * art_node::last ( art_node *& node, int & b, art_node * child )
+{
+  while (!is_leaf(child)) {
+    node = child;
+    child = prev_child(node, 256, b);
+  }
+  return (child);
+}
+
+inline art_node * art_node::after ( art_node *& node, int & b )
+{
+  while (node) {
+    int found;
+    art_node * child = next_child(node, b, found);
+    if (child)
+      return (b = found, first(node, b, child));
+    b = node->_byte;
+    node = node->_parent;
+  }
+  return (nullptr);
+}
+
+inline art_node * art_node::before ( art_node *& node, int & b )
+{
+  while (node) {
+    int found;
+    art_node * child = prev_child(node, b, found);
+    if (child)
+      return (b = found, last(node, b, child));
+    b = node->_byte;
+    node = node->_parent;
+  }
+  return (nullptr);
+}
+
+// An adaptive radix tree: keys are encoded into bytes (see art_key.hpp) and
+// each inner node branches on one byte, growing from 4 to 16, 48 and 256
+// children as needed, so a lookup costs one small node per distinct key byte
+// and never compares whole keys except at the leaf. Paths without branches
+// are collapsed into the prefix of the next node.
+// Values are allocated one by one and never move, but nodes are replaced as
+// they grow and shrink.
+// The container provides key_of(value) and key_encoder.
+template < typename Container >
+class ArtTree {
+  // ---------------- Typedefs ----------------
+public:
+  typedef art_node                                 Node;
+
+  typedef typename Container::key_type             key_type;
+  typedef typename Container::value_type           value_type;
+  typedef typename Container::key_encoder          key_encoder;
+  typedef art_key_bytes<key_encoder>               key_bytes;
+
+  typedef typename Container::allocator_type                       allocator_type;
+  typedef typename allocator_type::template rebind<art_node4>::other   allocator_node4_type;
+  typedef typename allocator_type::template rebind<art_node16>::other  allocator_node16_type;
+  typedef typename allocator_type::template rebind<art_node48>::other  allocator_node48_type;
+  typedef typename allocator_type::template rebind<art_node256>::other allocator_node256_type;
+
+  typedef typename allocator_type::size_type       size_type;
+
+  // A leaf, the inner node that holds it (nullptr for a leaf root) and its
+  // byte there. leaf is nullptr for the end.
+  struct Position {
+    Node        * node;
+    int         byte;
+    value_type  * leaf;
+
+    Position ( Node * n = nullptr, int b = 0, value_type * l = nullptr ) : node(n), byte(b), leaf(l) { }
+  };
+
+  // ---------------- Attributes ----------------
+private:
+  allocator_type          & _alloc;
+  allocator_node4_type    _alloc_node4;
+  allocator_node16_type   _alloc_node16;
+  allocator_node48_type   _alloc_node48;
+  allocator_node256_type  _alloc_node256;
+  Node                    *_root;
+  size_type               _size;
+
+  // ---------------- Constructor ----------------
+public:
+  explicit ArtTree ( allocator_type & alloc )
+    : _alloc(alloc)
+    , _alloc_node4(alloc)
+    , _alloc_node16(alloc)
+    , _alloc_node48(alloc)
+    , _alloc_node256(alloc)
+    , _root(nullptr)
+    , _size(0)
+  { }
+
+  // ---------------- Copy Constructor ----------------
+public:
+  ArtTree ( const ArtTree & copy, allocator_type & alloc )
+    : _alloc(alloc)
+    , _alloc_node4(copy._alloc_node4)
+    , _alloc_node16(copy._alloc_node16)
+    , _alloc_node48(copy._alloc_node48)
+    , _alloc_node256(copy._alloc_node256)
+    , _root((copy._root) ? _clone(copy._root, nullptr) : nullptr)
+    , _size(copy._size)
+  { }
+
+  // ---------------- Copy Assignment Operator ----------------
+public:
+  ArtTree &operator=( const ArtTree & copy )
+  {
+    Node * root = (copy._root) ? _clone(copy._root, nullptr) : nullptr;
+    _destroy(_root);
+    _root = root;
+    _size = copy._size;
+    return (*this);
+  }
+
+  // ---------------- Destructor ----------------
+public:
+  ~ArtTree () { _destroy(_root); }
+
+  // ---------------- Accessors ----------------
+public:
+  Node *const * base ( void ) const { return (&_root); }
+  size_type size ( void ) const { return (_size); }
+  Position smallest ( void ) const
+  {
+    if (_root == nullptr)
+      return (Position());
+    Node * node = nullptr;
+    int b = 0;
+    Node * leaf = Node::first(node, b, _root);
+    return (Position(node, b, Node::leaf<value_type>(leaf)));
+  }
+
+  // ---------------- Clear / Swap ----------------
+public:
+  void clear ( void )
+  {
+    _destroy(_root);
+    _root = nullptr;
+    _size = 0;
+  }
+  void swap ( ArtTree & x )
+  {
+    Node * root_tmp = _root;
+    size_type size_tmp = _size;
+    _root = x._root;
+    _size = x._size;
+    x._root = root_tmp;
+    x._size = size_tmp;
+  }
+
+  // ---------------- Search ----------------
+public:
+  // The prefixes longer than max_prefix are skipped unchecked on the way
+  // down: the leaf comparison catches a key that differs there.
+  Position find ( const key_type & k ) const
+  {
+    key_bytes key(k);
+    Node * node = _root, * parent = nullptr;
+    size_t depth = 0;
+    int b = 0;
+    while (node && !Node::is_leaf(node)) {
+      if (node->_prefixLen) {
+        size_t n = _min(_min(node->_prefixLen, Node::max_prefix), key.size() - depth);
+        if (std::memcmp(node->_prefix, key.data() + depth, n) != 0)
+          return (Position());
+        depth += node->_prefixLen;
+      }
+      if (depth >= key.size())
+        return (Position());
+      Node ** child = Node::find_child(node, key[depth]);
+      if (child == nullptr)
+        return (Position());
+      parent = node;
+      b = key[depth++];
+      node = *child;
+    }
+    if (node == nullptr || !(Container::key_of(*Node::leaf<value_type>(node)) == k))
+      return (Position());
+    return (Position(parent, b, Node::leaf<value_type>(node)));
+  }
+  Position lower_bound ( const key_type & k ) const // The first value not less than k.
+  {
+    key_bytes key(k);
+    return (_lowerBound(key.data(), key.size()));
+  }
+  Position upper_bound ( const key_type & k ) const // The first value greater than k.
+  {
+    key_bytes key(k);
+    Position pos = _lowerBound(key.data(), key.size());
+    if (pos.leaf && Container::key_of(*pos.leaf) == k)
+      pos = _after(pos);
+    return (pos);
+  }
+  // The values whose key starts with prefix, for encoders with encode_prefix.
+  ft::pair<Position, Position> prefix_range ( const key_type & prefix ) const
+  {
+    key_bytes key(prefix, true);
+    Position first = _lowerBound(key.data(), key.size());
+    size_t n = key.size();
+    while (n > 0 && key[n - 1] == 0xFF)
+      --n;
+    if (n == 0)
+      return (ft::make_pair(first, Position()));
+    // The smallest bytes past all of those that start with the prefix.
+    unsigned char * next = new unsigned char[n];
+    std::memcpy(next, key.data(), n);
+    ++next[n - 1];
+    Position last;
+    try {
+      last = _lowerBound(next, n);
+    } catch (...) {
+      delete[] next;
+      throw ;
+    }
+    delete[] next;
+    return (ft::make_pair(first, last));
+  }
+
+  // ---------------- Insertion ----------------
+public:
+  ft::pair<Position, bool> insert ( const value_type & val )
+  {
+    key_bytes key(Container::key_of(val));
+    Node ** ref = &_root;
+    Node * parent = nullptr;
+    size_t depth = 0;
+    while (*ref && !Node::is_leaf(*ref)) {
+      Node * node = *ref;
+      if (node->_prefixLen) {
+        size_t p = _mismatch(node, key.data(), key.size(), depth);
+        if (p < node->_prefixLen)
+          return (ft::make_pair(_splitPrefix(ref, p, depth, key, val), true));
+        depth += node->_prefixLen;
+      }
+      if (depth >= key.size())
+        _badEncoding();
+      Node ** child = Node::find_child(node, key[depth]);
+      if (child == nullptr) {
+        value_type * leaf = _newLeaf(val);
+        _addChild(ref, key[depth], Node::tag(leaf), leaf);
+        return (ft::make_pair(Position(*ref, key[depth], leaf), true));
+      }
+      parent = node;
+      ref = child;
+      ++depth;
+    }
+    if (*ref == nullptr) {
+      value_type * leaf = _newLeaf(val);
+      _root = Node::tag(leaf);
+      ++_size;
+      return (ft::make_pair(Position(nullptr, 0, leaf), true));
+    }
+    value_type * old = Node::leaf<value_type>(*ref);
+    int b = (parent) ? key[depth - 1] : 0;
+    if (Container::key_of(*old) == Container::key_of(val))
+      return (ft::make_pair(Position(parent, b, old), false));
+    return (ft::make_pair(_splitLeaf(ref, parent, b, depth, key, val), true));
+  }
+
+  // ---------------- Deletion ----------------
+public:
+  size_type erase ( const key_type & k )
+  {
+    Position pos = find(k);
+    if (pos.leaf == nullptr)
+      return (0);
+    erase(pos);
+    return (1);
+  }
+  void erase ( Position pos )
+  {
+    _alloc.destroy(pos.leaf);
+    _alloc.deallocate(pos.leaf, 1);
+    --_size;
+    if (pos.node == nullptr)
+      _root = nullptr;
+    else
+      _removeChild(_refOf(pos.node), static_cast<unsigned char>(pos.byte));
+  }
+
+  // ---------------- Key Bytes ----------------
+private:
+  static size_t _min ( size_t a, size_t b ) { return ((a < b) ? a : b); }
+  static void _badEncoding ( void )
+  { throw (std::invalid_argument("art_map : a key encoding is a prefix of another")); }
+  static const unsigned char * _anyKey ( Node * node, key_bytes *& bytes ) // Of a leaf below node.
+  {
+    int b = 0;
+    Node * leaf = Node::first(node, b, node);
+    bytes = new key_bytes(Container::key_of(*Node::leaf<value_type>(leaf)));
+    return (bytes->data());
+  }
+  // How many bytes of the prefix of node match the key from depth on.
+  static size_t _mismatch ( Node * node, const unsigned char * key, size_t size, size_t depth )
+  {
+    size_t n = _min(node->_prefixLen, size - depth);
+    size_t i = 0;
+    for (; i < n && i < Node::max_prefix; ++i)
+      if (node->_prefix[i] != key[depth + i])
+        return (i);
+    if (i < n) {
+      key_bytes * bytes;
+      const unsigned char * full = _anyKey(node, bytes);
+      for (; i < n && full[depth + i] == key[depth + i]; ++i) ;
+      delete bytes;
+    }
+    return (i);
+  }
+  // The sign of the prefix of node against the key from depth on: 0 when it
+  // matches, 1 when the key ends before it (it is a prefix of the subtree).
+  static int _comparePrefix ( Node * node, const unsigned char * key, size_t size, size_t depth )
+  {
+    size_t p = _mismatch(node, key, size, depth);
+    if (p == node->_prefixLen)
+      return (0);
+    if (depth + p == size)
+      return (1);
+    unsigned char c;
+    if (p < Node::max_prefix)
+      c = node->_prefix[p];
+    else {
+      key_bytes * bytes;
+      c = _anyKey(node, bytes)[depth + p];
+      delete bytes;
+    }
+    return ((c < key[depth + p]) ? -1 : 1);
+  }
+  static void _setPrefix ( Node * node, const unsigned char * prefix, size_t size )
+  {
+    node->_prefixLen = static_cast<unsigned>(size);
+    std::memmove(node->_prefix, prefix, _min(size, Node::max_prefix));
+  }
+
+  // ---------------- Lower Bound ----------------
+  // Works on any bytes, not only encoded keys, for prefix_range.
+private:
+  Position _lowerBound ( const unsigned char * key, size_t size ) const
+  {
+    Node * node = _root, * parent = nullptr;
+    size_t depth = 0;
+    int b = 0;
+    if (node == nullptr)
+      return (Position());
+    while (!Node::is_leaf(node)) {
+      if (node->_prefixLen) {
+        int c = _comparePrefix(node, key, size, depth);
+        if (c < 0)
+          return (_after(Position(parent, b)));
+        if (c > 0)
+          return (_first(parent, b, node));
+        depth += node->_prefixLen;
+      }
+      if (depth >= size)
+        return (_first(parent, b, node));
+      Node ** child = Node::find_child(node, key[depth]);
+      if (child == nullptr) {
+        int found;
+        Node * next = Node::next_child(node, key[depth], found);
+        if (next)
+          return (_first(node, found, next));
+        return (_after(Position(parent, b)));
+      }
+      parent = node;
+      b = key[depth++];
+      node = *child;
+    }
+    value_type * leaf = Node::leaf<value_type>(node);
+    key_bytes bytes(Container::key_of(*leaf));
+    size_t n = _min(bytes.size(), size);
+    int c = std::memcmp(bytes.data(), key, n);
+    if (c > 0 || (c == 0 && bytes.size() >= size))
+      return (Position(parent, b, leaf));
+    return (_after(Position(parent, b)));
+  }
+  static Position _after ( Position pos )
+  {
+    Node * leaf = Node::after(pos.node, pos.byte);
+    return ((leaf) ? Position(pos.node, pos.byte, Node::leaf<value_type>(leaf)) : Position());
+  }
+  static Position _first ( Node * node, int b, Node * child )
+  {
+    Node * leaf = Node::first(node, b, child);
+    return (Position(node, b, Node::leaf<value_type>(leaf)));
+  }
+
+  // ---------------- Insertion Helpers ----------------
+private:
+  value_type * _newLeaf ( const value_type & val )
+  {
+    value_type * leaf = _alloc.allocate(1);
+    try {
+      _alloc.construct(leaf, val);
+    } catch (...) {
+      _alloc.deallocate(leaf, 1);
+      throw ;
+    }
+    return (leaf);
+  }
+  void _freeLeaf ( value_type * leaf )
+  {
+    _alloc.destroy(leaf);
+    _alloc.deallocate(leaf, 1);
+  }
+  // The key ends at an existing leaf: a node4 of the bytes the two keys
+  // share from depth on branches to both.
+  Position _splitLeaf ( Node ** ref, Node * parent, int b, size_t depth, const key_bytes & key, const value_type & val )
+  {
+    key_bytes other(Container::key_of(*Node::leaf<value_type>(*ref)));
+    size_t i = depth;
+    while (i < key.size() && i < other.size() && key[i] == other[i])
+      ++i;
+    if (i == key.size() || i == other.size())
+      _badEncoding();
+    value_type * leaf = _newLeaf(val);
+    art_node4 * node;
+    try {
+      node = _newNode4();
+    } catch (...) {
+      _freeLeaf(leaf);
+      throw ;
+    }
+    node->_parent = parent;
+    node->_byte = static_cast<unsigned char>(b);
+    _setPrefix(node, key.data() + depth, i - depth);
+    _add4(node, other[i], *ref);
+    _add4(node, key[i], Node::tag(leaf));
+    *ref = node;
+    ++_size;
+    return (Position(node, key[i], leaf));
+  }
+  // The key leaves the prefix of *ref after p bytes: a node4 takes these
+  // p bytes and branches to *ref, which keeps the rest, and to the new leaf.
+  Position _splitPrefix ( Node ** ref, size_t p, size_t depth, const key_bytes & key, const value_type & val )
+  {
+    Node * old = *ref;
+    if (depth + p >= key.size())
+      _badEncoding();
+    value_type * leaf = _newLeaf(val);
+    art_node4 * node;
+    try {
+      node = _newNode4();
+    } catch (...) {
+      _freeLeaf(leaf);
+      throw ;
+    }
+    key_bytes * bytes = nullptr;
+    const unsigned char * prefix = old->_prefix;
+    if (old->_prefixLen > Node::max_prefix) {
+      try {
+        prefix = _anyKey(old, bytes) + depth;
+      } catch (...) {
+        _freeLeaf(leaf);
+        _alloc_node4.deallocate(node, 1);
+        throw ;
+      }
+    }
+    node->_parent = old->_parent;
+    node->_byte = old->_byte;
+    _setPrefix(node, prefix, p);
+    unsigned char b = prefix[p];
+    _setPrefix(old, prefix + p + 1, old->_prefixLen - p - 1);
+    delete bytes;
+    _add4(node, b, old);
+    _add4(node, key[depth + p], Node::tag(leaf));
+    *ref = node;
+    ++_size;
+    return (Position(node, key[depth + p], leaf));
+  }
+  void _add4 ( art_node4 * node, unsigned char b, Node * child ) // Has room.
+  {
+    int i = node->_count;
+    for (; i > 0 && node->_keys[i - 1] > b; --i) {
+      node->_keys[i] = node->_keys[i - 1];
+      node->_children[i] = node->_children[i - 1];
+    }
+    node->_keys[i] = b;
+    node->_children[i] = child;
+    ++node->_count;
+    _adopt(node, b, child);
+  }
+  void _add16 ( art_node16 * node, unsigned char b, Node * child )
+  {
+    int i = node->_count;
+    for (; i > 0 && node->_keys[i - 1] > b; --i) {
+      node->_keys[i] = node->_keys[i - 1];
+      node->_children[i] = node->_children[i - 1];
+    }
+    node->_keys[i] = b;
+    node->_children[i] = child;
+    ++node->_count;
+    _adopt(node, b, child);
+  }
+  void _add48 ( art_node48 * node, unsigned char b, Node * child )
+  {
+    int slot = 0;
+    while (node->_children[slot])
+      ++slot;
+    node->_children[slot] = child;
+    node->_index[b] = static_cast<unsigned char>(slot + 1);
+    ++node->_count;
+    _adopt(node, b, child);
+  }
+  void _add256 ( art_node256 * node, unsigned char b, Node * child )
+  {
+    node->_children[b] = child;
+    ++node->_count;
+    _adopt(node, b, child);
+  }
+  // Puts a new leaf in *ref, growing it first when it is full.
+  void _addChild ( Node ** ref, unsigned char b, Node * child, value_type * leaf )
+  {
+    Node * node = *ref;
+    try {
+      switch (node->_type) {
+      case Node::node4:
+        if (node->_count == 4)
+          node = _grow4(static_cast<art_node4 *>(node));
+        break ;
+      case Node::node16:
+        if (node->_count == 16)
+          node = _grow16(static_cast<art_node16 *>(node));
+        break ;
+      case Node::node48:
+        if (node->_count == 48)
+          node = _grow48(static_cast<art_node48 *>(node));
+        break ;
+      }
+    } catch (...) {
+      _freeLeaf(leaf);
+      throw ;
+    }
+    if (node != *ref) {
+      _freeNode(*ref);
+      *ref = node;
+    }
+    switch (node->_type) {
+    case Node::node4:  _add4(static_cast<art_node4 *>(node), b, child); break ;
+    case Node::node16: _add16(static_cast<art_node16 *>(node), b, child); break ;
+    case Node::node48: _add48(static_cast<art_node48 *>(node), b, child); break ;
+    default:           _add256(static_cast<art_node256 *>(node), b, child); break ;
+    }
+    ++_size;
+  }
+
+  // ---------------- Deletion Helpers ----------------
+private:
+  Node ** _refOf ( Node * node )
+  {
+    if (node->_parent == nullptr)
+      return (&_root);
+    return (Node::find_child(node->_parent, node->_byte));
+  }
+  // A node shrinks a while after it falls under the size of the smaller
+  // kind, so that a key going in and out does not resize it every time. A
+  // node4 left with one child merges into it.
+  void _removeChild ( Node ** ref, unsigned char b )
+  {
+    Node * node = *ref;
+    switch (node->_type) {
+    case Node::node4:
+    case Node::node16: {
+      unsigned char * keys = (node->_type == Node::node4) ? static_cast<art_node4 *>(node)->_keys
+                                                          : static_cast<art_node16 *>(node)->_keys;
+      Node ** children = (node->_type == Node::node4) ? static_cast<art_node4 *>(node)->_children
+                                                      : static_cast<art_node16 *>(node)->_children;
+      int i = 0;
+      while (keys[i] != b)
+        ++i;
+      for (--node->_count; i < node->_count; ++i) {
+        keys[i] = keys[i + 1];
+        children[i] = children[i + 1];
+      }
+      if (node->_type == Node::node4 && node->_count == 1)
+        _collapse(ref);
+      else if (node->_type == Node::node16 && node->_count == 3)
+        _replace(ref, &ArtTree::_shrink16);
+      break ;
+    }
+    case Node::node48: {
+      art_node48 * n = static_cast<art_node48 *>(node);
+      n->_children[n->_index[b] - 1] = nullptr;
+      n->_index[b] = 0;
+      if (--n->_count == 12)
+        _replace(ref, &ArtTree::_shrink48);
+      break ;
+    }
+    default: {
+      art_node256 * n = static_cast<art_node256 *>(node);
+      n->_children[b] = nullptr;
+      if (--n->_count == 37)
+        _replace(ref, &ArtTree::_shrink256);
+      break ;
+    }
+    }
+  }
+  void _collapse ( Node ** ref )
+  {
+    art_node4 * node = static_cast<art_node4 *>(*ref);
+    Node * child = node->_children[0];
+    if (!Node::is_leaf(child)) {
+      unsigned char prefix[Node::max_prefix];
+      size_t n = _min(node->_prefixLen, Node::max_prefix);
+      std::memcpy(prefix, node->_prefix, n);
+      if (n < Node::max_prefix)
+        prefix[n++] = node->_keys[0];
+      std::memcpy(prefix + n, child->_prefix, _min(child->_prefixLen, Node::max_prefix - n));
+      child->_prefixLen += node->_prefixLen + 1;
+      std::memcpy(child->_prefix, prefix, Node::max_prefix);
+      child->_parent = node->_parent;
+      child->_byte = node->_byte;
+    }
+    *ref = child;
+    _alloc_node4.deallocate(node, 1);
+  }
+  // Shrinking needs a new node: when it cannot be had, the bigger one stays.
+  void _replace ( Node ** ref, Node * (ArtTree::*shrink)( Node * ) )
+  {
+    Node * node;
+    try {
+      node = (this->*shrink)(*ref);
+    } catch (...) {
+      return ;
+    }
+    _freeNode(*ref);
+    *ref = node;
+  }
+
+  // ---------------- Resize ----------------
+  // The new node takes the place of the old one, which the caller frees.
+private:
+  void _adopt ( Node * node, unsigned char b, Node * child )
+  {
+    if (!Node::is_leaf(child)) {
+      child->_parent = node;
+      child->_byte = b;
+    }
+  }
+  static void _copyHeader ( Node * to, const Node * from )
+  {
+    to->_parent = from->_parent;
+    to->_prefixLen = from->_prefixLen;
+    to->_byte = from->_byte;
+    to->_count = from->_count;
+    std::memcpy(to->_prefix, from->_prefix, Node::max_prefix);
+  }
+  Node * _grow4 ( art_node4 * old )
+  {
+    art_node16 * node = _newNode16();
+    _copyHeader(node, old);
+    for (int i = 0; i < old->_count; ++i) {
+      node->_keys[i] = old->_keys[i];
+      node->_children[i] = old->_children[i];
+      _adopt(node, old->_keys[i], old->_children[i]);
+    }
+    return (node);
+  }
+  Node * _grow16 ( art_node16 * old )
+  {
+    art_node48 * node = _newNode48();
+    _copyHeader(node, old);
+    for (int i = 0; i < old->_count; ++i) {
+      node->_index[old->_keys[i]] = static_cast<unsigned char>(i + 1);
+      node->_children[i] = old->_children[i];
+      _adopt(node, old->_keys[i], old->_children[i]);
+    }
+    return (node);
+  }
+  Node * _grow48 ( art_node48 * old )
+  {
+    art_node256 * node = _newNode256();
+    _copyHeader(node, old);
+    for (int b = 0; b < 256; ++b)
+      if (old->_index[b]) {
+        node->_children[b] = old->_children[old->_index[b] - 1];
+        _adopt(node, static_cast<unsigned char>(b), node->_children[b]);
+      }
+    return (node);
+  }
+  Node * _shrink16 ( Node * from )
+  {
+    art_node16 * old = static_cast<art_node16 *>(from);
+    art_node4 * node = _newNode4();
+    _copyHeader(node, old);
+    for (int i = 0; i < old->_count; ++i) {
+      node->_keys[i] = old->_keys[i];
+      node->_children[i] = old->_children[i];
+      _adopt(node, old->_keys[i], old->_children[i]);
+    }
+    return (node);
+  }
+  Node * _shrink48 ( Node * from )
+  {
+    art_node48 * old = static_cast<art_node48 *>(from);
+    art_node16 * node = _newNode16();
+    _copyHeader(node, old);
+    int i = 0;
+    for (int b = 0; b < 256; ++b)
+      if (old->_index[b]) {
+        node->_keys[i] = static_cast<unsigned char>(b);
+        node->_children[i] = old->_children[old->_index[b] - 1];
+        _adopt(node, node->_keys[i], node->_children[i]);
+        ++i;
+      }
+    return (node);
+  }
+  Node * _shrink256 ( Node * from )
+  {
+    art_node256 * old = static_cast<art_node256 *>(from);
+    art_node48 * node = _newNode48();
+    _copyHeader(node, old);
+    int slot = 0;
+    for (int b = 0; b < 256; ++b)
+      if (old->_children[b]) {
+        node->_index[b] = static_cast<unsigned char>(slot + 1);
+        node->_children[slot] = old->_children[b];
+        _adopt(node, static_cast<unsigned char>(b), node->_children[slot]);
+        ++slot;
+      }
+    return (node);
+  }
+
+  // ---------------- Nodes ----------------
+private:
+  static void _initNode ( Node * node, int type )
+  {
+    node->_parent = nullptr;
+    node->_prefixLen = 0;
+    node->_type = static_cast<unsigned char>(type);
+    node->_byte = 0;
+    node->_count = 0;
+  }
+  art_node4 * _newNode4 ( void )
+  {
+    art_node4 * node = _alloc_node4.allocate(1);
+    _initNode(node, Node::node4);
+    return (node);
+  }
+  art_node16 * _newNode16 ( void )
+  {
+    art_node16 * node = _alloc_node16.allocate(1);
+    _initNode(node, Node::node16);
+    return (node);
+  }
+  art_node48 * _newNode48 ( void )
+  {
+    art_node48 * node = _alloc_node48.allocate(1);
+    _initNode(node, Node::node48);
+    std::memset(node->_index, 0, sizeof(node->_index));
+    std::memset(node->_children, 0, sizeof(node->_children));
+    return (node);
+  }
+  art_node256 * _newNode256 ( void )
+  {
+    art_node256 * node = _alloc_node256.allocate(1);
+    _initNode(node, Node::node256);
+    std::memset(node->_children, 0, sizeof(node->_children));
+    return (node);
+  }
+  void _freeNode ( Node * node )
+  {
+    switch (node->_type) {
+    case Node::node4:  _alloc_node4.deallocate(static_cast<art_node4 *>(node), 1); break ;
+    case Node::node16: _alloc_node16.deallocate(static_cast<art_node16 *>(node), 1); break ;
+    case Node::node48: _alloc_node48.deallocate(static_cast<art_node48 *>(node), 1); break ;
+    default:           _alloc_node256.deallocate(static_cast<art_node256 *>(node), 1); break ;
+    }
+  }
+  void _destroy ( Node * node ) // Also frees a partial clone: its missing children are nullptr.
+  {
+    if (node == nullptr) return ;
+    if (Node::is_leaf(node))
+      return (_freeLeaf(Node::leaf<value_type>(node)));
+    int b = -1;
+    for (Node * child = Node::next_child(node, b, b); child; child = Node::next_child(node, b, b))
+      _destroy(child);
+    _freeNode(node);
+  }
+  Node * _clone ( const Node * src, Node * parent )
+  {
+    if (Node::is_leaf(src))
+      return (Node::tag(_newLeaf(*Node::leaf<value_type>(src))));
+    Node * node;
+    switch (src->_type) {
+    case Node::node4:  node = _newNode4(); break ;
+    case Node::node16: node = _newNode16(); break ;
+    case Node::node48: node = _newNode48(); break ;
+    default:           node = _newNode256(); break ;
+    }
+    _copyHeader(node, src);
+    node->_parent = parent;
+    try {
+      switch (src->_type) {
+      case Node::node4:
+      case Node::node16: {
+        const unsigned char * keys = (src->_type == Node::node4) ? static_cast<const art_node4 *>(src)->_keys
+                                                                 : static_cast<const art_node16 *>(src)->_keys;
+        art_node * const * from = (src->_type == Node::node4) ? static_cast<const art_node4 *>(src)->_children
+                                                              : static_cast<const art_node16 *>(src)->_children;
+        unsigned char * to_keys = (src->_type == Node::node4) ? static_cast<art_node4 *>(node)->_keys
+                                                              : static_cast<art_node16 *>(node)->_keys;
+        Node ** to = (src->_type == Node::node4) ? static_cast<art_node4 *>(node)->_children
+                                                 : static_cast<art_node16 *>(node)->_children;
+        node->_count = 0;
+        for (int i = 0; i < src->_count; ++i) {
+          to_keys[i] = keys[i];
+          to[i] = _clone(from[i], node);
+          ++node->_count;
+        }
+        break ;
+      }
+      case Node::node48: {
+        const art_node48 * s = static_cast<const art_node48 *>(src);
+        art_node48 * n = static_cast<art_node48 *>(node);
+        for (int b = 0; b < 256; ++b)
+          if (s->_index[b]) {
+            n->_children[s->_index[b] - 1] = _clone(s->_children[s->_index[b] - 1], node);
+            n->_index[b] = s->_index[b];
+          }
+        break ;
+      }
+      default: {
+        const art_node256 * s = static_cast<const art_node256 *>(src);
+        art_node256 * n = static_cast<art_node256 *>(node);
+        for (int b = 0; b < 256; ++b)
+          if (s->_children[b])
+            n->_children[b] = _clone(s->_children[b], node);
+        break ;
+      }
+      }
+    } catch (...) {
+      _destroy(node);
+      throw ;
+    }
+    return (node);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,517 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_HPP
+#define BTREE_HPP
+
+#include "utils.hpp"
+#include "utilities/aligned_storage.hpp"
+#include "utilities/node_search.hpp"
+#include <cstring>
+
+namespace ft
+{
+// The copies of the keys that a SIMD node search reads, kept next to the
+// values when the value is not the key itself (a map). Empty otherwise.
+template < class Key, int N, bool Stored >
+struct btree_keys {
+  void set ( int, const Key & ) { }
+  const Key * data ( void ) const { return (nullptr); }
+};
+template < class Key, int N >
+struct btree_keys< Key, N, true > {
+  Key _keys[N];
+
+  void set ( int i, const Key & k ) { _keys[i] = k; }
+  const Key * data ( void ) const { return (_keys); }
+};
+
+// A B-tree whose nodes hold their values inline, sized to about 256 bytes
+// (4 cache lines): a search touches one node per level instead of one per
+// key, and there is no per-element allocation.
+// Values live in inner nodes too, and move by copy between slots when nodes
+// split, merge or shift; a copy constructor that throws halfway through such
+// a move leaves the tree unusable.
+// The container provides key_of(value) and value_is_key.
+template < typename Container >
+class BTree {
+  // ---------------- Typedefs ----------------
+public:
+  struct Node;
+  struct Inner;
+
+  typedef typename Container::key_type             key_type;
+  typedef typename Container::mapped_type          mapped_type;
+  typedef typename Container::value_type           value_type;
+
+  typedef typename Container::key_compare                        key_compare;
+  typedef typename Container::allocator_type                     allocator_type;
+  typedef typename allocator_type::template rebind<Node>::other  allocator_node_type;
+  typedef typename allocator_type::template rebind<Inner>::other allocator_inner_type;
+  typedef ft::node_search<key_type, key_compare>                 search_type;
+
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::pair<Node *, int>                         Position; // nullptr for the end.
+
+  static const bool _keyArray = search_type::simd && !Container::value_is_key;
+  static const int  _slot = sizeof(value_type) + (_keyArray ? sizeof(key_type) : 0);
+  static const int  _fit = (256 - 3 * sizeof(void *)) / _slot;
+  static const int  capacity = (_fit < 4) ? 4 : ((_fit > 32) ? 32 : _fit);
+  static const int  _minCount = (capacity - 1) / 2;
+
+  struct Node {
+    Node            * _parent;
+    Node            ** _children; // Into Inner::_slots, nullptr in a leaf.
+    unsigned short  _position;    // Among the children of _parent.
+    unsigned short  _count;
+    btree_keys< key_type, capacity, _keyArray > _keys;
+    ft::aligned_storage<value_type, capacity> _storage;
+
+    value_type       & value ( int i )       { return (_storage.data()[i]); }
+    const value_type & value ( int i ) const { return (_storage.data()[i]); }
+  };
+  struct Inner : public Node {
+    Node  * _slots[capacity + 1];
+  };
+
+  // ---------------- Attributes ----------------
+private:
+  key_compare           _comp;
+  allocator_type        & _alloc;
+  allocator_node_type   _alloc_node;
+  allocator_inner_type  _alloc_inner;
+  Node                  *_root;
+  size_type             _size;
+
+  // ---------------- Constructor ----------------
+public:
+  explicit BTree
+  ( key_compare comp, allocator_type & alloc )
+    : _comp(comp)
+    , _alloc(alloc)
+    , _alloc_node(alloc)
+    , _alloc_inner(alloc)
+    , _root(nullptr)
+    , _size(0)
+  { }
+
+  // ---------------- Copy Constructor ----------------
+public:
+  BTree ( const BTree & copy, allocator_type & alloc )
+    : _comp(copy._comp)
+    , _alloc(alloc)
+    , _alloc_node(copy._alloc_node)
+    , _alloc_inner(copy._alloc_inner)
+    , _root((copy._root) ? _clone(copy._root, nullptr, 0) : nullptr)
+    , _size(copy._size)
+  { }
+
+  // ---------------- Copy Assignment Operator ----------------
+public:
+  BTree &operator=( const BTree & copy )
+  {
+    Node * root = (copy._root) ? _clone(copy._root, nullptr, 0) : nullptr;
+    _destroy(_root);
+    _root = root;
+    _size = copy._size;
+    return (*this);
+  }
+
+  // ---------------- Destructor ----------------
+public:
+  ~BTree () { _destroy(_root); }
+
+  // ---------------- Accessors ----------------
+public:
+  Node *const * base ( void ) const { return (&_root); }
+  size_type size ( void ) const { return (_size); }
+  Position smallest ( void ) const
+  {
+    Node * node = _root;
+    if (node == nullptr || node->_count == 0)
+      return (Position(nullptr, 0));
+    while (node->_children)
+      node = node->_children[0];
+    return (Position(node, 0));
+  }
+
+  // ---------------- Clear / Swap ----------------
+public:
+  void clear ( void )
+  {
+    _destroy(_root);
+    _root = nullptr;
+    _size = 0;
+  }
+  void swap ( BTree & x )
+  {
+    Node * root_tmp = _root;
+    size_type size_tmp = _size;
+    _root = x._root;
+    _size = x._size;
+    x._root = root_tmp;
+    x._size = size_tmp;
+  }
+
+  // ---------------- Search ----------------
+public:
+  Position find ( const key_type & k ) const
+  {
+    Node * node = _root;
+    while (node) {
+      int i = _lower(node, k);
+      if (i < node->_count && !_comp(k, Container::key_of(node->value(i))))
+        return (Position(node, i));
+      node = (node->_children) ? node->_children[i] : nullptr;
+    }
+    return (Position(nullptr, 0));
+  }
+  Position lower_bound ( const key_type & k ) const // The first value not less than k.
+  {
+    Position result(nullptr, 0);
+    Node * node = _root;
+    while (node) {
+      int i = _lower(node, k);
+      if (i < node->_count) {
+        result = Position(node, i);
+        if (!_comp(k, Container::key_of(node->value(i))))
+          break ;
+      }
+      node = (node->_children) ? node->_children[i] : nullptr;
+    }
+    return (result);
+  }
+  Position upper_bound ( const key_type & k ) const // The first value greater than k.
+  {
+    Position result(nullptr, 0);
+    Node * node = _root;
+    while (node) {
+      int i = _upper(node, k);
+      if (i < node->_count)
+        result = Position(node, i);
+      node = (node->_children) ? node->_children[i] : nullptr;
+    }
+    return (result);
+  }
+
+  // ---------------- Insertion ----------------
+public:
+  ft::pair<Position, bool> insert ( const value_type & val )
+  {
+    const key_type & k = Container::key_of(val);
+    Node * node = _root;
+    int i = 0;
+    while (node) {
+      i = _lower(node, k);
+      if (i < node->_count && !_comp(k, Container::key_of(node->value(i))))
+        return (ft::make_pair(Position(node, i), false));
+      if (node->_children == nullptr)
+        break ;
+      node = node->_children[i];
+    }
+    return (ft::make_pair(_insertLeaf(node, i, val), true));
+  }
+  // Puts val right before the value at (node, i), or after the last one
+  // when node is nullptr. The caller checked that this keeps the order.
+  Position insert_before ( Node * node, int i, const value_type & val )
+  {
+    if (node == nullptr) {
+      node = _root;
+      while (node && node->_children)
+        node = node->_children[node->_count];
+      i = (node) ? node->_count : 0;
+    } else if (node->_children) {
+      node = node->_children[i];
+      while (node->_children)
+        node = node->_children[node->_count];
+      i = node->_count;
+    }
+    return (_insertLeaf(node, i, val));
+  }
+
+  // ---------------- Deletion ----------------
+public:
+  size_type erase ( const key_type & k )
+  {
+    Position pos = find(k);
+    if (pos.first == nullptr)
+      return (0);
+    erase(pos.first, pos.second);
+    return (1);
+  }
+  // An inner value is replaced by its predecessor, which always sits at the
+  // end of a leaf, so only leaves lose a slot; the ancestors then borrow
+  // from a sibling or merge with it while they are under-full.
+  void erase ( Node * node, int i )
+  {
+    _alloc.destroy(&node->value(i));
+    if (node->_children) {
+      Node * leaf = node->_children[i];
+      while (leaf->_children)
+        leaf = leaf->_children[leaf->_count];
+      _move(node, i, leaf, leaf->_count - 1);
+      node = leaf;
+    } else {
+      for (int j = i + 1; j < node->_count; ++j)
+        _move(node, j - 1, node, j);
+    }
+    --node->_count;
+    --_size;
+    _rebalance(node);
+  }
+
+  // ---------------- Node Search ----------------
+private:
+  const key_type * _keysOf ( const Node * node ) const
+  {
+    if (_keyArray)
+      return (node->_keys.data());
+    return (reinterpret_cast<const key_type *>(node->_storage.data()));
+  }
+  int _lower ( const Node * node, const key_type & k ) const // Values less than k.
+  {
+    if (search_type::simd)
+      return (search_type::lower(_keysOf(node), node->_count, k, _comp));
+    int lo = 0, hi = node->_count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (_comp(Container::key_of(node->value(mid)), k)) lo = mid + 1;
+      else hi = mid;
+    }
+    return (lo);
+  }
+  int _upper ( const Node * node, const key_type & k ) const // Values not greater than k.
+  {
+    if (search_type::simd)
+      return (search_type::upper(_keysOf(node), node->_count, k, _comp));
+    int lo = 0, hi = node->_count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (!_comp(k, Container::key_of(node->value(mid)))) lo = mid + 1;
+      else hi = mid;
+    }
+    return (lo);
+  }
+
+  // ---------------- Slots ----------------
+private:
+  void _move ( Node * to, int i, Node * from, int j ) // Into a free slot, leaving a free slot.
+  {
+    _alloc.construct(&to->value(i), from->value(j));
+    _alloc.destroy(&from->value(j));
+    to->_keys.set(i, Container::key_of(to->value(i)));
+  }
+  void _adopt ( Node * parent, int i, Node * child )
+  {
+    parent->_children[i] = child;
+    child->_parent = parent;
+    child->_position = static_cast<unsigned short>(i);
+  }
+  Node * _newNode ( bool inner )
+  {
+    Node * node;
+    if (inner) {
+      Inner * block = _alloc_inner.allocate(1);
+      std::memset(block->_slots, 0, sizeof(block->_slots));
+      block->_children = block->_slots;
+      node = block;
+    } else {
+      node = _alloc_node.allocate(1);
+      node->_children = nullptr;
+    }
+    node->_parent = nullptr;
+    node->_position = 0;
+    node->_count = 0;
+    return (node);
+  }
+  void _freeNode ( Node * node )
+  {
+    if (node->_children)
+      _alloc_inner.deallocate(static_cast<Inner *>(node), 1);
+    else
+      _alloc_node.deallocate(node, 1);
+  }
+  void _destroy ( Node * node ) // Also frees a partial clone: its missing children are nullptr.
+  {
+    if (node == nullptr) return ;
+    for (int i = 0; i < node->_count; ++i)
+      _alloc.destroy(&node->value(i));
+    if (node->_children)
+      for (int i = 0; i <= node->_count; ++i)
+        _destroy(node->_children[i]);
+    _freeNode(node);
+  }
+  Node * _clone ( const Node * src, Node * parent, int position )
+  {
+    Node * node = _newNode(src->_children != nullptr);
+    node->_parent = parent;
+    node->_position = static_cast<unsigned short>(position);
+    try {
+      for (; node->_count < src->_count; ++node->_count) {
+        _alloc.construct(&node->value(node->_count), src->value(node->_count));
+        node->_keys.set(node->_count, Container::key_of(src->value(node->_count)));
+      }
+      if (src->_children)
+        for (int i = 0; i <= src->_count; ++i)
+          node->_children[i] = _clone(src->_children[i], node, i);
+    } catch (...) {
+      _destroy(node);
+      throw ;
+    }
+    return (node);
+  }
+
+  // ---------------- Split ----------------
+  // A full node gives its upper half to a new right sibling and its middle
+  // value to the parent, splitting a full parent first.
+private:
+  Node * _split ( Node * node )
+  {
+    if (node->_parent && node->_parent->_count == capacity)
+      _split(node->_parent);
+    Node * parent = node->_parent;
+    Node * right = _newNode(node->_children != nullptr);
+    if (parent == nullptr) {
+      try {
+        parent = _newNode(true);
+      } catch (...) {
+        _freeNode(right);
+        throw ;
+      }
+      _adopt(parent, 0, node);
+      _root = parent;
+    }
+    const int mid = capacity / 2;
+    for (int j = mid + 1; j < capacity; ++j)
+      _move(right, j - mid - 1, node, j);
+    if (node->_children)
+      for (int j = mid + 1; j <= capacity; ++j)
+        _adopt(right, j - mid - 1, node->_children[j]);
+    right->_count = capacity - mid - 1;
+    int p = node->_position;
+    for (int j = parent->_count; j > p; --j) {
+      _move(parent, j, parent, j - 1);
+      _adopt(parent, j + 1, parent->_children[j]);
+    }
+    _move(parent, p, node, mid);
+    _adopt(parent, p + 1, right);
+    ++parent->_count;
+    node->_count = mid;
+    return (right);
+  }
+  Position _insertLeaf ( Node * node, int i, const value_type & val )
+  {
+    if (node == nullptr)
+      node = _root = _newNode(false);
+    if (node->_count == capacity) {
+      Node * right = _split(node);
+      if (i > capacity / 2) {
+        node = right;
+        i -= capacity / 2 + 1;
+      }
+    }
+    for (int j = node->_count; j > i; --j)
+      _move(node, j, node, j - 1);
+    try {
+      _alloc.construct(&node->value(i), val);
+    } catch (...) {
+      for (int j = i; j < node->_count; ++j)
+        _move(node, j, node, j + 1);
+      if (_size == 0)
+        clear();
+      throw ;
+    }
+    node->_keys.set(i, Container::key_of(node->value(i)));
+    ++node->_count;
+    ++_size;
+    return (Position(node, i));
+  }
+
+  // ---------------- Rebalance ----------------
+private:
+  void _rebalance ( Node * node )
+  {
+    while (node != _root && node->_count < _minCount) {
+      Node * parent = node->_parent;
+      int p = node->_position;
+      Node * left = (p > 0) ? parent->_children[p - 1] : nullptr;
+      Node * right = (p < parent->_count) ? parent->_children[p + 1] : nullptr;
+      if (left && left->_count > _minCount)
+        return (_rotateRight(left, node));
+      if (right && right->_count > _minCount)
+        return (_rotateLeft(node, right));
+      if (left) _merge(left, node);
+      else      _merge(node, right);
+      node = parent;
+    }
+    if (_root->_count == 0) {
+      Node * old = _root;
+      _root = (old->_children) ? old->_children[0] : nullptr;
+      if (_root)
+        _root->_parent = nullptr;
+      _freeNode(old);
+    }
+  }
+  void _rotateRight ( Node * left, Node * node ) // node takes the last value of left, through the parent.
+  {
+    Node * parent = node->_parent;
+    int s = left->_position;
+    for (int j = node->_count; j > 0; --j)
+      _move(node, j, node, j - 1);
+    _move(node, 0, parent, s);
+    _move(parent, s, left, left->_count - 1);
+    if (node->_children) {
+      for (int j = node->_count + 1; j > 0; --j)
+        _adopt(node, j, node->_children[j - 1]);
+      _adopt(node, 0, left->_children[left->_count]);
+    }
+    --left->_count;
+    ++node->_count;
+  }
+  void _rotateLeft ( Node * node, Node * right ) // node takes the first value of right, through the parent.
+  {
+    Node * parent = node->_parent;
+    int s = node->_position;
+    _move(node, node->_count, parent, s);
+    _move(parent, s, right, 0);
+    for (int j = 1; j < right->_count; ++j)
+      _move(right, j - 1, right, j);
+    if (node->_children) {
+      _adopt(node, node->_count + 1, right->_children[0]);
+      for (int j = 1; j <= right->_count; ++j)
+        _adopt(right, j - 1, right->_children[j]);
+    }
+    ++node->_count;
+    --right->_count;
+  }
+  void _merge ( Node * left, Node * right ) // right and the separator move into left.
+  {
+    Node * parent = left->_parent;
+    int s = left->_position;
+    _move(left, left->_count, parent, s);
+    for (int j = 0; j < right->_count; ++j)
+      _move(left, left->_count + 1 + j, right, j);
+    if (left->_children)
+      for (int j = 0; j <= right->_count; ++j)
+        _adopt(left, left->_count + 1 + j, right->_children[j]);
+    left->_count += right->_count + 1;
+    for (int j = s + 1; j < parent->_count; ++j)
+      _move(parent, j - 1, parent, j);
+    for (int j = s + 2; j <= parent->_count; ++j)
+      _adopt(parent, j - 1, parent->_children[j]);
+    --parent->_count;
+    _freeNode(right);
+  }
+};
+}
+
+#endif
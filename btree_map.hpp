@@ -0,0 +1,305 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_MAP_HPP
+#define BTREE_MAP_HPP
+
+#include "Iterators/iterator_btree.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "btree.hpp"
+#include <stdexcept>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// ft::map on a B-tree: the elements are stored inline in nodes of about 256
+// bytes, so lookups touch a few cache lines per level of a shallow tree and
+// there is no allocation per element. Nodes of arithmetic keys compared with
+// std::less are searched with SIMD.
+// Unlike ft::map, insert and erase invalidate every iterator and reference,
+// as elements move between nodes.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class btree_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  struct                                                value_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+
+  static const bool value_is_key = false;
+  static const key_type & key_of ( const value_type & val ) { return (val.first); }
+private:
+  typedef ft::BTree<btree_map>                          tree_type;
+  typedef typename tree_type::Node                      Node;
+  typedef typename tree_type::Position                  Position;
+public:
+  typedef ft::iterator_btree<value_type, Node>          iterator;
+  typedef ft::iterator_btree<const value_type, Node>    const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+private:
+  key_compare     _comp;
+  allocator_type  _alloc;
+  tree_type       _tree;
+
+public:
+  // [*] // explicit btree_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > btree_map ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // btree_map ( const btree_map& x );
+  // [*] // btree_map& operator=( const btree_map& other );
+  // [*] // ~btree_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit btree_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  btree_map ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    insert(first, last);
+  }
+  btree_map ( const btree_map& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree, _alloc )
+  { }
+  btree_map& operator=( const btree_map& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~btree_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] / value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // mapped_type& at (const key_type& k);
+  // [*] // const mapped_type& at (const key_type& k) const;
+  // [*] // mapped_type& operator[] (const key_type& k);
+  mapped_type& at (const key_type& k)
+  {
+    Position pos = _tree.find(k);
+    if ( pos.first )
+      return (pos.first->value(pos.second).second);
+    else
+      throw (std::out_of_range("btree_map::at : key not found"));
+  }
+  const mapped_type& at (const key_type& k) const
+  {
+    Position pos = _tree.find(k);
+    if ( pos.first )
+      return (pos.first->value(pos.second).second);
+    else
+      throw (std::out_of_range("btree_map::at : key not found"));
+  }
+  mapped_type& operator[] (const key_type& k)
+  {
+    return (insert(ft::make_pair<key_type, mapped_type>(k, mapped_type())).first->second);
+  }
+
+  // [*] // iterator begin ( );
+  // [*] // const_iterator begin ( ) const;
+  // [*] // iterator end ( );
+  // [*] // const_iterator end ( ) const;
+  //
+  // [*] // reverse_iterator rbegin ( );
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // reverse_iterator rend ( );
+  // [*] // const_reverse_iterator rend ( ) const;
+  iterator       begin ( )       { return (_iterator(_tree.smallest())); }
+  const_iterator begin ( ) const { return (_iterator(_tree.smallest())); }
+  iterator       end ( )         { return (iterator(_tree.base(), nullptr, 0)); }
+  const_iterator end ( ) const   { return (const_iterator(_tree.base(), nullptr, 0)); }
+
+  reverse_iterator       rbegin ( )       { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  reverse_iterator       rend ( )         { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    ft::pair<Position, bool> result = _tree.insert(val);
+    return (ft::make_pair<iterator,bool>(_iterator(result.first), result.second));
+  }
+  iterator insert ( iterator position, const value_type& val ) // No search when val goes right before position.
+  {
+    if ((position == end() || _comp(val.first, position->first))
+      && (position == begin() || _comp((--iterator(position))->first, val.first)))
+      return (_iterator(_tree.insert_before(position.base(), position.index(), val)));
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(end(), *(first++)); // Sorted input only appends.
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  { return (_tree.erase(k)); }
+  void erase ( iterator position )
+  { _tree.erase(position.base(), position.index()); }
+  void erase ( iterator first, iterator last ) // Erasing moves the elements, so each step searches again.
+  {
+    if (first == last) return ;
+    size_type n = 0;
+    for (iterator it = first; it != last; ++it)
+      ++n;
+    key_type k = first->first;
+    while (n--) {
+      Position pos = _tree.lower_bound(k);
+      _tree.erase(pos.first, pos.second);
+    }
+  }
+
+  // [*] // void swap ( btree_map& x );
+  void swap ( btree_map& x )
+  { _tree.swap(x._tree); }
+
+  // [*] // void clear ( );
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  iterator find (const key_type& k)
+  { return (_iterator(_tree.find(k))); }
+  const_iterator find (const key_type& k) const
+  { return (_iterator(_tree.find(k))); }
+  size_type count( const key_type& k ) const
+  { return ((_tree.find(k).first) ? 1 : 0); }
+
+  // [*] // iterator lower_bound (const key_type& k);
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // iterator upper_bound (const key_type& k);
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  iterator lower_bound (const key_type& k)
+  { return (_iterator(_tree.lower_bound(k))); }
+  const_iterator lower_bound (const key_type& k) const
+  { return (_iterator(_tree.lower_bound(k))); }
+  iterator upper_bound (const key_type& k)
+  { return (_iterator(_tree.upper_bound(k))); }
+  const_iterator upper_bound (const key_type& k) const
+  { return (_iterator(_tree.upper_bound(k))); }
+
+  // [*] // pair<iterator,iterator>             equal_range (const key_type& k);
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  pair<iterator,iterator> equal_range (const key_type& k)
+  { return (ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
+  pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  { return (ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+private:
+  iterator _iterator ( Position pos ) const
+  { return (iterator(_tree.base(), pos.first, pos.second)); }
+
+public:
+  struct value_compare {
+  public:
+    typedef bool result_type;
+
+    Compare comp;
+    value_compare (Compare c) : comp(c) {}
+
+    result_type operator() (const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+  };
+};
+
+template< class Key, class T, class Compare, class Alloc >
+void swap (btree_map<Key,T,Compare,Alloc>& x, btree_map<Key,T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator==( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator!=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator<( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator>( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator<=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class Key, class T, class Compare, class Alloc >
+bool operator>=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+{
+  return (!(lhs < rhs));
+}
+}
+
+#endif
@@ -0,0 +1,240 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_SET_HPP
+#define BTREE_SET_HPP
+
+#include "Iterators/iterator_btree.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "btree.hpp"
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// ft::set on a B-tree, see btree_map. Insert and erase invalidate every
+// iterator and reference.
+template
+<
+class T,
+class Compare = std::less<T>,
+class Alloc = std::allocator<T>
+>
+class btree_set {
+public:
+  typedef T                                             key_type;
+  typedef T                                             mapped_type;
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  typedef Compare                                       value_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+
+  static const bool value_is_key = true;
+  static const key_type & key_of ( const value_type & val ) { return (val); }
+private:
+  typedef ft::BTree<btree_set>                          tree_type;
+  typedef typename tree_type::Node                      Node;
+  typedef typename tree_type::Position                  Position;
+public:
+  typedef ft::iterator_btree<const value_type, Node>    iterator;
+  typedef ft::iterator_btree<const value_type, Node>    const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+private:
+  key_compare     _comp;
+  allocator_type  _alloc;
+  tree_type       _tree;
+
+public:
+  // [*] // explicit btree_set ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template <class InputIterator>  btree_set ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // btree_set ( const btree_set& x );
+  // [*] // btree_set& operator=( const btree_set& x )
+  // [*] // ~btree_set ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit btree_set ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  btree_set ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    insert(first, last);
+  }
+  btree_set ( const btree_set& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree, _alloc )
+  { }
+  btree_set& operator=( const btree_set& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~btree_set ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] / value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // iterator begin ( ) const;
+  // [*] // iterator end ( ) const;
+  // [*] // reverse_iterator rbegin ( ) const;
+  // [*] // reverse_iterator rend ( ) const;
+  iterator       begin ( ) const { return (_iterator(_tree.smallest())); }
+  iterator       end ( ) const   { return (iterator(_tree.base(), nullptr, 0)); }
+
+  reverse_iterator       rbegin ( ) const { return (reverse_iterator(this->end())); }
+  reverse_iterator       rend ( ) const   { return (reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    ft::pair<Position, bool> result = _tree.insert(val);
+    return (ft::make_pair<iterator,bool>(_iterator(result.first), result.second));
+  }
+  iterator insert ( iterator position, const value_type& val ) // No search when val goes right before position.
+  {
+    if ((position == end() || _comp(val, *position))
+      && (position == begin() || _comp(*(--iterator(position)), val)))
+      return (_iterator(_tree.insert_before(position.base(), position.index(), val)));
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(end(), *(first++)); // Sorted input only appends.
+  }
+
+  // [*] // size_type erase ( const value_type& val );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const value_type& val )
+  { return (_tree.erase(val)); }
+  void erase ( iterator position )
+  { _tree.erase(position.base(), position.index()); }
+  void erase ( iterator first, iterator last ) // Erasing moves the elements, so each step searches again.
+  {
+    if (first == last) return ;
+    size_type n = 0;
+    for (iterator it = first; it != last; ++it)
+      ++n;
+    value_type val = *first;
+    while (n--) {
+      Position pos = _tree.lower_bound(val);
+      _tree.erase(pos.first, pos.second);
+    }
+  }
+
+  // [*] // void swap ( btree_set& x );
+  void swap ( btree_set& x )
+  { _tree.swap(x._tree); }
+
+  // [*] // void clear ( );
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // iterator find (const value_type& val) const;
+  // [*] // size_type count (const value_type& val) const;
+  iterator find (const value_type& val) const
+  { return (_iterator(_tree.find(val))); }
+  size_type count (const value_type& val) const
+  { return ((_tree.find(val).first) ? 1 : 0); }
+
+  // [*] // iterator lower_bound (const value_type& val) const;
+  // [*] // iterator upper_bound (const value_type& val) const;
+  // [*] // pair<iterator,iterator> equal_range (const value_type& val) const;
+  iterator lower_bound (const value_type& val) const
+  { return (_iterator(_tree.lower_bound(val))); }
+  iterator upper_bound (const value_type& val) const
+  { return (_iterator(_tree.upper_bound(val))); }
+  pair<iterator,iterator> equal_range (const value_type& val) const
+  { return (ft::make_pair<iterator, iterator>(lower_bound(val), upper_bound(val))); }
+
+private:
+  iterator _iterator ( Position pos ) const
+  { return (iterator(_tree.base(), pos.first, pos.second)); }
+};
+
+template< class T, class Compare, class Alloc >
+void swap (btree_set<T,Compare,Alloc>& x, btree_set<T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+
+template< class T, class Compare, class Alloc >
+bool operator==( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class T, class Compare, class Alloc >
+bool operator!=( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class T, class Compare, class Alloc >
+bool operator<( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class T, class Compare, class Alloc >
+bool operator>( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class T, class Compare, class Alloc >
+bool operator<=( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class T, class Compare, class Alloc >
+bool operator>=( const ft::btree_set<T,Compare,Alloc>& lhs, const ft::btree_set<T,Compare,Alloc>& rhs )
+{
+  return (!(lhs < rhs));
+}
+}
+
+#endif
@@ -0,0 +1,268 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_MAP_HPP
+#define CONCURRENT_MAP_HPP
+
+#include "map.hpp"
+#include "vector.hpp"
+#include "utilities/rw_lock.hpp"
+#include <algorithm>
+#include <new>
+
+namespace ft
+{
+// An ordered map for many threads: the keys are hash-partitioned over a
+// power-of-two number of ft::map shards, each behind its own reader-writer
+// lock, so threads only contend when they hit the same shard.
+// Elements are copied in and out under the lock; nothing hands out a
+// reference that could outlive it. Scans are consistent per shard, and
+// scan() over all shards is one consistent view at the price of holding
+// every shard's read lock while it runs.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Hash = ft::hash<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class concurrent_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Compare                                       key_compare;
+  typedef Hash                                          hasher;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::map<Key, T, Compare, Alloc>               shard_type;
+
+private:
+  struct Shard {
+    ft::rw_lock lock;
+    shard_type  map;
+    char        pad[64]; // Keeps the next shard's lock off this cache line.
+
+    Shard ( const key_compare & comp, const allocator_type & alloc ) : map(comp, alloc) { }
+  };
+  typedef typename allocator_type::template rebind<Shard>::other  allocator_shard_type;
+  typedef typename shard_type::const_iterator                     shard_iterator;
+
+  struct Cursor {
+    shard_iterator  it;
+    shard_iterator  end;
+  };
+  struct CursorGreater { // For a min-heap on the current keys.
+    key_compare comp;
+
+    CursorGreater ( const key_compare & c ) : comp(c) { }
+    bool operator() ( const Cursor & lhs, const Cursor & rhs ) const
+    { return (comp(rhs.it->first, lhs.it->first)); }
+  };
+
+private:
+  key_compare           _comp;
+  hasher                _hash;
+  allocator_type        _alloc;
+  allocator_shard_type  _alloc_shard;
+  Shard                 * _shards;
+  size_type             _mask;
+
+  concurrent_map ( const concurrent_map & );
+  concurrent_map & operator= ( const concurrent_map & );
+
+public:
+  // [*] // explicit concurrent_map ( size_type shards = 16, const key_compare& comp = key_compare(), const hasher& hash = hasher(), const allocator_type& alloc = allocator_type() );
+  // [*] // ~concurrent_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit concurrent_map ( size_type shards = 16, const key_compare& comp = key_compare(), const hasher& hash = hasher(), const allocator_type& alloc = allocator_type() ) // Rounded up to a power of two.
+    : _comp ( comp )
+    , _hash ( hash )
+    , _alloc ( alloc )
+    , _alloc_shard ( alloc )
+    , _shards ( nullptr )
+    , _mask ( 0 )
+  {
+    size_type n = 1;
+    while (n < shards) n <<= 1;
+    _shards = _alloc_shard.allocate(n);
+    size_type built = 0;
+    try {
+      for (; built < n; ++built)
+        new (&_shards[built]) Shard(_comp, _alloc);
+    } catch (...) {
+      while (built) _shards[--built].~Shard();
+      _alloc_shard.deallocate(_shards, n);
+      throw ;
+    }
+    _mask = n - 1;
+  }
+  ~concurrent_map ( )
+  {
+    for (size_type i = 0; i <= _mask; ++i)
+      _shards[i].~Shard();
+    _alloc_shard.deallocate(_shards, _mask + 1);
+  }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const;
+  // [*] // hasher hash_function() const;
+  // [*] // size_type shard_count ( ) const;
+  // [*] // size_type shard_of ( const key_type& k ) const;
+  key_compare key_comp() const { return (_comp); }
+  hasher hash_function() const { return (_hash); }
+  size_type shard_count ( ) const { return (_mask + 1); }
+  size_type shard_of ( const key_type& k ) const { return (_hash(k) & _mask); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // Shard by shard, so only exact while no thread writes.
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const
+  {
+    size_type result = 0;
+    for (size_type i = 0; i <= _mask; ++i) {
+      ft::read_guard guard(_shards[i].lock);
+      result += _shards[i].map.size();
+    }
+    return (result);
+  }
+
+  // [*] // bool insert ( const value_type& val );
+  // [*] // bool assign ( const key_type& k, const mapped_type& v );
+  // [*] // template < class F > bool update ( const key_type& k, F f );
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void clear ( );
+  bool insert ( const value_type& val ) // false when the key was already there.
+  {
+    Shard & shard = _shards[shard_of(val.first)];
+    ft::write_guard guard(shard.lock);
+    return (shard.map.insert(val).second);
+  }
+  bool assign ( const key_type& k, const mapped_type& v ) // Insert or overwrite; true when inserted.
+  {
+    Shard & shard = _shards[shard_of(k)];
+    ft::write_guard guard(shard.lock);
+    ft::pair<typename shard_type::iterator, bool> result = shard.map.insert(value_type(k, v));
+    if (!result.second)
+      result.first->second = v;
+    return (result.second);
+  }
+  template < class F >
+  bool update ( const key_type& k, F f ) // Calls f(mapped_type&) under the shard's write lock, if k is there.
+  {
+    Shard & shard = _shards[shard_of(k)];
+    ft::write_guard guard(shard.lock);
+    typename shard_type::iterator it = shard.map.find(k);
+    if (it == shard.map.end())
+      return (false);
+    f(it->second);
+    return (true);
+  }
+  size_type erase ( const key_type& k )
+  {
+    Shard & shard = _shards[shard_of(k)];
+    ft::write_guard guard(shard.lock);
+    return (shard.map.erase(k));
+  }
+  void clear ( ) // Shard by shard.
+  {
+    for (size_type i = 0; i <= _mask; ++i) {
+      ft::write_guard guard(_shards[i].lock);
+      _shards[i].map.clear();
+    }
+  }
+
+  // [*] // bool find ( const key_type& k, mapped_type& value ) const;
+  // [*] // size_type count ( const key_type& k ) const;
+  bool find ( const key_type& k, mapped_type& value ) const // Copies the mapped value out.
+  {
+    Shard & shard = _shards[shard_of(k)];
+    ft::read_guard guard(shard.lock);
+    shard_iterator it = shard.map.find(k);
+    if (it == shard.map.end())
+      return (false);
+    value = it->second;
+    return (true);
+  }
+  size_type count ( const key_type& k ) const
+  {
+    Shard & shard = _shards[shard_of(k)];
+    ft::read_guard guard(shard.lock);
+    return (shard.map.count(k));
+  }
+
+  // [*] // template < class F > F scan_shard ( size_type shard, const key_type& lo, const key_type& hi, F f ) const;
+  // [*] // template < class F > F for_each_in_shard ( size_type shard, F f ) const;
+  // [*] // template < class F > F scan ( const key_type& lo, const key_type& hi, F f ) const;
+  // f(const value_type&) sees [lo, hi) in key order, under read locks: it
+  // must not call back into the map.
+  template < class F >
+  F scan_shard ( size_type shard, const key_type& lo, const key_type& hi, F f ) const
+  {
+    const shard_type & map = _shards[shard].map;
+    ft::read_guard guard(_shards[shard].lock);
+    for (shard_iterator it = map.lower_bound(lo); it != map.end() && _comp(it->first, hi); ++it)
+      f(*it);
+    return (f);
+  }
+  template < class F >
+  F for_each_in_shard ( size_type shard, F f ) const
+  {
+    const shard_type & map = _shards[shard].map;
+    ft::read_guard guard(_shards[shard].lock);
+    for (shard_iterator it = map.begin(); it != map.end(); ++it)
+      f(*it);
+    return (f);
+  }
+  // Merges the shards with a heap: O(log shards) per element. The read locks
+  // are taken in shard order, which cannot deadlock with writers as they
+  // only ever hold one.
+  template < class F >
+  F scan ( const key_type& lo, const key_type& hi, F f ) const
+  {
+    ft::vector<Cursor> heap;
+    CursorGreater greater(_comp);
+    size_type locked = 0;
+
+    try {
+      heap.reserve(_mask + 1);
+      for (; locked <= _mask; ++locked) {
+        _shards[locked].lock.lock_shared();
+        Cursor cursor;
+        cursor.it = _shards[locked].map.lower_bound(lo);
+        cursor.end = _shards[locked].map.end();
+        if (cursor.it != cursor.end && _comp(cursor.it->first, hi))
+          heap.push_back(cursor);
+      }
+      std::make_heap(heap.begin(), heap.end(), greater);
+      while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        Cursor & cursor = heap.back();
+        f(*cursor.it);
+        if (++cursor.it != cursor.end && _comp(cursor.it->first, hi))
+          std::push_heap(heap.begin(), heap.end(), greater);
+        else
+          heap.pop_back();
+      }
+    } catch (...) {
+      while (locked) _shards[--locked].lock.unlock_shared();
+      throw ;
+    }
+    while (locked) _shards[--locked].lock.unlock_shared();
+    return (f);
+  }
+};
+}
+
+#endif
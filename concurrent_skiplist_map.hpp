@@ -0,0 +1,493 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_skiplist_map.hpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_SKIPLIST_MAP_HPP
+#define CONCURRENT_SKIPLIST_MAP_HPP
+
+#include "Iterators/iterator_skiplist.hpp"
+#include "utils.hpp"
+#include "utilities/epoch.hpp"
+#include <stdint.h>
+#include <memory>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// An ordered map that any number of threads may insert into, erase from and
+// read at once, without locks (Fraser's skiplist): a node is published by
+// one CAS on the bottom level and linked upwards afterwards; erase marks the
+// node's links, which is the logical delete, and every search unlinks the
+// marked nodes it walks over. Nodes are reclaimed through epochs, so a
+// thread never reads freed memory; an iterator pins the epoch it was
+// created in, so keep them short-lived or the reclamation stalls.
+// Iterators are forward only and weakly consistent. The mapped values are
+// not synchronized: writing one while another thread reads it is a race.
+// clear(), the copy and the assignment need the map to themselves.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class concurrent_skiplist_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+
+  struct Node {
+    value_type  * _value;     // Into the node's own block; null in the head.
+    Node        * _retired;
+    int         _state;       // _inserted and _erased, as each side is done with the node.
+    int         _height;
+    uintptr_t   _next[1];     // _height links; the low bit marks the node erased at that level.
+
+    Node * next ( int i ) const { return (reinterpret_cast<Node *>(atomic_load(&_next[i]) & ~uintptr_t(1))); }
+    bool isErased ( ) const     { return (atomic_load(&_next[0]) & 1); }
+  };
+
+private:
+  typedef ft::epoch_domain<Node, concurrent_skiplist_map, Alloc>      domain_type;
+  typedef ft::epoch_guard<domain_type>                                guard_type;
+  typedef typename domain_type::record                                record_type;
+  typedef typename allocator_type::template rebind<uintptr_t>::other  allocator_word_type;
+
+  friend class ft::epoch_domain<Node, concurrent_skiplist_map, Alloc>;
+
+public:
+  typedef ft::iterator_skiplist<value_type, Node, domain_type>        iterator;
+  typedef ft::iterator_skiplist<const value_type, Node, domain_type>  const_iterator;
+
+private:
+  static const int  _maxLevel = 24;
+  static const int  _inserted = 1;
+  static const int  _erased = 2;
+
+  key_compare         _comp;
+  allocator_type      _alloc;
+  allocator_word_type _alloc_word;
+  Node                * _head;
+  int                 _levels;
+  size_type           _size;
+  mutable domain_type _domain;
+
+public:
+  // [*] // explicit concurrent_skiplist_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > concurrent_skiplist_map ( InputIterator first, InputIterator last, ... );
+  // [*] // concurrent_skiplist_map ( const concurrent_skiplist_map& x );
+  // [*] // concurrent_skiplist_map& operator=( const concurrent_skiplist_map& x );
+  // [*] // ~concurrent_skiplist_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit concurrent_skiplist_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _alloc_word ( alloc )
+    , _head ( nullptr )
+    , _levels ( 1 )
+    , _size ( 0 )
+    , _domain ( this, alloc )
+  { _head = _createNode(_maxLevel, nullptr); }
+  template < class InputIterator >
+  concurrent_skiplist_map ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _alloc_word ( alloc )
+    , _head ( nullptr )
+    , _levels ( 1 )
+    , _size ( 0 )
+    , _domain ( this, alloc )
+  {
+    _head = _createNode(_maxLevel, nullptr);
+    try {
+      insert(first, last);
+    } catch (...) {
+      clear();
+      reclaim(_head);
+      throw ;
+    }
+  }
+  concurrent_skiplist_map ( const concurrent_skiplist_map& x ) // A weakly consistent copy if x is being changed.
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _alloc_word ( x._alloc_word )
+    , _head ( nullptr )
+    , _levels ( 1 )
+    , _size ( 0 )
+    , _domain ( this, x._alloc )
+  {
+    _head = _createNode(_maxLevel, nullptr);
+    try {
+      insert(x.begin(), x.end());
+    } catch (...) {
+      clear();
+      reclaim(_head);
+      throw ;
+    }
+  }
+  concurrent_skiplist_map& operator=( const concurrent_skiplist_map& x )
+  {
+    if (this != &x) {
+      clear();
+      insert(x.begin(), x.end());
+    }
+    return (*this);
+  }
+  ~concurrent_skiplist_map ( )
+  {
+    clear();
+    reclaim(_head);
+  }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // iterator begin();
+  // [*] // const_iterator begin() const;
+  // [*] // iterator end();
+  // [*] // const_iterator end() const;
+  iterator        begin ( )       { return (_first<iterator>()); }
+  const_iterator  begin ( ) const { return (_first<const_iterator>()); }
+  iterator        end ( )         { return (iterator()); }
+  const_iterator  end ( ) const   { return (const_iterator()); }
+
+  // [*] // bool empty() const;
+  // [*] // size_type size() const;
+  // [*] // size_type max_size() const;
+  // Exact only while no thread writes.
+  bool      empty ( ) const     { return (size() == 0); }
+  size_type size ( ) const      { return (atomic_load(&_size)); }
+  size_type max_size ( ) const  { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert (const value_type& val);
+  // [*] // template <class InputIterator> void insert (InputIterator first, InputIterator last);
+  ft::pair<iterator,bool> insert ( const value_type& val )
+  {
+    guard_type  guard(_domain);
+    Node        * preds[_maxLevel];
+    Node        * succs[_maxLevel];
+    int         height = _randomHeight(guard.pin());
+    Node        * n = nullptr;
+
+    _raiseLevels(height);
+    for (;;) {
+      Node * found = _search(val.first, preds, succs, nullptr);
+      if (found && !_comp(val.first, found->_value->first)) {
+        if (n)
+          reclaim(n); // Never published.
+        return (ft::make_pair(iterator(&_domain, guard.pin(), found), false));
+      }
+      if (!n)
+        n = _createNode(height, &val);
+      for (int i = 0; i < height; ++i)
+        n->_next[i] = _link(succs[i]);
+      uintptr_t expected = _link(succs[0]);
+      if (atomic_compare_exchange(&preds[0]->_next[0], expected, _link(n)))
+        break;
+    }
+    atomic_fetch_add(&_size, size_type(1));
+    iterator result(&_domain, guard.pin(), n);
+    _linkUpper(guard.pin(), n, preds, succs);
+    return (ft::make_pair(result, true));
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      insert(*(first++));
+  }
+
+  // [*] // void erase (iterator position);
+  // [*] // size_type erase (const key_type& k);
+  // [*] // void clear();
+  void erase ( iterator position )
+  {
+    guard_type guard(_domain);
+    _erase(guard.pin(), position.base());
+  }
+  size_type erase ( const key_type& k ) // 0 when another thread erased k first.
+  {
+    guard_type  guard(_domain);
+    Node        * n = _find(k);
+    return (n && _erase(guard.pin(), n));
+  }
+  void clear ( )
+  {
+    Node * n = _head->next(0);
+    while (n) {
+      Node * next = n->next(0);
+      reclaim(n);
+      n = next;
+    }
+    for (int i = 0; i < _maxLevel; ++i)
+      _head->_next[i] = 0;
+    _domain.reclaim_all();
+    _size = 0;
+  }
+
+  // [*] // key_compare key_comp() const
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count (const key_type& k) const;
+  iterator find ( const key_type& k )
+  {
+    guard_type guard(_domain);
+    return (iterator(&_domain, guard.pin(), _find(k)));
+  }
+  const_iterator find ( const key_type& k ) const
+  {
+    guard_type guard(_domain);
+    return (const_iterator(&_domain, guard.pin(), _find(k)));
+  }
+  size_type count ( const key_type& k ) const
+  {
+    guard_type guard(_domain);
+    return (_find(k) != nullptr);
+  }
+
+  // [*] // iterator lower_bound (const key_type& k);
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // iterator upper_bound (const key_type& k);
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  iterator lower_bound ( const key_type& k )
+  {
+    guard_type guard(_domain);
+    return (iterator(&_domain, guard.pin(), _lowerBound(k)));
+  }
+  const_iterator lower_bound ( const key_type& k ) const
+  {
+    guard_type guard(_domain);
+    return (const_iterator(&_domain, guard.pin(), _lowerBound(k)));
+  }
+  iterator upper_bound ( const key_type& k )
+  {
+    guard_type guard(_domain);
+    return (iterator(&_domain, guard.pin(), _upperBound(k)));
+  }
+  const_iterator upper_bound ( const key_type& k ) const
+  {
+    guard_type guard(_domain);
+    return (const_iterator(&_domain, guard.pin(), _upperBound(k)));
+  }
+
+private:
+  // ---------------- nodes ----------------
+  static uintptr_t  _link ( Node * n )          { return (reinterpret_cast<uintptr_t>(n)); }
+  static Node *     _ptr ( uintptr_t link )     { return (reinterpret_cast<Node *>(link & ~uintptr_t(1))); }
+  static bool       _isMarked ( uintptr_t link ) { return (link & 1); }
+  // The value is stored after the links, in the same block, so a search
+  // reading the key stays on the node's cache lines.
+  static size_t     _valueOffset ( int height )
+  {
+    size_t align = __alignof__(value_type);
+    return ((sizeof(Node) + (height - 1) * sizeof(uintptr_t) + align - 1) / align * align);
+  }
+  static size_t     _words ( int height, bool hasValue )
+  {
+    size_t bytes = (hasValue) ? _valueOffset(height) + sizeof(value_type) : sizeof(Node) + (height - 1) * sizeof(uintptr_t);
+    return ((bytes + sizeof(uintptr_t) - 1) / sizeof(uintptr_t));
+  }
+
+  Node * _createNode ( int height, const value_type * val )
+  {
+    uintptr_t * block = _alloc_word.allocate(_words(height, val));
+    Node      * n = reinterpret_cast<Node *>(block);
+    n->_value = nullptr;
+    if (val) {
+      value_type * v = reinterpret_cast<value_type *>(reinterpret_cast<char *>(block) + _valueOffset(height));
+      try {
+        _alloc.construct(v, *val);
+      } catch (...) {
+        _alloc_word.deallocate(block, _words(height, val));
+        throw ;
+      }
+      n->_value = v;
+    }
+    n->_retired = nullptr;
+    n->_state = 0;
+    n->_height = height;
+    for (int i = 0; i < height; ++i)
+      n->_next[i] = 0;
+    return (n);
+  }
+  static Node *& limbo ( Node * n ) { return (n->_retired); }
+  void reclaim ( Node * n )
+  {
+    if (n->_value)
+      _alloc.destroy(n->_value);
+    _alloc_word.deallocate(reinterpret_cast<uintptr_t *>(n), _words(n->_height, n->_value));
+  }
+  // Geometric, p = 1/4, from the pin's own xorshift state.
+  int _randomHeight ( record_type * rec )
+  {
+    uint64_t x = rec->_seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rec->_seed = x;
+    int height = 1;
+    while (height < _maxLevel && (x & 3) == 0) {
+      ++height;
+      x >>= 2;
+    }
+    return (height);
+  }
+  void _raiseLevels ( int height )
+  {
+    int levels = atomic_load(&_levels);
+    while (levels < height && !atomic_compare_exchange(&_levels, levels, height))
+      ;
+  }
+
+  // ---------------- search ----------------
+  // Fills preds and succs below _levels and returns succs[0], the first node
+  // not less than k, unlinking the marked nodes it meets. Given a target, it
+  // also walks past the other nodes of an equal key, so the target is met.
+  Node * _search ( const key_type & k, Node ** preds, Node ** succs, Node * target ) const
+  {
+  retry:
+    Node * pred = _head;
+    for (int i = atomic_load(&_levels) - 1; i >= 0; --i) {
+      Node * curr = pred->next(i);
+      while (curr) {
+        uintptr_t succ = atomic_load(&curr->_next[i]);
+        while (_isMarked(succ)) {
+          uintptr_t expected = _link(curr);
+          if (!atomic_compare_exchange(&pred->_next[i], expected, succ & ~uintptr_t(1)))
+            goto retry;
+          curr = _ptr(succ);
+          if (!curr)
+            break;
+          succ = atomic_load(&curr->_next[i]);
+        }
+        if (!curr)
+          break;
+        if (!_comp(curr->_value->first, k) && (curr == target || !target || _comp(k, curr->_value->first)))
+          break;
+        pred = curr;
+        curr = _ptr(succ);
+      }
+      preds[i] = pred;
+      succs[i] = curr;
+    }
+    return (succs[0]);
+  }
+  // Read-only descent: skips the marked nodes instead of unlinking them.
+  Node * _lowerBound ( const key_type & k ) const
+  {
+    Node * pred = _head;
+    Node * curr = nullptr;
+    for (int i = atomic_load(&_levels) - 1; i >= 0; --i) {
+      curr = pred->next(i);
+      while (curr && (_isMarked(atomic_load(&curr->_next[i])) || _comp(curr->_value->first, k))) {
+        if (!_isMarked(atomic_load(&curr->_next[i])))
+          pred = curr;
+        curr = curr->next(i);
+      }
+    }
+    while (curr && curr->isErased())
+      curr = curr->next(0);
+    return (curr);
+  }
+  Node * _upperBound ( const key_type & k ) const
+  {
+    Node * n = _lowerBound(k);
+    while (n && (n->isErased() || !_comp(k, n->_value->first)))
+      n = n->next(0);
+    return (n);
+  }
+  Node * _find ( const key_type & k ) const
+  {
+    Node * n = _lowerBound(k);
+    return ((n && !_comp(k, n->_value->first)) ? n : nullptr);
+  }
+
+  template < class It >
+  It _first ( ) const
+  {
+    guard_type  guard(_domain);
+    Node        * n = _head->next(0);
+    while (n && n->isErased())
+      n = n->next(0);
+    return (It(&_domain, guard.pin(), n));
+  }
+
+  // ---------------- linking ----------------
+  // Links n above the bottom level, refreshing preds and succs when a CAS
+  // loses, and gives up once n is being erased.
+  void _linkUpper ( record_type * rec, Node * n, Node ** preds, Node ** succs )
+  {
+    const key_type & k = n->_value->first;
+    for (int i = 1; i < n->_height && !n->isErased(); ++i) {
+      for (;;) {
+        uintptr_t link = atomic_load(&n->_next[i]);
+        if (_isMarked(link))
+          break;
+        if (_ptr(link) != succs[i] && !atomic_compare_exchange(&n->_next[i], link, _link(succs[i])))
+          continue;
+        uintptr_t expected = _link(succs[i]);
+        if (atomic_compare_exchange(&preds[i]->_next[i], expected, _link(n)))
+          break;
+        _search(k, preds, succs, n);
+        if (n->isErased())
+          break;
+      }
+    }
+    if (n->isErased()) // Our links may have come after the eraser's search.
+      _search(k, preds, succs, n);
+    _finish(rec, n, _inserted);
+  }
+  // Marks n from the top down; marking the bottom level is the erase.
+  bool _erase ( record_type * rec, Node * n )
+  {
+    for (int i = n->_height - 1; i > 0; --i) {
+      uintptr_t link = atomic_load(&n->_next[i]);
+      while (!_isMarked(link) && !atomic_compare_exchange(&n->_next[i], link, link | 1))
+        ;
+    }
+    uintptr_t link = atomic_load(&n->_next[0]);
+    for (;;) {
+      if (_isMarked(link))
+        return (false);
+      if (atomic_compare_exchange(&n->_next[0], link, link | 1))
+        break;
+    }
+    atomic_fetch_add(&_size, size_type(-1));
+    Node * preds[_maxLevel];
+    Node * succs[_maxLevel];
+    _search(n->_value->first, preds, succs, n);
+    _finish(rec, n, _erased);
+    return (true);
+  }
+  // The inserter may still be linking n when it gets erased: whichever of
+  // the two is done last has seen n unlinked everywhere and retires it.
+  void _finish ( record_type * rec, Node * n, int side )
+  {
+    if (atomic_fetch_add(&n->_state, side) != 0)
+      _domain.retire(rec, n);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,236 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include "utilities/aligned_storage.hpp"
+#include "utilities/atomic.hpp"
+#include "utilities/hash.hpp"
+#include <stdint.h>
+#include <memory>
+
+namespace ft
+{
+// A stack that any number of threads may push to and pop from at once,
+// without locks (Treiber's stack). Nodes come from a pool of slabs that is
+// only freed with the stack, and are named by 32-bit indices, so that the
+// head packs an index with a 32-bit tag bumped on every change: a pop whose
+// node was popped and pushed again meanwhile fails its CAS (no ABA).
+// When the CAS on the head fails, a thread backs off into an elimination
+// array instead of retrying at once: a push offers its node in a random
+// slot for a while, and a pop that finds an offer takes it, so the pair
+// cancels without touching the head. empty() is only a snapshot, and
+// clear() needs the stack to itself.
+template
+<
+class T,
+class Alloc = std::allocator<T>
+>
+class concurrent_stack {
+public:
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::size_type            size_type;
+
+private:
+  struct Node {
+    uint32_t  _next; // Index + 1, 0 at the bottom.
+    ft::aligned_storage<value_type> _storage;
+
+    value_type & value ( ) { return (*_storage.data()); }
+  };
+  struct Line { // One word per cache line, so that hot words do not share one.
+    uint64_t  _word;
+    char      _pad[64 - sizeof(uint64_t)];
+  };
+  typedef typename allocator_type::template rebind<Node>::other  allocator_node_type;
+
+  static const uint32_t _firstSlab = 64;  // Slab k holds _firstSlab << k nodes.
+  static const int      _slabs = 27;      // Enough for every 32-bit index.
+  static const int      _eliminationSlots = 16;
+  static const int      _eliminationSpins = 256;
+  static const uint64_t _taken = ~uint64_t(0);
+
+  allocator_type      _alloc;
+  allocator_node_type _alloc_node;
+  Line                _head;      // Tag << 32 | index + 1.
+  Line                _free;      // The pooled nodes, the same way.
+  Line                _fresh;     // The next index never handed out.
+  Node                * _slab[_slabs];
+  Line                _elimination[_eliminationSlots]; // 0, an offered index + 1, or _taken.
+
+  concurrent_stack ( const concurrent_stack & );
+  concurrent_stack & operator= ( const concurrent_stack & );
+
+public:
+  // [*] // explicit concurrent_stack ( const allocator_type& alloc = allocator_type() );
+  // [*] // ~concurrent_stack ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit concurrent_stack ( const allocator_type& alloc = allocator_type() )
+    : _alloc ( alloc )
+    , _alloc_node ( alloc )
+  {
+    _head._word = _free._word = _fresh._word = 0;
+    for (int k = 0; k < _slabs; ++k)
+      _slab[k] = nullptr;
+    for (int i = 0; i < _eliminationSlots; ++i)
+      _elimination[i]._word = 0;
+  }
+  ~concurrent_stack ( )
+  {
+    clear();
+    for (int k = 0; k < _slabs; ++k)
+      if (_slab[k])
+        _alloc_node.deallocate(_slab[k], size_type(_firstSlab) << k);
+  }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type pooled ( ) const;
+  bool empty ( ) const { return ((atomic_load(&_head._word) & 0xffffffffu) == 0); }
+  size_type pooled ( ) const { return (atomic_load(&_fresh._word)); } // Nodes ever allocated, in use or not.
+
+  // [*] // void push ( const value_type& val );
+  // [*] // bool try_pop ( value_type& val );
+  // [*] // void clear ( );
+  void push ( const value_type& val )
+  {
+    uint32_t index = _acquire();
+    try {
+      _alloc.construct(&_node(index)->value(), val);
+    } catch (...) {
+      _push(&_free._word, index);
+      throw ;
+    }
+    for (;;) {
+      if (_tryPush(&_head._word, index) || _offer(index))
+        return ;
+    }
+  }
+  bool try_pop ( value_type& val ) // False when the stack was empty.
+  {
+    uint32_t index;
+    for (;;) {
+      int result = _tryPop(&_head._word, index);
+      if (result < 0)
+        return (false);
+      if (result > 0 || _take(index))
+        break ;
+    }
+    Node * node = _node(index);
+    try {
+      val = node->value();
+    } catch (...) {
+      _push(&_head._word, index);
+      throw ;
+    }
+    _alloc.destroy(&node->value());
+    _push(&_free._word, index);
+    return (true);
+  }
+  void clear ( )
+  {
+    uint32_t index;
+    while (_tryPop(&_head._word, index) > 0) {
+      _alloc.destroy(&_node(index)->value());
+      _push(&_free._word, index);
+    }
+  }
+
+private:
+  // ---------------- nodes ----------------
+  Node * _node ( uint32_t index ) const
+  {
+    uint32_t k = 31 - __builtin_clz(index / _firstSlab + 1);
+    return (_slab[k] + (index - _firstSlab * ((uint32_t(1) << k) - 1)));
+  }
+  uint32_t _acquire ( ) // A node from the pool, or a fresh one.
+  {
+    uint32_t index;
+    if (_tryPop(&_free._word, index) > 0)
+      return (index);
+    index = uint32_t(atomic_fetch_add(&_fresh._word, uint64_t(1)));
+    uint32_t k = 31 - __builtin_clz(index / _firstSlab + 1);
+    if (atomic_load(&_slab[k]) == nullptr) { // Whoever loses the race frees its slab.
+      Node * slab = _alloc_node.allocate(size_type(_firstSlab) << k);
+      Node * expected = nullptr;
+      if (!atomic_compare_exchange(&_slab[k], expected, slab))
+        _alloc_node.deallocate(slab, size_type(_firstSlab) << k);
+    }
+    return (index);
+  }
+
+  // ---------------- tagged heads ----------------
+  bool _tryPush ( uint64_t * head, uint32_t index )
+  {
+    uint64_t old = atomic_load(head);
+    atomic_store(&_node(index)->_next, uint32_t(old));
+    return (atomic_compare_exchange(head, old, ((old >> 32) + 1) << 32 | (index + 1)));
+  }
+  void _push ( uint64_t * head, uint32_t index )
+  {
+    while (!_tryPush(head, index))
+      ;
+  }
+  int _tryPop ( uint64_t * head, uint32_t & index ) // -1 when empty, 0 when the CAS failed.
+  {
+    uint64_t old = atomic_load(head);
+    if (uint32_t(old) == 0)
+      return (-1);
+    index = uint32_t(old) - 1;
+    uint32_t next = atomic_load(&_node(index)->_next); // Stale when the node was popped meanwhile, then the tag fails the CAS.
+    return (atomic_compare_exchange(head, old, ((old >> 32) + 1) << 32 | next) ? 1 : 0);
+  }
+
+  // ---------------- elimination ----------------
+  static uint64_t * _slotSeed ( )
+  {
+    static __thread uint64_t seed = 0;
+    return (&seed);
+  }
+  uint64_t * _randomSlot ( )
+  {
+    uint64_t * seed = _slotSeed();
+    *seed = hash_mix(*seed + reinterpret_cast<uintptr_t>(seed));
+    return (&_elimination[*seed % _eliminationSlots]._word);
+  }
+  bool _offer ( uint32_t index ) // True when a pop took the node.
+  {
+    uint64_t * slot = _randomSlot();
+    uint64_t expected = 0;
+    if (!atomic_compare_exchange(slot, expected, uint64_t(index) + 1))
+      return (false);
+    for (int spin = 0; spin < _eliminationSpins; ++spin)
+      if (atomic_load(slot) == _taken)
+        break ;
+    expected = uint64_t(index) + 1;
+    if (atomic_compare_exchange(slot, expected, uint64_t(0)))
+      return (false);
+    atomic_store(slot, uint64_t(0)); // Only the offering thread resets a taken slot.
+    return (true);
+  }
+  bool _take ( uint32_t & index ) // The slot may hold another offer than the one seen, which is as good.
+  {
+    uint64_t * slot = _randomSlot();
+    uint64_t offer = atomic_load(slot);
+    if (offer == 0 || offer == _taken || !atomic_compare_exchange(slot, offer, _taken))
+      return (false);
+    index = uint32_t(offer - 1);
+    return (true);
+  }
+};
+}
+
+#endif
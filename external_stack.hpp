@@ -0,0 +1,208 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   external_stack.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EXTERNAL_STACK_HPP
+#define EXTERNAL_STACK_HPP
+
+#include "vector.hpp"
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#include <stdexcept>
+
+namespace ft
+{
+// A stack that outgrows memory: it keeps its top in a window of fixed size
+// and moves the rest to an unlinked temporary file, a 1MB block at a time.
+// The window is a ring of blocks in an ft::vector: when it is full, its
+// bottom block is appended to the file, and when the pops empty it, the
+// last block of the file is read back. Once the pops reach the last block
+// of the window, a thread starts reading the next block from the file into
+// the free slot below it, so a steady run of pops seldom waits for the disk.
+// The file holds raw bytes, so T must be trivially copyable.
+template
+<
+class T,
+class Alloc = std::allocator<T>
+>
+class external_stack {
+public:
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+
+  static const size_type block_bytes = size_type(1) << 20;
+
+private:
+  struct Read { // What the prefetch thread works on.
+    int         _fd;
+    char        * _buffer;
+    size_type   _bytes;
+    off_t       _offset;
+    bool        _ok;
+  };
+
+  size_type                           _block;   // Elements per block.
+  size_type                           _cap;     // Elements in the window.
+  ft::vector<value_type, allocator_type> _ring;
+  size_type                           _first;   // The bottom of the window, at a block boundary.
+  size_type                           _next;    // One past the top.
+  size_type                           _hot;     // Elements in the window.
+  size_type                           _spilled; // Blocks in the file.
+  int                                 _fd;
+  pthread_t                           _thread;
+  bool                                _prefetching;
+  Read                                _read;
+
+  external_stack ( const external_stack & );
+  external_stack & operator= ( const external_stack & );
+
+public:
+  // [*] // explicit external_stack ( size_type memory = 64 << 20, const char* directory = nullptr, const allocator_type& alloc = allocator_type() );
+  // [*] // ~external_stack ( );
+  // memory bounds the window, in bytes, rounded down to whole blocks (at
+  // least 2); the file goes to directory, or $TMPDIR, or /tmp.
+  explicit external_stack ( size_type memory = size_type(64) << 20, const char* directory = nullptr, const allocator_type& alloc = allocator_type() )
+    : _block ( (sizeof(T) < block_bytes) ? block_bytes / sizeof(T) : 1 )
+    , _cap ( _block * ((memory / (_block * sizeof(T)) < 2) ? 2 : memory / (_block * sizeof(T))) )
+    , _ring ( _cap, value_type(), alloc )
+    , _first ( 0 )
+    , _next ( 0 )
+    , _hot ( 0 )
+    , _spilled ( 0 )
+    , _fd ( -1 )
+    , _prefetching ( false )
+  {
+    if (directory == nullptr)
+      directory = std::getenv("TMPDIR");
+    std::string path = std::string(directory ? directory : "/tmp") + "/ft_external_stack.XXXXXX";
+    _fd = mkstemp(&path[0]);
+    if (_fd < 0)
+      throw (std::runtime_error("external_stack : cannot create " + path));
+    unlink(path.c_str());
+  }
+  ~external_stack ( )
+  {
+    if (_prefetching)
+      pthread_join(_thread, nullptr);
+    close(_fd);
+  }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type spilled ( ) const;
+  bool empty ( void ) const { return (_hot == 0); }
+  size_type size ( void ) const { return (_spilled * _block + _hot); }
+  size_type spilled ( void ) const { return (_spilled * _block); } // Elements in the file.
+
+  // [*] // reference top ( );
+  // [*] // const_reference top ( ) const;
+  reference top ( void ) { return (_ring[(_next == 0 ? _cap : _next) - 1]); }
+  const_reference top ( void ) const { return (_ring[(_next == 0 ? _cap : _next) - 1]); }
+
+  // [*] // void push ( const value_type& val );
+  void push ( const value_type& val )
+  {
+    if (_hot >= _cap - _block)
+      _makeRoom();
+    _ring[_next] = val;
+    if (++_next == _cap)
+      _next = 0;
+    ++_hot;
+  }
+  // [*] // void pop ( );
+  void pop ( void )
+  {
+    _next = (_next == 0 ? _cap : _next) - 1;
+    --_hot;
+    if (_hot <= _block && _spilled != 0) {
+      if (_hot == 0)
+        _reload();
+      else if (!_prefetching)
+        _prefetch();
+    }
+  }
+
+private:
+  size_type _below ( void ) const { return ((_first == 0 ? _cap : _first) - _block); } // The slot the next reload fills.
+  off_t _offset ( size_type block ) const { return (off_t(block) * off_t(_block * sizeof(T))); }
+  char * _bytes ( size_type slot ) { return (reinterpret_cast<char *>(&_ring[slot])); }
+
+  static bool _transfer ( bool out, int fd, char * buffer, size_type bytes, off_t offset )
+  {
+    while (bytes) {
+      ssize_t done = out ? pwrite(fd, buffer, bytes, offset) : pread(fd, buffer, bytes, offset);
+      if (done < 0 && errno == EINTR)
+        continue;
+      if (done <= 0)
+        return (false);
+      buffer += done;
+      offset += done;
+      bytes -= done;
+    }
+    return (true);
+  }
+  static void * _run ( void * arg )
+  {
+    Read * job = static_cast<Read *>(arg);
+    job->_ok = _transfer(false, job->_fd, job->_buffer, job->_bytes, job->_offset);
+    return (nullptr);
+  }
+
+  void _makeRoom ( void ) // The next push lands in the slot a prefetch may be filling.
+  {
+    if (_prefetching) {
+      pthread_join(_thread, nullptr);
+      _prefetching = false;
+    }
+    if (_hot == _cap) {
+      if (!_transfer(true, _fd, _bytes(_first), _block * sizeof(T), _offset(_spilled)))
+        throw (std::runtime_error("external_stack : write failed"));
+      ++_spilled;
+      _first = (_first + _block == _cap) ? 0 : _first + _block;
+      _hot -= _block;
+    }
+  }
+  void _prefetch ( void )
+  {
+    _read._fd = _fd;
+    _read._buffer = _bytes(_below());
+    _read._bytes = _block * sizeof(T);
+    _read._offset = _offset(_spilled - 1);
+    _read._ok = false;
+    _prefetching = (pthread_create(&_thread, nullptr, &_run, &_read) == 0); // Or read it in _reload().
+  }
+  void _reload ( void ) // The window is empty: bring back the last block of the file.
+  {
+    size_type slot = _below();
+    bool ok;
+    if (_prefetching) {
+      pthread_join(_thread, nullptr);
+      _prefetching = false;
+      ok = _read._ok;
+    } else
+      ok = _transfer(false, _fd, _bytes(slot), _block * sizeof(T), _offset(_spilled - 1));
+    if (!ok)
+      throw (std::runtime_error("external_stack : read failed"));
+    --_spilled;
+    _first = slot;
+    _hot = _block;
+  }
+};
+}
+
+#endif
@@ -0,0 +1,229 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_MAP_HPP
+#define FROZEN_MAP_HPP
+
+#include "Iterators/iterator_eytzinger.hpp"
+#include "Iterators/iterator_vector.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "utils.hpp"
+#include <stdexcept>
+
+namespace ft
+{
+// An immutable ordered map, usually made by map::freeze(). The keys sit in a
+// dense array in Eytzinger order, so a search only reads keys; the elements
+// sit in a parallel array, and iteration walks both in key order.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class frozen_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::iterator_eytzinger<const value_type>      iterator;
+  typedef ft::iterator_eytzinger<const value_type>      const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+private:
+  typedef typename allocator_type::template rebind<key_type>::other allocator_key_type;
+
+private:
+  key_compare         _comp;
+  allocator_type      _alloc;
+  allocator_key_type  _alloc_key;
+  key_type            * _keys;   // Slot 0 is never constructed.
+  value_type          * _values;
+  size_type           _size;
+
+public:
+  // [*] // explicit frozen_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class ForwardIterator > frozen_map ( ForwardIterator first, ForwardIterator last, ... );
+  // [*] // frozen_map ( const frozen_map& x );
+  // [*] // frozen_map& operator=( const frozen_map& other );
+  // [*] // ~frozen_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit frozen_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _alloc_key ( alloc )
+    , _keys ( nullptr )
+    , _values ( nullptr )
+    , _size ( 0 )
+  { }
+  template < class ForwardIterator >
+  frozen_map ( ForwardIterator first, ForwardIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) // Strictly increasing keys.
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _alloc_key ( alloc )
+    , _keys ( nullptr )
+    , _values ( nullptr )
+    , _size ( 0 )
+  { _assign(first, ft::distance(first, last)); }
+  frozen_map ( const frozen_map& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _alloc_key ( x._alloc_key )
+    , _keys ( nullptr )
+    , _values ( nullptr )
+    , _size ( 0 )
+  { _assign(x.begin(), x._size); }
+  frozen_map& operator=( const frozen_map& x )
+  {
+    if (this != &x) {
+      frozen_map tmp(x);
+      swap(tmp);
+    }
+    return (*this);
+  }
+  ~frozen_map ( ) { _destroy(_size); }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // const mapped_type& at (const key_type& k) const;
+  const mapped_type& at (const key_type& k) const
+  {
+    const_iterator it = find(k);
+    if (it == end())
+      throw (std::out_of_range("frozen_map::at : key not found"));
+    return (it->second);
+  }
+
+  // [*] // const_iterator begin ( ) const;
+  // [*] // const_iterator end ( ) const;
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // const_reverse_iterator rend ( ) const;
+  const_iterator begin ( ) const { return (const_iterator(_values, _size, ft::eytzinger::first(_size))); }
+  const_iterator end ( ) const { return (const_iterator(_values, _size, 0)); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(end())); }
+  const_reverse_iterator rend ( ) const { return (const_reverse_iterator(begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (_size == 0); }
+  size_type size ( ) const { return (_size); }
+  size_type max_size ( ) const { return (_alloc.max_size() - 1); }
+
+  // [*] // void swap ( frozen_map& x );
+  void swap ( frozen_map& x )
+  {
+    key_type * keys_tmp = _keys;
+    value_type * values_tmp = _values;
+    size_type size_tmp = _size;
+    _keys = x._keys;
+    _values = x._values;
+    _size = x._size;
+    x._keys = keys_tmp;
+    x._values = values_tmp;
+    x._size = size_tmp;
+  }
+
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  const_iterator find (const key_type& k) const
+  {
+    size_type i = ft::eytzinger::lower_bound(_keys, _size, k, _comp);
+    if (i && _comp(k, _keys[i]))
+      i = 0;
+    return (const_iterator(_values, _size, i));
+  }
+  size_type count( const key_type& k ) const
+  {
+    return ((find(k) == end()) ? 0 : 1);
+  }
+  const_iterator lower_bound (const key_type& k) const
+  {
+    return (const_iterator(_values, _size, ft::eytzinger::lower_bound(_keys, _size, k, _comp)));
+  }
+  const_iterator upper_bound (const key_type& k) const
+  {
+    return (const_iterator(_values, _size, ft::eytzinger::upper_bound(_keys, _size, k, _comp)));
+  }
+  ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+private:
+  // Fills the slots in key order, which visits the implicit tree in order.
+  template < class InputIterator >
+  void _assign ( InputIterator first, size_type n )
+  {
+    size_type built = 0;
+    size_type i;
+
+    if (n == 0) return ;
+    _keys = _alloc_key.allocate(n + 1);
+    _size = n;
+    try {
+      _values = _alloc.allocate(n + 1);
+      for (i = ft::eytzinger::first(n); built < n; i = ft::eytzinger::next(i, n), ++first) {
+        _alloc_key.construct(_keys + i, (*first).first);
+        try {
+          _alloc.construct(_values + i, *first);
+        } catch (...) {
+          _alloc_key.destroy(_keys + i);
+          throw ;
+        }
+        ++built;
+      }
+    } catch (...) {
+      _destroy(built);
+      throw ;
+    }
+  }
+  void _destroy ( size_type built ) // The first built slots in key order, then the arrays.
+  {
+    size_type i = ft::eytzinger::first(_size);
+    for (; built; --built, i = ft::eytzinger::next(i, _size)) {
+      _alloc_key.destroy(_keys + i);
+      _alloc.destroy(_values + i);
+    }
+    if (_values) _alloc.deallocate(_values, _size + 1);
+    if (_keys) _alloc_key.deallocate(_keys, _size + 1);
+    _keys = nullptr;
+    _values = nullptr;
+    _size = 0;
+  }
+};
+
+template< class Key, class T, class Compare, class Alloc >
+void swap (frozen_map<Key,T,Compare,Alloc>& x, frozen_map<Key,T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+}
+
+#endif
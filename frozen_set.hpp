@@ -0,0 +1,198 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_set.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_SET_HPP
+#define FROZEN_SET_HPP
+
+#include "Iterators/iterator_eytzinger.hpp"
+#include "Iterators/iterator_vector.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "utils.hpp"
+
+namespace ft
+{
+// An immutable ordered set, usually made by set::freeze(): the keys in one
+// dense array in Eytzinger order.
+template
+<
+class T,
+class Compare = std::less<T>,
+class Alloc = std::allocator<T>
+>
+class frozen_set {
+public:
+  typedef T                                             key_type;
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  typedef Compare                                       value_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::iterator_eytzinger<const value_type>      iterator;
+  typedef ft::iterator_eytzinger<const value_type>      const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+private:
+  key_compare     _comp;
+  allocator_type  _alloc;
+  value_type      * _keys; // Slot 0 is never constructed.
+  size_type       _size;
+
+public:
+  // [*] // explicit frozen_set ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class ForwardIterator > frozen_set ( ForwardIterator first, ForwardIterator last, ... );
+  // [*] // frozen_set ( const frozen_set& x );
+  // [*] // frozen_set& operator=( const frozen_set& other );
+  // [*] // ~frozen_set ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit frozen_set ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _keys ( nullptr )
+    , _size ( 0 )
+  { }
+  template < class ForwardIterator >
+  frozen_set ( ForwardIterator first, ForwardIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) // Strictly increasing keys.
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _keys ( nullptr )
+    , _size ( 0 )
+  { _assign(first, ft::distance(first, last)); }
+  frozen_set ( const frozen_set& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _keys ( nullptr )
+    , _size ( 0 )
+  { _assign(x.begin(), x._size); }
+  frozen_set& operator=( const frozen_set& x )
+  {
+    if (this != &x) {
+      frozen_set tmp(x);
+      swap(tmp);
+    }
+    return (*this);
+  }
+  ~frozen_set ( ) { _destroy(_size); }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] // value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // const_iterator begin ( ) const;
+  // [*] // const_iterator end ( ) const;
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // const_reverse_iterator rend ( ) const;
+  const_iterator begin ( ) const { return (const_iterator(_keys, _size, ft::eytzinger::first(_size))); }
+  const_iterator end ( ) const { return (const_iterator(_keys, _size, 0)); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(end())); }
+  const_reverse_iterator rend ( ) const { return (const_reverse_iterator(begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (_size == 0); }
+  size_type size ( ) const { return (_size); }
+  size_type max_size ( ) const { return (_alloc.max_size() - 1); }
+
+  // [*] // void swap ( frozen_set& x );
+  void swap ( frozen_set& x )
+  {
+    value_type * keys_tmp = _keys;
+    size_type size_tmp = _size;
+    _keys = x._keys;
+    _size = x._size;
+    x._keys = keys_tmp;
+    x._size = size_tmp;
+  }
+
+  // [*] // const_iterator find (const value_type& val) const;
+  // [*] // size_type count( const value_type& val ) const;
+  // [*] // const_iterator lower_bound (const value_type& val) const;
+  // [*] // const_iterator upper_bound (const value_type& val) const;
+  // [*] // pair<const_iterator,const_iterator> equal_range (const value_type& val) const;
+  const_iterator find (const value_type& val) const
+  {
+    size_type i = ft::eytzinger::lower_bound(_keys, _size, val, _comp);
+    if (i && _comp(val, _keys[i]))
+      i = 0;
+    return (const_iterator(_keys, _size, i));
+  }
+  size_type count( const value_type& val ) const
+  {
+    return ((find(val) == end()) ? 0 : 1);
+  }
+  const_iterator lower_bound (const value_type& val) const
+  {
+    return (const_iterator(_keys, _size, ft::eytzinger::lower_bound(_keys, _size, val, _comp)));
+  }
+  const_iterator upper_bound (const value_type& val) const
+  {
+    return (const_iterator(_keys, _size, ft::eytzinger::upper_bound(_keys, _size, val, _comp)));
+  }
+  ft::pair<const_iterator,const_iterator> equal_range (const value_type& val) const
+  {
+    return (ft::make_pair(lower_bound(val), upper_bound(val)));
+  }
+
+private:
+  // Fills the slots in key order, which visits the implicit tree in order.
+  template < class InputIterator >
+  void _assign ( InputIterator first, size_type n )
+  {
+    size_type built = 0;
+    size_type i;
+
+    if (n == 0) return ;
+    _keys = _alloc.allocate(n + 1);
+    _size = n;
+    try {
+      for (i = ft::eytzinger::first(n); built < n; i = ft::eytzinger::next(i, n), ++first) {
+        _alloc.construct(_keys + i, *first);
+        ++built;
+      }
+    } catch (...) {
+      _destroy(built);
+      throw ;
+    }
+  }
+  void _destroy ( size_type built ) // The first built slots in key order, then the array.
+  {
+    size_type i = ft::eytzinger::first(_size);
+    for (; built; --built, i = ft::eytzinger::next(i, _size))
+      _alloc.destroy(_keys + i);
+    if (_keys) _alloc.deallocate(_keys, _size + 1);
+    _keys = nullptr;
+    _size = 0;
+  }
+};
+
+template< class T, class Compare, class Alloc >
+void swap (frozen_set<T,Compare,Alloc>& x, frozen_set<T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+}
+
+#endif
@@ -0,0 +1,309 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP
+
+#include "utils.hpp"
+#include "utilities/hash_group.hpp"
+#include <cstring>
+
+namespace ft
+{
+// An open-addressing hash table in the style of Swiss tables. The values sit
+// in one flat array of slots, followed by one control byte per slot. A probe
+// compares the 7 low bits of the hash against a group of 16 control bytes at
+// once, so it rarely looks at a value whose key does not match, and stops at
+// the first group that has an empty slot.
+// The capacity is a power of two minus one. The first 15 control bytes are
+// repeated after the sentinel, so a group can start at any slot.
+// An erased slot becomes a tombstone unless no probe can have gone past it;
+// tombstones are dropped when the table runs out of room.
+// The container provides key_of(value).
+template < typename Container >
+class HashTable {
+  // ---------------- Typedefs ----------------
+public:
+  typedef typename Container::key_type             key_type;
+  typedef typename Container::value_type           value_type;
+  typedef typename Container::hasher               hasher;
+  typedef typename Container::key_equal            key_equal;
+
+  typedef typename Container::allocator_type                     allocator_type;
+  typedef typename allocator_type::template rebind<char>::other  allocator_block_type;
+
+  typedef typename allocator_type::size_type            size_type;
+
+  static const int _width = hash_group::width;
+
+  // ---------------- Attributes ----------------
+private:
+  hasher                _hash;
+  key_equal             _eq;
+  allocator_type        & _alloc;
+  allocator_block_type  _alloc_block;
+  hash_ctrl             * _ctrl;
+  value_type            * _slots;
+  size_type             _capacity;
+  size_type             _size;
+  size_type             _growthLeft; // Empty slots that may still be filled before growing.
+
+  // ---------------- Constructor ----------------
+public:
+  explicit HashTable
+  ( const hasher & hash, const key_equal & eq, allocator_type & alloc )
+    : _hash(hash)
+    , _eq(eq)
+    , _alloc(alloc)
+    , _alloc_block(alloc)
+    , _ctrl(hash_empty_group())
+    , _slots(nullptr)
+    , _capacity(0)
+    , _size(0)
+    , _growthLeft(0)
+  { }
+
+  // ---------------- Copy Constructor ----------------
+public:
+  HashTable ( const HashTable & copy, allocator_type & alloc )
+    : _hash(copy._hash)
+    , _eq(copy._eq)
+    , _alloc(alloc)
+    , _alloc_block(alloc)
+    , _ctrl(hash_empty_group())
+    , _slots(nullptr)
+    , _capacity(0)
+    , _size(0)
+    , _growthLeft(0)
+  {
+    reserve(copy._size);
+    try {
+      for (size_type i = 0; i < copy._capacity; ++i)
+        if (copy._ctrl[i] >= 0)
+          _place(copy._slots[i], _hash(Container::key_of(copy._slots[i])));
+    } catch (...) {
+      _free();
+      throw ;
+    }
+  }
+
+  // ---------------- Copy Assignment Operator ----------------
+public:
+  HashTable &operator=( const HashTable & copy )
+  {
+    HashTable tmp(copy, _alloc);
+    swap(tmp);
+    return (*this);
+  }
+
+  // ---------------- Destructor ----------------
+public:
+  ~HashTable () { _free(); }
+
+  // ---------------- Accessors ----------------
+public:
+  hash_ctrl * ctrl ( void ) const { return (_ctrl); }
+  value_type * slots ( void ) const { return (_slots); }
+  size_type capacity ( void ) const { return (_capacity); }
+  size_type size ( void ) const { return (_size); }
+  const hasher & hash_function ( void ) const { return (_hash); }
+  const key_equal & key_eq ( void ) const { return (_eq); }
+
+  // ---------------- Clear / Swap ----------------
+public:
+  void clear ( void ) // Keeps the capacity.
+  {
+    if (_capacity == 0) return ;
+    _destroyAll();
+    _resetCtrl();
+    _size = 0;
+    _growthLeft = _growth(_capacity);
+  }
+  void swap ( HashTable & x )
+  {
+    _swap(_hash, x._hash);
+    _swap(_eq, x._eq);
+    _swap(_ctrl, x._ctrl);
+    _swap(_slots, x._slots);
+    _swap(_capacity, x._capacity);
+    _swap(_size, x._size);
+    _swap(_growthLeft, x._growthLeft);
+  }
+
+  // ---------------- Capacity ----------------
+public:
+  void reserve ( size_type n ) // Room for n values without growing.
+  {
+    if (n > _size + _growthLeft)
+      rehash(n + n / 7);
+  }
+  void rehash ( size_type n ) // At least n slots, and enough for the values; drops the tombstones.
+  {
+    if (n < _size + _size / 7)
+      n = _size + _size / 7;
+    if (n == 0) {
+      if (_size == 0) {
+        _free();
+        _ctrl = hash_empty_group();
+        _slots = nullptr;
+        _capacity = 0;
+        _growthLeft = 0;
+      }
+      return ;
+    }
+    size_type capacity = _width - 1;
+    while (capacity < n)
+      capacity = capacity * 2 + 1;
+    _resize(capacity);
+  }
+
+  // ---------------- Search ----------------
+public:
+  size_type find ( const key_type & k ) const // The slot of k, or capacity() when it is missing.
+  {
+    size_t hash = _hash(k);
+    size_type offset = _h1(hash) & _capacity;
+    size_type step = 0;
+    while (true) {
+      hash_group group(_ctrl + offset);
+      for (unsigned match = group.match(_h2(hash)); match; match &= match - 1) {
+        size_type i = (offset + __builtin_ctz(match)) & _capacity;
+        if (_eq(Container::key_of(_slots[i]), k))
+          return (i);
+      }
+      if (group.match_empty())
+        return (_capacity);
+      step += _width;
+      offset = (offset + step) & _capacity;
+    }
+  }
+
+  // ---------------- Insertion ----------------
+public:
+  ft::pair<size_type, bool> insert ( const value_type & val )
+  {
+    const key_type & k = Container::key_of(val);
+    size_type i = find(k);
+    if (i != _capacity)
+      return (ft::make_pair(i, false));
+    return (ft::make_pair(_place(val, _hash(k)), true));
+  }
+
+  // ---------------- Deletion ----------------
+public:
+  size_type erase ( const key_type & k )
+  {
+    size_type i = find(k);
+    if (i == _capacity)
+      return (0);
+    erase_at(i);
+    return (1);
+  }
+  // The slot can be empty again if some group around it always had an empty
+  // slot: then no probe ever went on past it.
+  void erase_at ( size_type i )
+  {
+    _alloc.destroy(_slots + i);
+    --_size;
+    unsigned emptyAfter = hash_group(_ctrl + i).match_empty();
+    unsigned emptyBefore = hash_group(_ctrl + ((i - _width) & _capacity)).match_empty();
+    if (emptyBefore && emptyAfter
+      && __builtin_ctz(emptyAfter) + (__builtin_clz(emptyBefore) - 16) < _width) {
+      _setCtrl(i, hash_ctrl_empty);
+      ++_growthLeft;
+    } else {
+      _setCtrl(i, hash_ctrl_deleted);
+    }
+  }
+
+  // ---------------- Slots ----------------
+private:
+  template < class T >
+  static void _swap ( T & a, T & b ) { T tmp = a; a = b; b = tmp; }
+  static size_t _h1 ( size_t hash ) { return (hash >> 7); }
+  static hash_ctrl _h2 ( size_t hash ) { return (hash_ctrl(hash & 0x7f)); }
+  static size_type _growth ( size_type capacity ) { return (capacity - capacity / 8); } // A load factor of 7/8.
+  static size_type _bytes ( size_type capacity ) { return (capacity * sizeof(value_type) + capacity + _width); }
+
+  size_type _findFree ( size_t hash ) const // The first empty or deleted slot on the probe path.
+  {
+    size_type offset = _h1(hash) & _capacity;
+    size_type step = 0;
+    while (true) {
+      unsigned match = hash_group(_ctrl + offset).match_empty_or_deleted();
+      if (match)
+        return ((offset + __builtin_ctz(match)) & _capacity);
+      step += _width;
+      offset = (offset + step) & _capacity;
+    }
+  }
+  size_type _place ( const value_type & val, size_t hash ) // The key is known to be missing.
+  {
+    size_type i = _findFree(hash);
+    if (_growthLeft == 0 && _ctrl[i] != hash_ctrl_deleted) {
+      // Out of room: drop the tombstones when they take a good share of it, or double.
+      if (_capacity == 0)
+        _resize(_width - 1);
+      else
+        _resize((_size * 32 <= _capacity * 25) ? _capacity : _capacity * 2 + 1);
+      i = _findFree(hash);
+    }
+    _alloc.construct(_slots + i, val);
+    if (_ctrl[i] == hash_ctrl_empty)
+      --_growthLeft;
+    _setCtrl(i, _h2(hash));
+    ++_size;
+    return (i);
+  }
+  void _setCtrl ( size_type i, hash_ctrl c )
+  {
+    _ctrl[i] = c;
+    if (i < size_type(_width - 1))
+      _ctrl[_capacity + 1 + i] = c;
+  }
+  void _resetCtrl ( void )
+  {
+    std::memset(_ctrl, hash_ctrl_empty, _capacity + _width);
+    _ctrl[_capacity] = hash_ctrl_sentinel;
+  }
+  void _destroyAll ( void )
+  {
+    for (size_type i = 0; i < _capacity; ++i)
+      if (_ctrl[i] >= 0)
+        _alloc.destroy(_slots + i);
+  }
+  void _free ( void )
+  {
+    if (_capacity == 0) return ;
+    _destroyAll();
+    _alloc_block.deallocate(reinterpret_cast<char *>(_slots), _bytes(_capacity));
+  }
+  // Copies every value into a new block; the old one is freed only once
+  // all the copies succeeded.
+  void _resize ( size_type capacity )
+  {
+    HashTable next(_hash, _eq, _alloc);
+    char * block = _alloc_block.allocate(_bytes(capacity));
+    next._slots = reinterpret_cast<value_type *>(block);
+    next._ctrl = reinterpret_cast<hash_ctrl *>(block + capacity * sizeof(value_type));
+    next._capacity = capacity;
+    next._resetCtrl();
+    next._growthLeft = _growth(capacity);
+    for (size_type i = 0; i < _capacity; ++i)
+      if (_ctrl[i] >= 0)
+        next._place(_slots[i], _hash(Container::key_of(_slots[i])));
+    swap(next);
+  }
+};
+}
+
+#endif
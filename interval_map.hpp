@@ -0,0 +1,297 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interval_map.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INTERVAL_MAP_HPP
+#define INTERVAL_MAP_HPP
+
+#include "Iterators/iterator_tree.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "red_black_tree.hpp"
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// An ordered map keyed by half-open intervals [first, second), sorted by their
+// start then their end. Every node also keeps the largest end of its subtree,
+// which lets overlap queries skip whole subtrees.
+// The point comparator is default constructed by the augmentation, so it must
+// not carry state.
+template
+<
+class Point,
+class T,
+class Compare = std::less<Point>,
+class Alloc = std::allocator< ft::pair<const ft::pair<Point, Point>, T> >
+>
+class interval_map {
+public:
+  typedef Point                                         point_type;
+  typedef ft::pair<Point, Point>                        key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       point_compare;
+  struct                                                key_compare;
+  struct                                                value_compare;
+  struct                                                max_end;
+  typedef ft::monoid_augment<max_end>                   policy_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+private:
+  typedef typename RedBlackTree<interval_map>::Node Node;
+public:
+  typedef ft::iterator_tree<value_type, Node>            iterator;
+  typedef ft::iterator_tree<const value_type, Node>      const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+public:
+  struct key_compare {
+  public:
+    typedef bool result_type;
+
+    point_compare comp;
+    key_compare (point_compare c = point_compare()) : comp(c) {}
+
+    result_type operator() (const key_type& x, const key_type& y) const {
+      return (comp(x.first, y.first) || (!comp(y.first, x.first) && comp(x.second, y.second)));
+    }
+  };
+  struct value_compare {
+  public:
+    typedef bool result_type;
+
+    key_compare comp;
+    value_compare (key_compare c) : comp(c) {}
+
+    result_type operator() (const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+    result_type operator() (const key_type& x, const key_type& y) const {
+      return comp(x, y);
+    }
+    result_type operator() (const value_type& x, const key_type& y) const {
+      return comp(x.first, y);
+    }
+    result_type operator() (const key_type& x, const value_type& y) const {
+      return comp(x, y.first);
+    }
+  };
+  struct max_end { // The interval of the subtree that ends last.
+    typedef const point_type * data_type;
+
+    static data_type identity ( ) { return (nullptr); }
+    static data_type lift ( const value_type & value ) { return (&value.first.second); }
+    static data_type combine ( const data_type & lhs, const data_type & rhs )
+    {
+      if (lhs == nullptr) return (rhs);
+      if (rhs == nullptr) return (lhs);
+      return ((point_compare()(*lhs, *rhs)) ? rhs : lhs);
+    }
+  };
+
+private:
+  key_compare                  _comp;
+  allocator_type               _alloc;
+  RedBlackTree< interval_map > _tree;
+
+public:
+  // [*] // explicit interval_map ( const point_compare& comp = point_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > interval_map ( InputIterator first, InputIterator last, ... );
+  // [*] // interval_map ( const interval_map& x );
+  // [*] // interval_map& operator=( const interval_map& other );
+  // [*] // ~interval_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit interval_map ( const point_compare& comp = point_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  interval_map ( InputIterator first, InputIterator last, const point_compare& comp = point_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    while (first != last)
+      insert(*(first++));
+  }
+  interval_map ( const interval_map& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree )
+  { }
+  interval_map& operator=( const interval_map& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~interval_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] // value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // iterator begin ( );
+  // [*] // const_iterator begin ( ) const;
+  // [*] // iterator end ( );
+  // [*] // const_iterator end ( ) const;
+  //
+  // [*] // reverse_iterator rbegin ( );
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // reverse_iterator rend ( );
+  // [*] // const_reverse_iterator rend ( ) const;
+  iterator       begin ( )       { return (iterator(_tree.base(), _tree.smallest())); }
+  const_iterator begin ( ) const { return (const_iterator(_tree.base(), _tree.smallest())); }
+  iterator       end ( )         { return (iterator(_tree.base(), nullptr)); }
+  const_iterator end ( ) const   { return (const_iterator(_tree.base(), nullptr)); }
+
+  reverse_iterator       rbegin ( )       { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  reverse_iterator       rend ( )         { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    iterator it = find(val.first);
+    if ( it != end() )
+      return (ft::make_pair<iterator,bool>(it, false));
+    it = iterator(_tree.base(), _tree.add(val));
+    return (ft::make_pair<iterator,bool>(it, true));
+  }
+  iterator insert ( iterator position, const value_type& val )
+  {
+    (void)position;
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(*(first++));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  { return (_tree._erase(k)); }
+  void erase ( iterator position ) // Unlinks the node itself, no search.
+  { _tree.erase(position.base()); }
+  void erase ( iterator first, iterator last )
+  {
+    while (first != last) {
+      _tree.erase((first++).base());
+    }
+  }
+
+  // [*] // void swap ( interval_map& x );
+  // [*] // void clear ( );
+  void swap ( interval_map& x )
+  { _tree.swap(x._tree); }
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  iterator find (const key_type& k)
+  {
+    return (iterator(_tree.base(), _tree.find(k)));
+  }
+  const_iterator find (const key_type& k) const
+  {
+    return (const_iterator(_tree.base(), _tree.find(k)));
+  }
+  size_type count( const key_type& k ) const
+  {
+    return ((_tree.find(k)) ? 1 : 0);
+  }
+
+  // [*] // bool overlaps ( const point_type& lo, const point_type& hi ) const;
+  // [*] // template < class OutputIterator > OutputIterator overlapping ( const point_type& lo, const point_type& hi, OutputIterator out );
+  // Intervals [first, second) with first < hi and lo < second. Reporting k
+  // of them costs O(min(n, (k + 1) log n)): each reported interval may cost a
+  // descent through subtrees that end after lo but hold nothing before hi.
+  bool overlaps ( const point_type& lo, const point_type& hi ) const // O(log n)
+  {
+    Node * node = *_tree.base();
+    while (node && !_overlap(node, lo, hi)) {
+      const point_type * end = policy_type::get(node->_left);
+      if (end && _comp.comp(lo, *end))
+        node = node->_left; // If nothing overlaps on the left, nothing on the right can either.
+      else
+        node = node->_right;
+    }
+    return (node != nullptr);
+  }
+  template < class OutputIterator >
+  OutputIterator overlapping ( const point_type& lo, const point_type& hi, OutputIterator out ) // Writes iterators, in order.
+  { return (_overlapping<iterator>(*_tree.base(), lo, hi, out)); }
+  template < class OutputIterator >
+  OutputIterator overlapping ( const point_type& lo, const point_type& hi, OutputIterator out ) const
+  { return (_overlapping<const_iterator>(*_tree.base(), lo, hi, out)); }
+
+private:
+  bool _overlap ( const Node * node, const point_type& lo, const point_type& hi ) const
+  { return (_comp.comp(node->_value->first.first, hi) && _comp.comp(lo, node->_value->first.second)); }
+
+  // Only descends into subtrees that end after lo, and stops at the first
+  // interval that starts at or after hi.
+  template < class Iterator, class OutputIterator >
+  OutputIterator _overlapping ( Node * node, const point_type& lo, const point_type& hi, OutputIterator out ) const
+  {
+    while (node) {
+      const point_type * end = policy_type::get(node);
+      if (end == nullptr || !_comp.comp(lo, *end))
+        break;
+      out = _overlapping<Iterator>(node->_left, lo, hi, out);
+      if (!_comp.comp(node->_value->first.first, hi))
+        break;
+      if (_comp.comp(lo, node->_value->first.second))
+        *out++ = Iterator(_tree.base(), node);
+      node = node->_right;
+    }
+    return (out);
+  }
+};
+
+template< class Point, class T, class Compare, class Alloc >
+void swap (interval_map<Point,T,Compare,Alloc>& x, interval_map<Point,T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+}
+
+#endif
@@ -0,0 +1,309 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multiset.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTISET_HPP
+#define MULTISET_HPP
+
+#include "Iterators/iterator_tree.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "red_black_tree.hpp"
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// An ordered set that keeps equal values, in insertion order. Same tree as
+// ft::set: with ft::subtree_size as the Policy, count() is O(log n).
+template
+<
+class T,
+class Compare = std::less<T>,
+class Alloc = std::allocator<T>,
+class Policy = ft::no_augment
+>
+class multiset {
+public:
+  typedef T                                             key_type;
+  typedef T                                             mapped_type;
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  typedef Compare                                       value_compare;
+  typedef Policy                                        policy_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+private:
+  typedef typename RedBlackTree<multiset>::Node Node;
+public:
+  typedef ft::iterator_tree<const value_type, Node>     iterator;
+  typedef ft::iterator_tree<const value_type, Node>     const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+private:
+  key_compare              _comp;
+  allocator_type           _alloc;
+  RedBlackTree< multiset > _tree;
+
+public:
+  // [*] // explicit multiset ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > multiset ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // multiset ( const multiset& x );
+  // [*] // multiset& operator=( const multiset& other );
+  // [*] // ~multiset ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit multiset ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  multiset ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    while (first != last)
+      insert(end(), *(first++));
+  }
+  multiset ( const multiset& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree )
+  { }
+  multiset& operator=( const multiset& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~multiset ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] // value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // iterator begin ( );
+  // [*] // const_iterator begin ( ) const;
+  // [*] // iterator end ( );
+  // [*] // const_iterator end ( ) const;
+  //
+  // [*] // reverse_iterator rbegin ( );
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // reverse_iterator rend ( );
+  // [*] // const_reverse_iterator rend ( ) const;
+  iterator       begin ( )       { return (iterator(_tree.base(), _tree.smallest())); }
+  const_iterator begin ( ) const { return (const_iterator(_tree.base(), _tree.smallest())); }
+  iterator       end ( )         { return (iterator(_tree.base(), nullptr)); }
+  const_iterator end ( ) const   { return (const_iterator(_tree.base(), nullptr)); }
+
+  reverse_iterator       rbegin ( )       { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  reverse_iterator       rend ( )         { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // iterator insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  iterator insert ( const value_type& val ) // After the elements with the same key.
+  { return (iterator(_tree.base(), _tree.add(val))); }
+  iterator insert ( iterator position, const value_type& val ) // As close as possible before position.
+  {
+    Node * after = position.base();
+    Node * before = (after) ? _predecessor(after) : _tree.largest();
+    if (after && _comp(*after->_value, val)) // too early, the closest place is before the equal keys
+      after = _lower_bound(val);
+    else if (before && _comp(val, *before->_value)) // too late, after them
+      after = _upper_bound(val);
+    return (iterator(_tree.base(), _tree.add(val, after)));
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(end(), *(first++));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  {
+    size_type erased = 0;
+    iterator first = lower_bound(k);
+    iterator last = upper_bound(k);
+    while (first != last) {
+      erase(first++);
+      ++erased;
+    }
+    return (erased);
+  }
+  void erase ( iterator position )
+  { _tree.erase(position.base()); }
+  void erase ( iterator first, iterator last )
+  {
+    while (first != last)
+      erase(first++);
+  }
+
+  // [*] // void swap ( multiset& x );
+  void swap ( multiset& x )
+  { _tree.swap(x._tree); }
+
+  // [*] // void clear ( );
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  iterator find (const key_type& k) // The first element with the key.
+  {
+    iterator it = lower_bound(k);
+    if (it != end() && _comp(k, *it))
+      return (end());
+    return (it);
+  }
+  const_iterator find (const key_type& k) const
+  {
+    const_iterator it = lower_bound(k);
+    if (it != end() && _comp(k, *it))
+      return (end());
+    return (it);
+  }
+  size_type count( const key_type& k ) const
+  {
+    return (ft::distance(lower_bound(k), upper_bound(k)));
+  }
+
+  // [*] // iterator lower_bound (const key_type& k);
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // iterator upper_bound (const key_type& k);
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  iterator lower_bound (const key_type& k)
+  { return (iterator(_tree.base(), _lower_bound(k))); }
+  const_iterator lower_bound (const key_type& k) const
+  { return (const_iterator(_tree.base(), _lower_bound(k))); }
+  iterator upper_bound (const key_type& k)
+  { return (iterator(_tree.base(), _upper_bound(k))); }
+  const_iterator upper_bound (const key_type& k) const
+  { return (const_iterator(_tree.base(), _upper_bound(k))); }
+
+  // [*] // pair<iterator,iterator>             equal_range (const key_type& k);
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  pair<iterator,iterator> equal_range (const key_type& k)
+  { return (ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
+  pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  { return (ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+private:
+  Node * _lower_bound (const key_type& k) const
+  {
+    Node * node = *_tree.base();
+    Node * bound = nullptr;
+    while (node) {
+      if (_comp(*node->_value, k)) {
+        node = node->_right;
+      } else {
+        bound = node; node = node->_left;
+      }
+    }
+    return (bound);
+  }
+  Node * _upper_bound (const key_type& k) const
+  {
+    Node * node = *_tree.base();
+    Node * bound = nullptr;
+    while (node) {
+      if (_comp(k, *node->_value)) {
+        bound = node; node = node->_left;
+      } else {
+        node = node->_right;
+      }
+    }
+    return (bound);
+  }
+  static Node * _predecessor ( Node * node )
+  {
+    if (node->_left) {
+      node = node->_left;
+      while (node->_right) node = node->_right;
+      return (node);
+    }
+    while (node->_parent && node->_isRight == false)
+      node = node->_parent;
+    return (node->_parent);
+  }
+};
+
+template< class T, class Compare, class Alloc, class Policy >
+void swap (multiset<T,Compare,Alloc,Policy>& x, multiset<T,Compare,Alloc,Policy>& y)
+{
+  x.swap(y);
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator==( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator!=( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator<( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator>( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator<=( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class T, class Compare, class Alloc, class Policy >
+bool operator>=( const ft::multiset<T,Compare,Alloc,Policy>& lhs, const ft::multiset<T,Compare,Alloc,Policy>& rhs )
+{
+  return (!(lhs < rhs));
+}
+}
+
+#endif
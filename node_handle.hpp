@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_HANDLE_HPP
+#define NODE_HANDLE_HPP
+
+#include "red_black_tree.hpp"
+
+namespace ft
+{
+// Owns a node extracted from an ft::map or ft::set, value included, until it
+// is inserted again or the handle is destroyed. Without move semantics,
+// copies transfer the ownership like std::auto_ptr: the source ends up empty.
+template < class Node >
+class node_handle {
+public:
+  typedef typename Node::value_type     value_type;
+  typedef typename Node::mapped_type    mapped_type;
+  typedef typename Node::allocator_type allocator_type;
+
+private:
+  typedef typename Node::allocator_node_type allocator_node_type;
+
+  mutable Node   * _node;
+  allocator_type _alloc;
+
+public:
+  node_handle ( ) : _node(nullptr), _alloc() { }
+  node_handle ( Node * node, const allocator_type & alloc ) : _node(node), _alloc(alloc) { }
+  node_handle ( const node_handle & x ) : _node(x.release()), _alloc(x._alloc) { }
+  node_handle & operator= ( const node_handle & x )
+  {
+    if (this != &x) {
+      _clear();
+      _alloc = x._alloc;
+      _node = x.release();
+    }
+    return (*this);
+  }
+  ~node_handle ( ) { _clear(); }
+
+  bool empty ( ) const { return (_node == nullptr); }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+  value_type & value ( ) const { return (*_node->_value); }
+  mapped_type & mapped ( ) const { return (_node->_value->second); } // ft::map only
+
+  void swap ( node_handle & x )
+  {
+    Node * node = _node;
+    _node = x._node;
+    x._node = node;
+    allocator_type alloc = _alloc;
+    _alloc = x._alloc;
+    x._alloc = alloc;
+  }
+  Node * release ( ) const // Gives the node up, for the containers.
+  {
+    Node * node = _node;
+    _node = nullptr;
+    return (node);
+  }
+
+private:
+  void _clear ( void )
+  {
+    if (_node == nullptr) return ;
+    allocator_node_type alloc_node(_alloc);
+    remove_node<Node>(_alloc, alloc_node, _node);
+    _node = nullptr;
+  }
+};
+
+template < class Node >
+void swap ( node_handle<Node> & x, node_handle<Node> & y )
+{
+  x.swap(y);
+}
+}
+
+#endif
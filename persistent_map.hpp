@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_MAP_HPP
+#define PERSISTENT_MAP_HPP
+
+#include "Iterators/iterator_persistent.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "persistent_tree.hpp"
+#include <stdexcept>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// An ordered map whose copies are O(1) snapshots: versions share their nodes,
+// and an update copies only the O(log n) shared nodes on its path.
+// Elements are read-only, as they may belong to several versions; change a
+// value with assign().
+// A snapshot can be read, copied and destroyed in another thread while the
+// original keeps changing: the node counts are atomic. Taking the snapshot
+// itself must not race with an update of the map it is taken from.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class persistent_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  struct                                                value_compare;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+private:
+  typedef ft::PersistentTree<persistent_map>            tree_type;
+  typedef typename tree_type::Node                      Node;
+public:
+  typedef ft::iterator_persistent<const value_type, tree_type> iterator;
+  typedef ft::iterator_persistent<const value_type, tree_type> const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+public:
+  struct value_compare {
+  public:
+    typedef bool result_type;
+
+    Compare comp;
+    value_compare (Compare c) : comp(c) {}
+
+    result_type operator() (const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+    result_type operator() (const key_type& x, const key_type& y) const {
+      return comp(x, y);
+    }
+    result_type operator() (const value_type& x, const key_type& y) const {
+      return comp(x.first, y);
+    }
+    result_type operator() (const key_type& x, const value_type& y) const {
+      return comp(x, y.first);
+    }
+  };
+
+private:
+  key_compare     _comp;
+  allocator_type  _alloc;
+  tree_type       _tree;
+
+public:
+  // [*] // explicit persistent_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > persistent_map ( InputIterator first, InputIterator last, ... );
+  // [*] // persistent_map ( const persistent_map& x );
+  // [*] // persistent_map& operator=( const persistent_map& other );
+  // [*] // ~persistent_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit persistent_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  persistent_map ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    while (first != last)
+      insert(*(first++));
+  }
+  persistent_map ( const persistent_map& x ) // O(1), same as snapshot().
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree, _alloc )
+  { }
+  persistent_map& operator=( const persistent_map& x ) // O(1).
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~persistent_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // persistent_map snapshot ( ) const;
+  persistent_map snapshot ( ) const { return (*this); }
+
+  // [*] // key_compare key_comp() const
+  // [*] // value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // const mapped_type& at (const key_type& k) const;
+  const mapped_type& at (const key_type& k) const
+  {
+    Node * findNode = _tree.find(k);
+    if ( findNode )
+      return (findNode->_value->second);
+    else
+      throw (std::out_of_range("persistent_map::at : key not found"));
+  }
+
+  // [*] // const_iterator begin ( ) const;
+  // [*] // const_iterator end ( ) const;
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // const_reverse_iterator rend ( ) const;
+  const_iterator begin ( ) const { return (const_iterator(&_tree, _tree.smallest())); }
+  const_iterator end ( ) const   { return (const_iterator(&_tree, nullptr)); }
+
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  // [*] // iterator assign ( const key_type& k, const mapped_type& v );
+  // Each update copies O(log n) nodes when the map shares them with a snapshot.
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    ft::pair<Node *, bool> result = _tree.insert(val);
+    return (ft::make_pair<iterator,bool>(iterator(&_tree, result.first), result.second));
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(*(first++));
+  }
+  iterator assign ( const key_type& k, const mapped_type& v ) // Insert or overwrite.
+  {
+    return (iterator(&_tree, _tree.assign(ft::make_pair<const key_type, mapped_type>(k, v))));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  size_type erase ( const key_type& k )
+  { return (_tree.erase(k)); }
+  void erase ( iterator position )
+  { _tree.erase(position->first); }
+
+  // [*] // void swap ( persistent_map& x );
+  // [*] // void clear ( );
+  void swap ( persistent_map& x )
+  { _tree.swap(x._tree); }
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  const_iterator find (const key_type& k) const
+  {
+    return (const_iterator(&_tree, _tree.find(k)));
+  }
+  size_type count( const key_type& k ) const
+  {
+    return ((_tree.find(k)) ? 1 : 0);
+  }
+  const_iterator lower_bound (const key_type& k) const
+  {
+    return (const_iterator(&_tree, _tree.lower_bound(k)));
+  }
+  const_iterator upper_bound (const key_type& k) const
+  {
+    return (const_iterator(&_tree, _tree.upper_bound(k)));
+  }
+  ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+};
+
+template< class Key, class T, class Compare, class Alloc >
+void swap (persistent_map<Key,T,Compare,Alloc>& x, persistent_map<Key,T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+}
+
+#endif
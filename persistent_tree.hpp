@@ -0,0 +1,537 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_tree.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_TREE_HPP
+#define PERSISTENT_TREE_HPP
+
+#include "utils.hpp"
+
+namespace ft
+{
+// A red-black tree whose versions share their nodes. Nodes have no parent
+// pointer and count their owners (parents and versions); an update copies the
+// nodes on its path that are shared and changes the others in place, so a
+// version never sees a change made through another one.
+// Insertion and deletion follow Kahrs' functional red-black trees.
+// Copies of a node share its value, and an update first reserves all the nodes
+// it may copy, so once it starts changing links nothing can throw.
+template < typename Container >
+class PersistentTree {
+  // ---------------- Typedefs ----------------
+public:
+  struct Node;
+
+  typedef typename Container::key_type             key_type;
+  typedef typename Container::mapped_type          mapped_type;
+  typedef typename Container::value_type           value_type;
+
+  typedef typename Container::value_compare                      value_compare;
+  typedef typename Container::allocator_type                     allocator_type;
+  typedef typename allocator_type::template rebind<Node>::other  allocator_node_type;
+
+  typedef typename allocator_type::size_type            size_type;
+private:
+  struct Box { // A value shared by the copies of a node.
+    value_type  value; // First, so a node's _value is its box.
+    long        refs;
+  };
+  typedef typename allocator_type::template rebind<Box>::other   allocator_box_type;
+
+  // ---------------- Attributes ----------------
+private:
+  value_compare       _comp;
+  allocator_type      & _alloc;
+  allocator_node_type _alloc_node;
+  allocator_box_type  _alloc_box;
+  Node                *_root;
+  size_type           _size;
+  Node                *_spare;  // Reserved nodes, linked through _left.
+  size_type           _spares;
+
+  // ---------------- Constructor ----------------
+public:
+  explicit PersistentTree
+  ( value_compare comp, allocator_type & alloc )
+    : _comp(comp)
+    , _alloc(alloc)
+    , _alloc_node(alloc)
+    , _alloc_box(alloc)
+    , _root(nullptr)
+    , _size(0)
+    , _spare(nullptr)
+    , _spares(0)
+  { }
+
+  // ---------------- Copy Constructor ----------------
+  // O(1): both trees share every node until one of them changes.
+public:
+  PersistentTree ( const PersistentTree & copy, allocator_type & alloc )
+    : _comp(copy._comp)
+    , _alloc(alloc)
+    , _alloc_node(copy._alloc_node)
+    , _alloc_box(copy._alloc_box)
+    , _root(_retain(copy._root))
+    , _size(copy._size)
+    , _spare(nullptr)
+    , _spares(0)
+  { }
+
+  // ---------------- Copy Assignment Operator ----------------
+public:
+  PersistentTree &operator=( const PersistentTree & copy )
+  {
+    Node * old = _root;
+    _root = _retain(copy._root);
+    _size = copy._size;
+    _release(old);
+    return (*this);
+  }
+
+  // ---------------- Destructor ----------------
+public:
+  ~PersistentTree ()
+  {
+    _release(_root);
+    while (_spare) {
+      Node * node = _spare;
+      _spare = node->_left;
+      _alloc_node.deallocate(node, 1);
+    }
+  }
+
+  // ---------------- Accessors ----------------
+public:
+  Node *const * base ( void ) const { return (&_root); }
+  size_type size ( void ) const { return (_size); }
+  Node * smallest ( void ) const
+  {
+    Node * small = _root;
+    while (small && small->_left)
+      small = small->_left;
+    return (small);
+  }
+  Node * largest ( void ) const
+  {
+    Node * large = _root;
+    while (large && large->_right)
+      large = large->_right;
+    return (large);
+  }
+
+  // ---------------- Clear / Swap ----------------
+public:
+  void clear ( void )
+  {
+    _release(_root);
+    _root = nullptr;
+    _size = 0;
+  }
+  void swap ( PersistentTree & x )
+  {
+    Node * root_tmp = _root;
+    size_type size_tmp = _size;
+    _root = x._root;
+    _size = x._size;
+    x._root = root_tmp;
+    x._size = size_tmp;
+  }
+
+  // ---------------- Search ----------------
+  // Without parent pointers, stepping to a neighbour searches from the root.
+public:
+  Node * find ( const key_type & k ) const
+  {
+    Node * node = _root;
+    while (node) {
+      if (_comp(k, *node->_value))       node = node->_left;
+      else if (_comp(*node->_value, k))  node = node->_right;
+      else return (node);
+    }
+    return (nullptr);
+  }
+  Node * lower_bound ( const key_type & k ) const // First node not less than k.
+  {
+    Node * node = _root, * result = nullptr;
+    while (node) {
+      if (_comp(*node->_value, k)) {
+        node = node->_right;
+      } else {
+        result = node;
+        node = node->_left;
+      }
+    }
+    return (result);
+  }
+  Node * upper_bound ( const key_type & k ) const // First node greater than k.
+  {
+    Node * node = _root, * result = nullptr;
+    while (node) {
+      if (_comp(k, *node->_value)) {
+        result = node;
+        node = node->_left;
+      } else {
+        node = node->_right;
+      }
+    }
+    return (result);
+  }
+  Node * next ( const Node * node ) const { return (upper_bound(node->_value->first)); }
+  Node * prev ( const Node * node ) const
+  {
+    Node * p = _root, * result = nullptr;
+    while (p) {
+      if (_comp(*p->_value, *node->_value)) {
+        result = p;
+        p = p->_right;
+      } else {
+        p = p->_left;
+      }
+    }
+    return (result);
+  }
+
+  // ---------------- Insertion ----------------
+  // O(log n) new nodes at most. The node holding val comes back either way.
+public:
+  ft::pair<Node *, bool> insert ( const value_type & val )
+  {
+    Node * node = find(val.first);
+    if (node)
+      return (ft::make_pair(node, false));
+    _reserve(3 * _heightBound() + 3); // First: a spare left over is no leak, a box would be.
+    value_type * value = _makeValue(val);
+    _root = _blacken(_ins(_root, value, node));
+    ++_size;
+    return (ft::make_pair(node, true));
+  }
+  Node * assign ( const value_type & val ) // Inserts val, or replaces the mapped value of its key.
+  {
+    Node * node = find(val.first);
+    if (node == nullptr)
+      return (insert(val).first);
+    _reserve(_heightBound());
+    value_type * value = _makeValue(val);
+    _root = _set(_root, value, node);
+    return (node);
+  }
+
+  // ---------------- Deletion ----------------
+public:
+  size_type erase ( const key_type & k )
+  {
+    if (find(k) == nullptr)
+      return (0);
+    _reserve(14 * _heightBound() + 1);
+    _root = _blacken(_del(_root, k));
+    --_size;
+    return (1);
+  }
+
+  // ---------------- Ownership ----------------
+private:
+  static Node * _retain ( Node * node )
+  {
+    if (node) ft::atomic_fetch_add(&node->_refs, long(1));
+    return (node);
+  }
+  void _release ( Node * node ) // Frees the node with its last owner, and so on down.
+  {
+    while (node && ft::atomic_fetch_add(&node->_refs, long(-1)) == 1) {
+      Node * right = node->_right;
+      _release(node->_left);
+      _releaseValue(node->_value);
+      _alloc_node.deallocate(node, 1);
+      node = right;
+    }
+  }
+  value_type * _makeValue ( const value_type & val )
+  {
+    Box * box = _alloc_box.allocate(1);
+    try {
+      _alloc.construct(&box->value, val);
+    } catch (...) {
+      _alloc_box.deallocate(box, 1);
+      throw ;
+    }
+    box->refs = 1;
+    return (&box->value);
+  }
+  void _releaseValue ( value_type * value )
+  {
+    Box * box = reinterpret_cast<Box *>(value);
+    if (ft::atomic_fetch_add(&box->refs, long(-1)) == 1) {
+      _alloc.destroy(&box->value);
+      _alloc_box.deallocate(box, 1);
+    }
+  }
+  // Every update copies at most a few nodes per level: insertion 3, and
+  // deletion 6 on the way down plus 8 while joining the deleted node's
+  // subtrees. The height is at most twice the black height.
+  size_type _heightBound ( void ) const
+  {
+    size_type blacks = 0;
+    for (Node * node = _root; node; node = node->_left)
+      if (node->_isRed == false) ++blacks;
+    return (2 * blacks + 1);
+  }
+  void _reserve ( size_type n )
+  {
+    while (_spares < n) {
+      Node * node = _alloc_node.allocate(1);
+      node->_left = _spare;
+      _spare = node;
+      ++_spares;
+    }
+  }
+  Node * _make ( value_type * value, Node * left, Node * right, bool isRed ) // Takes over value, left and right.
+  {
+    Node * node = _spare;
+    if (node) {
+      _spare = node->_left;
+      --_spares;
+    } else {
+      node = _alloc_node.allocate(1);
+    }
+    node->_value = value;
+    node->_left = left;
+    node->_right = right;
+    node->_isRed = isRed;
+    node->_refs = 1;
+    return (node);
+  }
+  // Gives an owned node that nobody else can see, copying it when it is
+  // shared. Its children are owned by it either way.
+  Node * _unique ( Node * node )
+  {
+    if (ft::atomic_load(&node->_refs) == 1)
+      return (node);
+    Node * copy = _make(node->_value, node->_left, node->_right, node->_isRed);
+    ft::atomic_fetch_add(&reinterpret_cast<Box *>(copy->_value)->refs, long(1));
+    _retain(copy->_left);
+    _retain(copy->_right);
+    _release(node);
+    return (copy);
+  }
+  Node * _blacken ( Node * node )
+  {
+    if (node && node->_isRed) {
+      node = _unique(node);
+      node->_isRed = false;
+    }
+    return (node);
+  }
+  static bool _red ( const Node * node ) { return (node && node->_isRed); }
+
+  // ---------------- Insertion Helpers ----------------
+  // Every helper takes owned nodes and gives back an owned subtree.
+private:
+  Node * _ins ( Node * node, value_type * value, Node *& inserted )
+  {
+    if (node == nullptr)
+      return (inserted = _make(value, nullptr, nullptr, true));
+    node = _unique(node);
+    if (_comp(*value, *node->_value))
+      node->_left = _ins(node->_left, value, inserted);
+    else
+      node->_right = _ins(node->_right, value, inserted);
+    return ((node->_isRed) ? node : _balance(node));
+  }
+  Node * _set ( Node * node, value_type * value, Node *& target )
+  {
+    node = _unique(node);
+    if (_comp(*value, *node->_value))      node->_left = _set(node->_left, value, target);
+    else if (_comp(*node->_value, *value)) node->_right = _set(node->_right, value, target);
+    else {
+      _releaseValue(node->_value);
+      node->_value = value;
+      target = node;
+    }
+    return (node);
+  }
+  // Turns a black node with a red child and a red grandchild in line into a
+  // red node with two black children; otherwise the node ends up black.
+  Node * _balance ( Node * node )
+  {
+    Node * top;
+    if (_red(node->_left) && _red(node->_right)) {
+      node->_left = _unique(node->_left);
+      node->_right = _unique(node->_right);
+      node->_left->_isRed = false;
+      node->_right->_isRed = false;
+      node->_isRed = true;
+      return (node);
+    }
+    if (_red(node->_left) && (_red(node->_left->_left) || _red(node->_left->_right))) {
+      Node * left = _unique(node->_left);
+      if (_red(left->_left)) {
+        top = left;
+        left = _unique(left->_left);
+        node->_left = top->_right;
+      } else {
+        top = _unique(left->_right);
+        left->_right = top->_left;
+        node->_left = top->_right;
+      }
+      top->_left = left;
+      top->_right = node;
+    } else if (_red(node->_right) && (_red(node->_right->_right) || _red(node->_right->_left))) {
+      Node * right = _unique(node->_right);
+      if (_red(right->_right)) {
+        top = right;
+        right = _unique(right->_right);
+        node->_right = top->_left;
+      } else {
+        top = _unique(right->_left);
+        right->_left = top->_right;
+        node->_right = top->_left;
+      }
+      top->_left = node;
+      top->_right = right;
+    } else {
+      node->_isRed = false;
+      return (node);
+    }
+    top->_isRed = true;
+    top->_left->_isRed = false;
+    top->_right->_isRed = false;
+    return (top);
+  }
+
+  // ---------------- Deletion Helpers ----------------
+private:
+  Node * _del ( Node * node, const key_type & k )
+  {
+    if (node == nullptr) return (nullptr);
+    if (_comp(k, *node->_value)) {
+      node = _unique(node);
+      bool black = node->_left && !node->_left->_isRed;
+      node->_left = _del(node->_left, k);
+      if (black) return (_balleft(node));
+      node->_isRed = true;
+      return (node);
+    }
+    if (_comp(*node->_value, k)) {
+      node = _unique(node);
+      bool black = node->_right && !node->_right->_isRed;
+      node->_right = _del(node->_right, k);
+      if (black) return (_balright(node));
+      node->_isRed = true;
+      return (node);
+    }
+    Node * left = _retain(node->_left);
+    Node * right = _retain(node->_right);
+    _release(node);
+    return (_app(left, right));
+  }
+  // The left side of node lost one black level.
+  Node * _balleft ( Node * node )
+  {
+    if (_red(node->_left)) {
+      node->_left = _unique(node->_left);
+      node->_left->_isRed = false;
+      node->_isRed = true;
+      return (node);
+    }
+    if (node->_right && !node->_right->_isRed) {
+      node->_right = _unique(node->_right);
+      node->_right->_isRed = true;
+      return (_balance(node));
+    }
+    Node * right = _unique(node->_right);      // red, with a black left child
+    Node * top = _unique(right->_left);
+    node->_right = top->_left;
+    node->_isRed = false;
+    right->_left = top->_right;
+    right->_right = _sub1(right->_right);
+    top->_left = node;
+    top->_right = _balance(right);
+    top->_isRed = true;
+    return (top);
+  }
+  Node * _balright ( Node * node )
+  {
+    if (_red(node->_right)) {
+      node->_right = _unique(node->_right);
+      node->_right->_isRed = false;
+      node->_isRed = true;
+      return (node);
+    }
+    if (node->_left && !node->_left->_isRed) {
+      node->_left = _unique(node->_left);
+      node->_left->_isRed = true;
+      return (_balance(node));
+    }
+    Node * left = _unique(node->_left);        // red, with a black right child
+    Node * top = _unique(left->_right);
+    node->_left = top->_right;
+    node->_isRed = false;
+    left->_right = top->_left;
+    left->_left = _sub1(left->_left);
+    top->_left = _balance(left);
+    top->_right = node;
+    top->_isRed = true;
+    return (top);
+  }
+  Node * _sub1 ( Node * node ) // Black to red.
+  {
+    node = _unique(node);
+    node->_isRed = true;
+    return (node);
+  }
+  // Joins the two subtrees of a deleted node.
+  Node * _app ( Node * left, Node * right )
+  {
+    if (left == nullptr) return (right);
+    if (right == nullptr) return (left);
+    if (left->_isRed != right->_isRed) {
+      if (right->_isRed) {
+        right = _unique(right);
+        right->_left = _app(left, right->_left);
+        return (right);
+      }
+      left = _unique(left);
+      left->_right = _app(left->_right, right);
+      return (left);
+    }
+    left = _unique(left);
+    right = _unique(right);
+    Node * middle = _app(left->_right, right->_left);
+    if (_red(middle)) {
+      middle = _unique(middle);
+      left->_right = middle->_left;
+      right->_left = middle->_right;
+      middle->_left = left;
+      middle->_right = right;
+      return (middle);
+    }
+    right->_left = middle;
+    if (left->_isRed) {
+      left->_right = right;
+      return (left);
+    }
+    left->_right = right;
+    return (_balleft(left));
+  }
+
+  // ---------------- Node Class ----------------
+public:
+  struct Node {
+    value_type  * _value;
+    Node        * _left;
+    Node        * _right;
+    bool        _isRed;
+    long        _refs; // Parents and versions pointing here.
+  };
+};
+}
+
+#endif
@@ -14,6 +14,7 @@
 #define RED_BLACK_TREE_MAP_HPP
 
 #include "utils.hpp"
+#include "tree_policies.hpp"
 
 namespace ft
 {
@@ -37,6 +38,7 @@ Node * make_node (typename Node::allocator_type & _alloc, typename Node::allocat
     newNode->_left = make_node(_alloc, _alloc_node, node->_left);
     newNode->_left->_parent = newNode;
   }
+  Node::policy_type::update(newNode); // The copied augmentation may refer to the old values.
   return (newNode);
 }
 
@@ -49,11 +51,68 @@ Node * make_node (typename Node::allocator_type & _alloc, typename Node::allocat
   Node * newNode;
   newNode = _alloc_node.allocate(size_node_type(1));
   _alloc_node.construct(newNode, Node());
-  newNode->_value = _alloc.allocate(size_type(1));
-  _alloc.construct(newNode->_value, val);
+  newNode->_value = nullptr;
+  try {
+    newNode->_value = _alloc.allocate(size_type(1));
+    _alloc.construct(newNode->_value, val);
+  } catch (...) {
+    if (newNode->_value) _alloc.deallocate(newNode->_value, size_type(1));
+    _alloc_node.destroy(newNode);
+    _alloc_node.deallocate(newNode, size_node_type(1));
+    throw ;
+  }
   return (newNode);
 }
 
+// One block of nodes laid out by compact(), each next to its value. The block
+// is freed with its last node, whichever tree or node handle that ends up in.
+template < class Node >
+struct tree_arena {
+  typedef typename Node::allocator_node_type  allocator_node_type;
+  typedef typename Node::size_type            size_type;
+
+  struct Slot {
+    Node                      node; // First, so a packed node is its slot.
+    typename Node::value_type value;
+    tree_arena                * arena;
+  };
+  typedef typename allocator_node_type::template rebind<Slot>::other        allocator_slot_type;
+  typedef typename allocator_node_type::template rebind<tree_arena>::other  allocator_arena_type;
+
+  Slot      * slots;
+  size_type capacity;
+  size_type live;
+
+  static tree_arena * create ( allocator_node_type & _alloc_node, size_type n )
+  {
+    allocator_arena_type alloc_arena(_alloc_node);
+    allocator_slot_type alloc_slot(_alloc_node);
+    tree_arena * arena = alloc_arena.allocate(1);
+    try {
+      arena->slots = alloc_slot.allocate(n);
+    } catch (...) {
+      alloc_arena.deallocate(arena, 1);
+      throw ;
+    }
+    arena->capacity = n;
+    arena->live = 0;
+    return (arena);
+  }
+  static void release ( allocator_node_type & _alloc_node, Node * node )
+  {
+    tree_arena * arena = reinterpret_cast<Slot *>(node)->arena;
+    if (--arena->live == 0)
+      destroy(_alloc_node, arena);
+  }
+  static void destroy ( allocator_node_type & _alloc_node, tree_arena * arena ) // Once its nodes are gone.
+  {
+    allocator_arena_type alloc_arena(_alloc_node);
+    allocator_slot_type alloc_slot(_alloc_node);
+    alloc_slot.deallocate(arena->slots, arena->capacity);
+    alloc_arena.deallocate(arena, 1);
+  }
+};
+
 template < class Node >
 void remove_node (typename Node::allocator_type & _alloc, typename Node::allocator_node_type & _alloc_node, Node * node)
 {
@@ -62,13 +121,18 @@ void remove_node (typename Node::allocator_type & _alloc, typename Node::allocat
 
   if (node == nullptr) return ;
   _alloc.destroy(node->_value);
-  _alloc.deallocate(node->_value, size_type(1));
+  if (!node->_isPacked)
+    _alloc.deallocate(node->_value, size_type(1));
   if (node->_right)
     remove_node(_alloc, _alloc_node, node->_right);
   if (node->_left)
     remove_node(_alloc, _alloc_node, node->_left);
+  bool isPacked = node->_isPacked;
   _alloc_node.destroy(node);
-  _alloc_node.deallocate(node, size_node_type(1));
+  if (isPacked)
+    tree_arena<Node>::release(_alloc_node, node);
+  else
+    _alloc_node.deallocate(node, size_node_type(1));
 }
 
 template < typename Container >
@@ -84,6 +148,11 @@ public:
   typedef typename Container::value_compare                      value_compare;
   typedef typename Container::allocator_type                     allocator_type;
   typedef typename allocator_type::template rebind<Node>::other  allocator_node_type;
+  typedef ft::key_prefix<typename Container::key_compare, key_type> key_prefix_type;
+  typedef typename Container::policy_type                        policy_type;
+  typedef ft::tree_links<Node, policy_type::threads>             links_type;
+  typedef ft::tree_filter<Node, key_type, allocator_type, policy_type::filters> filter_type;
+  typedef ft::tree_store<Node, policy_type::publishes>           store_type;
 
   typedef typename allocator_type::size_type            size_type;
   typedef typename allocator_node_type::size_type       size_node_type;
@@ -94,7 +163,10 @@ private:
   allocator_type      & _alloc;
   allocator_node_type _alloc_node;
   Node                *_root;
-  size_type           _size;
+  mutable size_type   _size; // _unknown after a split without counts, until size() walks the tree.
+  filter_type         _filter;
+
+  static const size_type _unknown = size_type(-1);
 
   // ---------------- Constructor ----------------
 public:
@@ -105,6 +177,7 @@ public:
     , _alloc_node(alloc)
     , _root(nullptr)
     , _size(size_type())
+    , _filter(alloc)
   { }
 
   // ---------------- Copy Constructor ----------------
@@ -115,15 +188,18 @@ public:
     , _alloc_node(copy._alloc_node)
     , _root(make_node<Node>(_alloc, _alloc_node, copy._root))
     , _size(copy._size)
-  { }
+    , _filter(copy._filter)
+  { links_type::rethread(_root); }
 
   // ---------------- Copy Assignment Operator ----------------
 public:
   RedBlackTree &operator=( const RedBlackTree & copy )
   {
     remove_node(_alloc, _alloc_node, _root);
-    _root = make_node<Node>(_alloc, _alloc_node, copy._root);
+    store_type::set(_root, make_node<Node>(_alloc, _alloc_node, copy._root));
     _size = copy._size;
+    _filter = copy._filter;
+    links_type::rethread(_root);
     return (*this);
   }
 
@@ -133,7 +209,7 @@ public:
   {
     if (_root != nullptr) {
       remove_node<Node>( _alloc, _alloc_node, _root );
-      _root = nullptr;
+      store_type::set(_root, nullptr);
     }
   }
   // ---------------- Base ----------------
@@ -149,29 +225,52 @@ public:
       small = small->_left;
     return (small);
   }
+  Node * largest ( void ) const
+  {
+    Node * large = _root;
+    while (large && large->_right)
+      large = large->_right;
+    return (large);
+  }
   // ---------------- Size ----------------
 public:
   size_type size ( void ) const
-  { return (_size); }
+  {
+    if (_size == _unknown)
+      _size = _count(_root);
+    return (_size);
+  }
 
   // ---------------- Clear ----------------
 public:
   void clear ( void )
   {
     remove_node( _alloc, _alloc_node, _root );
-    _root = nullptr;
+    store_type::set(_root, nullptr);
+    _size = 0;
+    _filter.clear();
+  }
+  Node * release ( void ) // Hands the nodes over to the caller, who frees them.
+  {
+    Node * root = _root;
+    store_type::set(_root, nullptr);
     _size = 0;
+    _filter.clear();
+    return (root);
   }
 
   // ---------------- Find ----------------
 public:
   Node * find ( const key_type & k ) const
   {
+    if (!_filter.may_contain(k)) return (nullptr);
+    key_prefix_type probe(k);
     Node * node = _root;
     while (node) {
-      if (_comp(k , *node->_value)) {
+      int order = key_prefix_type::compare(probe, *node);
+      if (order < 0 || (order == 0 && _comp(k , *node->_value))) {
         node = node->_left;
-      } else if (_comp(*node->_value, k)) {
+      } else if (order > 0 || _comp(*node->_value, k)) {
         node = node->_right;
       } else {
         return (node);
@@ -180,6 +279,45 @@ public:
     return (nullptr);
   }
 
+  // ---------------- Refresh ----------------
+  // Call it after changing a value that the policy depends on.
+public:
+  void refresh ( Node * node ) { _updatePath(node); }
+
+  // ---------------- Order Statistics ----------------
+  // Only usable with a policy that counts the nodes of each subtree.
+public:
+  size_type rank ( const key_type & k ) const // The number of elements less than k.
+  {
+    key_prefix_type probe(k);
+    size_type before = 0;
+    Node * node = _root;
+    while (node) {
+      int order = key_prefix_type::compare(*node, probe);
+      if (order < 0 || (order == 0 && _comp(*node->_value, k))) {
+        before += policy_type::count(node->_left) + 1;
+        node = node->_right;
+      } else {
+        node = node->_left;
+      }
+    }
+    return (before);
+  }
+  Node * select ( size_type i ) const // The i-th smallest element, nullptr when i >= size.
+  {
+    Node * node = _root;
+    while (node) {
+      size_type left = policy_type::count(node->_left);
+      if (i < left) {
+        node = node->_left;
+      } else if (i > left) {
+        i -= left + 1;
+        node = node->_right;
+      } else break;
+    }
+    return (node);
+  }
+
   // ---------------- Swap ----------------
 public:
   void swap ( RedBlackTree & x )
@@ -187,45 +325,501 @@ public:
     size_type size_tmp = _size;
     Node * root_tmp = _root;
     _size = x._size;
-    _root = x._root;
+    store_type::set(_root, x._root);
     x._size = size_tmp;
-    x._root = root_tmp;
+    store_type::set(x._root, root_tmp);
+    _filter.swap(x._filter);
+  }
+
+  // ---------------- Split / Join ----------------
+  // Join-based: a join costs O(1) plus the difference of the black heights,
+  // which adds up to O(log n) for a whole split. Only pointers move.
+public:
+  void split ( const key_type & k, RedBlackTree & x ) // Moves the elements not less than k into x, dropping its content.
+  {
+    key_prefix_type probe(k);
+    Node * less, * equal = nullptr, * rest;
+    int hless, hrest;
+
+    x.clear();
+    _split(_root, _blackHeight(_root), probe, k, less, hless, equal, rest, hrest);
+    if (equal)
+      rest = _join(nullptr, 0, equal, rest, hrest, hrest);
+    store_type::set(_root, _asRoot(less));
+    store_type::set(x._root, _asRoot(rest));
+    if (policy_type::threads) {
+      links_type::chain(largest(), nullptr);
+      links_type::chain(nullptr, x.smallest());
+    }
+    _size = policy_count<policy_type::counts>::template get<policy_type>(_root, _unknown);
+    x._size = policy_count<policy_type::counts>::template get<policy_type>(x._root, _unknown);
+    _filter.rebuild(_root);
+    x._filter.rebuild(x._root);
+  }
+  void join ( RedBlackTree & x ) // Appends x, whose elements must all be greater than ours, and leaves it empty.
+  {
+    if (x._root == nullptr) return ;
+    if (policy_type::threads)
+      links_type::chain(largest(), x.smallest());
+    if (_root != nullptr) {
+      Node * last;
+      int hleft, h;
+      Node * left = _splitLast(_root, _blackHeight(_root), last, hleft);
+      store_type::set(_root, _asRoot(_join(left, hleft, last, x._root, _blackHeight(x._root), h)));
+    } else {
+      store_type::set(_root, x._root);
+    }
+    _size = (_size == _unknown || x._size == _unknown) ? _unknown : _size + x._size;
+    store_type::set(x._root, nullptr);
+    x._size = 0;
+    _filter.rebuild(_root);
+    x._filter.clear();
+  }
+  void join ( const value_type & pivot, RedBlackTree & x ) // Same with a new element between the two trees.
+  {
+    Node * node = make_node<Node>(_alloc, _alloc_node, pivot);
+    int h;
+
+    node->load(pivot);
+    if (policy_type::threads) {
+      links_type::chain(largest(), node);
+      links_type::chain(node, x.smallest());
+    }
+    store_type::set(_root, _asRoot(_join(_root, _blackHeight(_root), node, x._root, _blackHeight(x._root), h)));
+    _size = (_size == _unknown || x._size == _unknown) ? _unknown : _size + x._size + 1;
+    store_type::set(x._root, nullptr);
+    x._size = 0;
+    _filter.rebuild(_root);
+    x._filter.clear();
+  }
+
+  // Moves in the elements of x whose key is not here yet; x keeps the others.
+  // Join-based union: O(m log(n / m + 1)) for m elements in the smaller tree.
+  void merge ( RedBlackTree & x )
+  {
+    _NodeList kept;
+    int h;
+
+    if (&x == this) return ; // Every key is here already.
+    store_type::set(_root, _asRoot(_union(_root, _blackHeight(_root), x._root, _blackHeight(x._root), kept, h)));
+    if (_size != _unknown && x._size != _unknown)
+      _size += x._size - kept.size;
+    else
+      _size = _unknown;
+    store_type::set(x._root, _asRoot(x._build(kept, kept.size, 0, _fullLevels(kept.size))));
+    x._size = kept.size;
+    links_type::rethread(_root);
+    links_type::rethread(x._root);
+    _filter.rebuild(_root);
+    x._filter.rebuild(x._root);
+  }
+
+  // ---------------- Bulk Build ----------------
+public:
+  template < class InputIterator >
+  void build ( InputIterator first, size_type n ) // Replaces the content with n strictly increasing values, in O(n).
+  {                                                // If a copy throws, the content is unchanged.
+    _ValueSource< InputIterator > source(*this, first);
+    Node * root = _build(source, n, 0, _fullLevels(n));
+
+    clear();
+    store_type::set(_root, _asRoot(root));
+    _size = n;
+    links_type::rethread(_root);
+    _filter.rebuild(_root);
+  }
+private:
+  template < class InputIterator >
+  struct _ValueSource {
+    RedBlackTree  & tree;
+    InputIterator it;
+
+    _ValueSource ( RedBlackTree & t, InputIterator first ) : tree(t), it(first) { }
+    Node * next ( void )
+    {
+      Node * node = make_node<Node>(tree._alloc, tree._alloc_node, *it);
+      node->load(*it);
+      ++it;
+      return (node);
+    }
+  };
+  struct _NodeList { // Detached nodes in order, linked through _right.
+    Node      * head;
+    Node      * tail;
+    size_type size;
+
+    _NodeList ( ) : head(nullptr), tail(nullptr), size(0) { }
+    void push ( Node * node )
+    {
+      node->_right = nullptr;
+      if (tail) tail->_right = node;
+      else      head = node;
+      tail = node;
+      ++size;
+    }
+    Node * next ( void )
+    {
+      Node * node = head;
+      head = head->_right;
+      return (node);
+    }
+  };
+  // A middle split keeps every leaf on the last two levels, so painting the
+  // incomplete last level red gives every path the same black height.
+  template < class Source >
+  Node * _build ( Source & source, size_type n, int depth, int redDepth )
+  {
+    if (n == 0) return (nullptr);
+    size_type nleft = (n - 1) / 2;
+    Node * left = _build(source, nleft, depth + 1, redDepth);
+    Node * node = nullptr;
+    Node * right;
+    try { // Only a _ValueSource throws, and its nodes have no children yet.
+      node = source.next();
+      right = _build(source, n - 1 - nleft, depth + 1, redDepth);
+    } catch (...) {
+      remove_node(_alloc, _alloc_node, left);
+      remove_node(_alloc, _alloc_node, node);
+      throw ;
+    }
+    node->_parent = nullptr;
+    _attach(node, left, false);
+    _attach(node, right, true);
+    node->_isRed = (depth == redDepth);
+    _update ( node );
+    return (node);
+  }
+  static int _fullLevels ( size_type n )
+  {
+    int levels = 0;
+    while ((size_type(2) << levels) - 1 <= n) ++levels;
+    return (levels);
+  }
+
+  // ---------------- Compact ----------------
+  // Rebalances the tree, then copies every node next to its value into one
+  // tree_arena, in van Emde Boas order: the top half of the levels first, then
+  // each subtree under it the same way, so a search from the root touches
+  // O(log_B n) blocks whatever the block size. The old nodes are freed and
+  // iterators are invalidated; the tree stays fully mutable. If copying a
+  // value throws, the content is unchanged.
+public:
+  void compact ( void )
+  {
+    typedef tree_arena<Node>                                      arena_type;
+    typedef typename allocator_type::template rebind<Node *>::other allocator_order_type;
+
+    size_type n = size();
+    if (n == 0) return ;
+    _NodeList nodes;
+    _collect(_root, nodes);
+    store_type::set(_root, _asRoot(_build(nodes, n, 0, _fullLevels(n))));
+
+    allocator_order_type alloc_order(_alloc_node);
+    Node ** order = alloc_order.allocate(n);
+    size_type pos = 0, built = 0;
+    int height = 0;
+    for (Node * node = _root; node; node = node->_right) ++height; // The right side is never the smaller one.
+    _vebOrder(_root, height, order, pos);
+
+    arena_type * arena = nullptr;
+    try {
+      arena = arena_type::create(_alloc_node, n);
+      for (; built < n; ++built)
+        _alloc.construct(&arena->slots[built].value, *order[built]->_value);
+    } catch (...) {
+      if (arena) {
+        while (built) _alloc.destroy(&arena->slots[--built].value);
+        arena_type::destroy(_alloc_node, arena);
+      }
+      alloc_order.deallocate(order, n);
+      throw ;
+    }
+    for (size_type i = 0; i < n; ++i) {
+      typename arena_type::Slot & slot = arena->slots[i];
+      _alloc_node.construct(&slot.node, *order[i]);
+      slot.node._value = &slot.value;
+      slot.node._isPacked = true;
+      slot.arena = arena;
+    }
+    for (size_type i = 0; i < n; ++i) // Each old node now points, through _parent, to its copy.
+      order[i]->_parent = &arena->slots[i].node;
+    for (size_type i = 0; i < n; ++i) {
+      Node * node = &arena->slots[i].node;
+      if (order[i]->_left)  _attach(node, order[i]->_left->_parent, false);
+      if (order[i]->_right) _attach(node, order[i]->_right->_parent, true);
+    }
+    arena->live = n;
+    Node * old = _root;
+    store_type::set(_root, old->_parent);
+    remove_node(_alloc, _alloc_node, old);
+    alloc_order.deallocate(order, n);
+    _updateAll(_root);
+    links_type::rethread(_root);
+    _size = n;
+  }
+private:
+  static void _collect ( Node * node, _NodeList & list ) // In order, dropping the shape.
+  {
+    while (node) {
+      _collect(node->_left, list);
+      Node * right = node->_right;
+      list.push(node);
+      node = right;
+    }
+  }
+  // Emits the nodes of the first h levels under node.
+  static void _vebOrder ( Node * node, int h, Node ** order, size_type & pos )
+  {
+    if (node == nullptr) return ;
+    if (h == 1) {
+      order[pos++] = node;
+      return ;
+    }
+    int top = h / 2;
+    _vebOrder(node, top, order, pos);
+    _vebBottom(node, top, h - top, order, pos);
+  }
+  static void _vebBottom ( Node * node, int depth, int h, Node ** order, size_type & pos )
+  {
+    if (node == nullptr) return ;
+    if (depth == 0) {
+      _vebOrder(node, h, order, pos);
+      return ;
+    }
+    _vebBottom(node->_left, depth - 1, h, order, pos);
+    _vebBottom(node->_right, depth - 1, h, order, pos);
+  }
+  void _updateAll ( Node * node ) // Bottom-up over the whole subtree.
+  {
+    if (policy_type::enabled == false || node == nullptr) return ;
+    _updateAll(node->_left);
+    _updateAll(node->_right);
+    _update(node);
+  }
+
+private:
+  template < class Key >
+  void _split ( Node * node, int h, const key_prefix_type & probe, const Key & k, Node *& less, int & hless, Node *& equal, Node *& greater, int & hgreater )
+  {
+    if (node == nullptr) {
+      less = greater = nullptr;
+      hless = hgreater = 0;
+      return ;
+    }
+    int hchild = h - (node->_isRed ? 0 : 1);
+    Node * left = _detach(node->_left);
+    Node * right = _detach(node->_right);
+    Node * middle;
+    int hmiddle;
+    int order = key_prefix_type::compare(*node, probe);
+    if (order < 0 || (order == 0 && _comp(*node->_value, k))) {
+      _split(right, hchild, probe, k, middle, hmiddle, equal, greater, hgreater);
+      less = _join(left, hchild, node, middle, hmiddle, hless);
+    } else if (order > 0 || _comp(k, *node->_value)) {
+      _split(left, hchild, probe, k, less, hless, equal, middle, hmiddle);
+      greater = _join(middle, hmiddle, node, right, hchild, hgreater);
+    } else {
+      equal = node;
+      less = left; hless = hchild;
+      greater = right; hgreater = hchild;
+    }
+  }
+  // Splits tree around the root of other, and joins the unions of both sides
+  // back on it. The nodes of other whose key was already there go to kept.
+  Node * _union ( Node * tree, int htree, Node * other, int hother, _NodeList & kept, int & h )
+  {
+    if (other == nullptr) { h = htree; return (tree); }
+    if (tree == nullptr)  { h = hother; return (other); }
+    int hchild = hother - (other->_isRed ? 0 : 1);
+    Node * otherLeft = _detach(other->_left);
+    Node * otherRight = _detach(other->_right);
+    Node * less, * equal = nullptr, * greater;
+    int hless, hgreater, hleft, hright;
+
+    _split(tree, htree, *other, *other->_value, less, hless, equal, greater, hgreater);
+    Node * left = _union(less, hless, otherLeft, hchild, kept, hleft);
+    if (equal) kept.push(other);
+    Node * right = _union(greater, hgreater, otherRight, hchild, kept, hright);
+    return (_join(left, hleft, (equal) ? equal : other, right, hright, h));
+  }
+  Node * _splitLast ( Node * node, int h, Node *& last, int & hrest ) // Detaches the largest node, returns the others.
+  {
+    int hchild = h - (node->_isRed ? 0 : 1);
+    Node * left = _detach(node->_left);
+    if (node->_right == nullptr) {
+      last = node;
+      hrest = hchild;
+      return (left);
+    }
+    Node * right = _detach(node->_right);
+    int hright;
+    Node * rest = _splitLast(right, hchild, last, hright);
+    return (_join(left, hchild, node, rest, hright, hrest));
+  }
+  // left < pivot < right, with their black heights (counting a red root as
+  // black). Returns the new root, and its black height in h. Uses _root as
+  // scratch since the insertion fix-up rotates through it.
+  Node * _join ( Node * left, int hleft, Node * pivot, Node * right, int hright, int & h )
+  {
+    if (left && left->_isRed)   { left->_isRed = false; ++hleft; }
+    if (right && right->_isRed) { right->_isRed = false; ++hright; }
+    pivot->_left = pivot->_right = pivot->_parent = nullptr;
+    if (hleft == hright) {
+      _attach(pivot, left, false);
+      _attach(pivot, right, true);
+      pivot->_isRed = false;
+      _update ( pivot );
+      h = hleft + 1;
+      return (pivot);
+    }
+    bool toRight = (hleft > hright);
+    int hspine = (toRight) ? hleft : hright;
+    int target = (toRight) ? hright : hleft;
+    Node * parent = nullptr;
+    Node * spine = (toRight) ? left : right;
+
+    store_type::set(_root, spine);
+    while (spine && (spine->_isRed || hspine > target)) { // Down to the black node as high as the other tree.
+      if (spine->_isRed == false) --hspine;
+      parent = spine;
+      spine = (toRight) ? spine->_right : spine->_left;
+    }
+    pivot->_isRed = true;
+    _attach(pivot, (toRight) ? spine : left, false);
+    _attach(pivot, (toRight) ? right : spine, true);
+    _attach(parent, pivot, toRight);
+    _updatePath ( pivot );
+    _join_fix ( pivot );
+    h = (toRight) ? hleft : hright;
+    if (_root->_isRed) { _root->_isRed = false; ++h; }
+    return (_root);
+  }
+  void _join_fix ( Node * node ) // The insertion fix-up, stopping at the first level without a red-red pair.
+  {
+    while (node->_parent && node->_parent->_parent && node->_isRed && node->_parent->_isRed) {
+      Node * grandParent = node->_parent->_parent;
+      _addNode_correct ( node );
+      node = grandParent;
+    }
+  }
+  static void _attach ( Node * parent, Node * child, bool isRight )
+  {
+    if (isRight) store_type::set(parent->_right, child);
+    else         store_type::set(parent->_left, child);
+    if (child) {
+      child->_parent = parent;
+      child->_isRight = isRight;
+    }
+  }
+  static Node * _detach ( Node * node )
+  {
+    if (node) node->_parent = nullptr;
+    return (node);
+  }
+  static Node * _asRoot ( Node * node )
+  {
+    if (node) {
+      node->_parent = nullptr;
+      node->_isRed = false;
+      node->_isRight = true;
+    }
+    return (node);
+  }
+  static int _blackHeight ( const Node * node )
+  {
+    int h = 0;
+    for (; node; node = node->_left)
+      if (node->_isRed == false) ++h;
+    return (h);
+  }
+  static size_type _count ( const Node * node )
+  {
+    return ((node) ? 1 + _count(node->_left) + _count(node->_right) : 0);
   }
 
   // ---------------- Insertion ----------------
 public:
   Node * add ( const value_type & val )
   {
-    Node * node = make_node<Node>(_alloc, _alloc_node, val);
+    return (link(make_node<Node>(_alloc, _alloc_node, val)));
+  }
+  Node * link ( Node * node ) // Inserts a detached node, whose key must not be in the tree yet.
+  {
+    node->load(*node->_value); // The key may have changed while it was detached.
+    store_type::set(node->_left, nullptr);
+    store_type::set(node->_right, nullptr);
+    node->_parent = nullptr;
+    node->_isRed = true;
     if (_root == nullptr) {
-      _root = node; _root->_isRed = false;
+      store_type::set(_root, node); _root->_isRed = false;
+      links_type::thread ( _root );
+      _update ( _root );
     } else {
       _addNode ( node );
     }
-    ++_size;
+    if (_size != _unknown) ++_size;
+    _filter.added(node, _root);
     return (node);
   }
+  // ---------------- Hinted Insertion ----------------
+  // The caller checks that the value belongs right before position (nullptr
+  // for the end). No comparison is made, and the fix-up stops at the first
+  // level without a red-red pair, so sequential inserts cost O(1) amortized
+  // rebalancing (plus the augmentation path when the policy has one).
+public:
+  Node * add ( const value_type & val, Node * position )
+  { return (link(make_node<Node>(_alloc, _alloc_node, val), position)); }
+  Node * link ( Node * node, Node * position )
+  {
+    if (_root == nullptr) return (link(node));
+    node->load(*node->_value);
+    store_type::set(node->_left, nullptr);
+    store_type::set(node->_right, nullptr);
+    node->_parent = nullptr;
+    node->_isRed = true;
+    if (position == nullptr) {
+      _attach(largest(), node, true);
+    } else if (position->_left == nullptr) {
+      _attach(position, node, false);
+    } else {
+      Node * before = position->_left;
+      while (before->_right) before = before->_right;
+      _attach(before, node, true);
+    }
+    links_type::thread ( node );
+    _updatePath ( node );
+    _join_fix ( node );
+    _root->_isRed = false;
+    if (_size != _unknown) ++_size;
+    _filter.added(node, _root);
+    return (node);
+  }
+
 private:
   void _addNode ( Node * node )
   {
     Node * tmp = _root;
     while (true) {
-      if (_comp(*node->_value, *tmp->_value)) {
+      int order = key_prefix_type::compare(*node, *tmp);
+      if (order < 0 || (order == 0 && _comp(*node->_value, *tmp->_value))) {
         if (tmp->_left == nullptr) {
-          tmp->_left = node;
+          store_type::set(tmp->_left, node);
           node->_parent = tmp;
           node->_isRight = false;
           break;
         } else tmp = tmp->_left;
       } else {
         if (tmp->_right == nullptr) {
-          tmp->_right = node;
+          store_type::set(tmp->_right, node);
           node->_parent = tmp;
           node->_isRight = true;
           break;
         } else tmp = tmp->_right;
       }
     }
+    links_type::thread ( node );
+    _updatePath ( node );
     _addNode_fix ( node );
   }
   void _addNode_fix ( Node * node )
@@ -300,22 +894,24 @@ private:
     theParent->_parent = theGrandParent->_parent;
     if (theGrandParent->_parent) {
       if (theGrandParent->_isRight) {
-        theGrandParent->_parent->_right = theParent; theParent->_isRight = true;
+        store_type::set(theGrandParent->_parent->_right, theParent); theParent->_isRight = true;
       } else {
-        theGrandParent->_parent->_left = theParent; theParent->_isRight = false;
+        store_type::set(theGrandParent->_parent->_left, theParent); theParent->_isRight = false;
       }
     } else {
-      _root = theParent;
+      store_type::set(_root, theParent);
       theParent->_isRight = true;
     }
-    theGrandParent->_right = theParent->_left;
+    store_type::set(theGrandParent->_right, theParent->_left);
     if (theParent->_left) {
       theParent->_left->_parent = theGrandParent;
       theParent->_left->_isRight = true;
     }
-    theParent->_left = theGrandParent;
+    store_type::set(theParent->_left, theGrandParent);
     theGrandParent->_parent = theParent;
     theGrandParent->_isRight = false;
+    _update ( theGrandParent );
+    _update ( theParent );
   }
   //        0
   //       /
@@ -328,16 +924,18 @@ private:
     Node * theGrandParent = node->_parent->_parent;
 
     node->_parent = theGrandParent;
-    theGrandParent->_left = node;
+    store_type::set(theGrandParent->_left, node);
     node->_isRight = false;
-    theParent->_right = node->_left;
+    store_type::set(theParent->_right, node->_left);
     if (node->_left) {
       node->_left->_parent = theParent;
       node->_left->_isRight = true;
     }
-    node->_left = theParent;
+    store_type::set(node->_left, theParent);
     theParent->_parent = node;
     theParent->_isRight = false;
+    _update ( theParent );
+    _update ( node );
     _addNode_rotate_right ( theParent );
   }
   //      0
@@ -351,16 +949,18 @@ private:
     Node * theGrandParent = node->_parent->_parent;
 
     node->_parent = theGrandParent;
-    theGrandParent->_right = node;
+    store_type::set(theGrandParent->_right, node);
     node->_isRight = true;
-    theParent->_left = node->_right;
+    store_type::set(theParent->_left, node->_right);
     if (node->_right) {
       node->_right->_parent = theParent;
       node->_right->_isRight = false;
     }
-    node->_right = theParent;
+    store_type::set(node->_right, theParent);
     theParent->_parent = node;
     theParent->_isRight = true;
+    _update ( theParent );
+    _update ( node );
     _addNode_rotate_left ( theParent );
   }
   //          0
@@ -376,42 +976,57 @@ private:
     theParent->_parent = theGrandParent->_parent;
     if (theGrandParent->_parent) {
       if (theGrandParent->_isRight) {
-        theGrandParent->_parent->_right = theParent; theParent->_isRight = true;
+        store_type::set(theGrandParent->_parent->_right, theParent); theParent->_isRight = true;
       } else {
-        theGrandParent->_parent->_left = theParent; theParent->_isRight = false;
+        store_type::set(theGrandParent->_parent->_left, theParent); theParent->_isRight = false;
       }
     } else {
-      _root = theParent;
+      store_type::set(_root, theParent);
       theParent->_isRight = true;
     }
-    theGrandParent->_left = theParent->_right;
+    store_type::set(theGrandParent->_left, theParent->_right);
     if (theParent->_right) {
       theParent->_right->_parent = theGrandParent;
       theParent->_right->_isRight = false;
     }
-    theParent->_right = theGrandParent;
+    store_type::set(theParent->_right, theGrandParent);
     theGrandParent->_parent = theParent;
     theGrandParent->_isRight = true;
+    _update ( theGrandParent );
+    _update ( theParent );
   }
 
   // ---------------- Deletion ----------------
 public:
   bool _erase ( const key_type & k ) // THIS IS THE FUNCTION THAT WE ARE GOING TO CALL IN OWR CONTAINERS.
   {
+    if (!_filter.may_contain(k)) return (false);
+    key_prefix_type probe(k);
     Node * node = _root;
 
     while (node) {
-      if (_comp(k, *node->_value)) {
+      int order = key_prefix_type::compare(probe, *node);
+      if (order < 0 || (order == 0 && _comp(k, *node->_value))) {
         node = node->_left;
-      } else if (_comp(*node->_value, k)) {
+      } else if (order > 0 || _comp(*node->_value, k)) {
         node = node->_right;
       } else break ;
     }
     if (node == nullptr) return false;
-    _eraseNode ( node );
-    --_size;
+    remove_node<Node>( _alloc, _alloc_node, unlink(node) );
     return (true);
   }
+  void erase ( Node * node ) // This exact node, for containers with equal keys.
+  { remove_node<Node>( _alloc, _alloc_node, unlink(node) ); }
+  Node * unlink ( Node * node ) // Takes the node out of the tree without freeing it.
+  {
+    links_type::unthread ( node );
+    _eraseNode ( node );
+    node->_parent = nullptr;
+    if (_size != _unknown) --_size;
+    _filter.removed(_root);
+    return (node);
+  }
 private:
   void _eraseNode ( Node * node ) // This is the node that have the value that we want to erase.
   {
@@ -442,25 +1057,25 @@ private:
     bool ItWasRight = node->_isRight;
 
     _erasingTheNode ( node );
+    _updatePath ( DBparent );
     if ( _root && ItWasRed == false )
       _eraseNode_fix ( DBparent, ItWasRight );
   }
-  void _erasingTheNode ( Node * node ) // ERASE THE NOOOOOODE.
+  void _erasingTheNode ( Node * node ) // UNLINK THE NOOOOOODE, the caller frees it.
   {
     if ( node->_parent == nullptr ) {
-      _root = nullptr;
+      store_type::set(_root, nullptr);
     } else {
       Node ** child = (node->_right) ? &node->_right : &node->_left;
-      if (node->_isRight) node->_parent->_right = *child;
-      else node->_parent->_left = *child;
+      if (node->_isRight) store_type::set(node->_parent->_right, *child);
+      else store_type::set(node->_parent->_left, *child);
       if (*child) {
         (*child)->_parent = node->_parent;
         (*child)->_isRed = node->_isRed;
         (*child)->_isRight = node->_isRight;
       }
-      *child = nullptr;
+      store_type::set(*child, nullptr);
     }
-    remove_node<Node>( _alloc, _alloc_node, node );
   }
   void _eraseNode_fix ( Node * DBparent, const bool & DBisRight ) // Fix the violations.
   {
@@ -541,22 +1156,24 @@ private:
     leftChild->_parent = node->_parent;
     if (node->_parent) {
       if (node->_isRight) {
-        node->_parent->_right = leftChild; leftChild->_isRight = true;
+        store_type::set(node->_parent->_right, leftChild); leftChild->_isRight = true;
       } else {
-        node->_parent->_left = leftChild; leftChild->_isRight = false;
+        store_type::set(node->_parent->_left, leftChild); leftChild->_isRight = false;
       }
     } else {
-      _root = leftChild;
+      store_type::set(_root, leftChild);
       leftChild->_isRight = true;
     }
-    node->_left = leftChild->_right;
+    store_type::set(node->_left, leftChild->_right);
     if (leftChild->_right) {
       leftChild->_right->_parent = node;
       leftChild->_right->_isRight = false;
     }
-    leftChild->_right = node;
+    store_type::set(leftChild->_right, node);
     node->_parent = leftChild;
     node->_isRight = true;
+    _update ( node );
+    _update ( leftChild );
   }
   //        0 ( the node )
   //       / \
@@ -568,27 +1185,41 @@ private:
     rightChild->_parent = node->_parent;
     if (node->_parent) {
       if (node->_isRight) {
-        node->_parent->_right = rightChild; rightChild->_isRight = true;
+        store_type::set(node->_parent->_right, rightChild); rightChild->_isRight = true;
       } else {
-        node->_parent->_left = rightChild; rightChild->_isRight = false;
+        store_type::set(node->_parent->_left, rightChild); rightChild->_isRight = false;
       }
     } else {
-      _root = rightChild;
+      store_type::set(_root, rightChild);
       rightChild->_isRight = true;
     }
-    node->_right = rightChild->_left;
+    store_type::set(node->_right, rightChild->_left);
     if (rightChild->_left) {
       rightChild->_left->_parent = node;
       rightChild->_left->_isRight = true;
     }
-    rightChild->_left = node;
+    store_type::set(rightChild->_left, node);
     node->_parent = rightChild;
     node->_isRight = false;
+    _update ( node );
+    _update ( rightChild );
+  }
+
+  // ---------------- Augmentation ----------------
+private:
+  void _update ( Node * node ) { policy_type::update(node); }
+  void _updatePath ( Node * node ) // Recompute a node and all of its ancestors.
+  {
+    if (policy_type::enabled == false) return ;
+    while (node) {
+      policy_type::update(node);
+      node = node->_parent;
+    }
   }
 
   // ---------------- Node Class ----------------
 public:
-  struct Node {
+  struct Node : public key_prefix_type, public links_type { // Both are empty unless the comparator or the policy ask for them.
     typedef typename Container::key_type             key_type;
     typedef typename Container::mapped_type          mapped_type;
     typedef typename Container::value_type           value_type;
@@ -596,6 +1227,7 @@ public:
     typedef typename Container::value_compare                      value_compare;
     typedef typename Container::allocator_type                     allocator_type;
     typedef typename allocator_type::template rebind<Node>::other  allocator_node_type;
+    typedef typename Container::policy_type                        policy_type;
 
     typedef typename allocator_type::size_type            size_type;
     typedef typename allocator_node_type::size_type       size_node_type;
@@ -605,6 +1237,8 @@ public:
     Node                * _right;
     Node                * _parent;
     bool                _isRed, _isRight;
+    bool                _isPacked; // Lives in a tree_arena slot rather than in its own allocation.
+    typename policy_type::data_type _augment;
 
     Node (value_type * const & value = nullptr,
           Node * const & left = nullptr,
@@ -618,24 +1252,31 @@ public:
       , _parent(parent)
       , _isRed(isRed)
       , _isRight(isRight)
+      , _isPacked(false)
+      , _augment()
     { }
 
     Node ( const Node & copy )
-      : _value(nullptr)
+      : key_prefix_type(copy)
+      , _value(nullptr)
       , _left(nullptr)
       , _right(nullptr)
       , _parent(nullptr)
       , _isRed(copy._isRed)
       , _isRight(copy._isRight)
+      , _isPacked(false)
+      , _augment(copy._augment)
     { }
 
     Node &operator=( const Node & copy ) {
+      key_prefix_type::operator=(copy);
       _value = nullptr;
       _left = nullptr;
       _right = nullptr;
       _parent = nullptr;
       _isRed = copy._isRed;
       _isRight = copy._isRight;
+      _augment = copy._augment;
       return (*this);
     }
 
@@ -654,10 +1295,10 @@ public:
 
       _parent_child_node = (node->_isRight) ? &node->_parent->_right : &node->_parent->_left;
       if (*_parent_child_node != node)
-        *_parent_child_node = this;
+        store_type::set(*_parent_child_node, this);
       if (!iAmRoot) {
         _parent_child_this = (this->_isRight) ? &this->_parent->_right : &this->_parent->_left;
-        *_parent_child_this = node;
+        store_type::set(*_parent_child_this, node);
       }
 
       if (_left && _left != node)   _left->_parent = node;
@@ -665,13 +1306,13 @@ public:
       if (node->_left) node->_left->_parent = this;
       if (node->_right) node->_right->_parent = this;
 
-      if (this->_left == node) node->_left = this;
-      else node->_left = _left;
-      _left = _left_tmp;
+      if (this->_left == node) store_type::set(node->_left, this);
+      else store_type::set(node->_left, _left);
+      store_type::set(_left, _left_tmp);
 
-      if (this->_right == node) node->_right = this;
-      else node->_right = _right;
-      _right = _right_tmp;
+      if (this->_right == node) store_type::set(node->_right, this);
+      else store_type::set(node->_right, _right);
+      store_type::set(_right, _right_tmp);
 
       node->_parent = _parent;
       if (_parent_tmp == this) _parent = node;
@@ -683,7 +1324,7 @@ public:
       node->_isRight = _isRight;
       _isRight = _isRight_tmp;
 
-      if (iAmRoot) *root = node;
+      if (iAmRoot) store_type::set(*root, node);
     }
 
     bool lessThan ( const Node * const node, const value_compare & comp ) {
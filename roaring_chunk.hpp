@@ -0,0 +1,250 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   roaring_chunk.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ROARING_CHUNK_HPP
+#define ROARING_CHUNK_HPP
+
+#include <cstring>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+// ---------------- Bitmap Kernels ----------------
+// Two bitmaps of 65536 bits combined word by word, 128 bits at a time with
+// SSE2. They return the number of bits set in the result, which is written
+// to out unless out is nullptr.
+// keep_left and keep_right tell whether the values of only one side stay.
+struct roaring_and {
+  static const bool keep_left = false;
+  static const bool keep_right = false;
+#if defined(__SSE2__)
+  static __m128i apply ( __m128i a, __m128i b ) { return (_mm_and_si128(a, b)); }
+#endif
+  static uint64_t apply ( uint64_t a, uint64_t b ) { return (a & b); }
+};
+struct roaring_or {
+  static const bool keep_left = true;
+  static const bool keep_right = true;
+#if defined(__SSE2__)
+  static __m128i apply ( __m128i a, __m128i b ) { return (_mm_or_si128(a, b)); }
+#endif
+  static uint64_t apply ( uint64_t a, uint64_t b ) { return (a | b); }
+};
+struct roaring_andnot {
+  static const bool keep_left = true;
+  static const bool keep_right = false;
+#if defined(__SSE2__)
+  static __m128i apply ( __m128i a, __m128i b ) { return (_mm_andnot_si128(b, a)); }
+#endif
+  static uint64_t apply ( uint64_t a, uint64_t b ) { return (a & ~b); }
+};
+
+template < class Op >
+uint32_t roaring_bitmap_op ( const uint64_t * a, const uint64_t * b, uint64_t * out )
+{
+  uint32_t count = 0;
+#if defined(__SSE2__)
+  uint64_t lanes[2];
+  for (int i = 0; i < 1024; i += 2) {
+    __m128i r = Op::apply(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)),
+                          _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)));
+    uint64_t * to = (out) ? out + i : lanes;
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(to), r);
+    count += __builtin_popcountll(to[0]) + __builtin_popcountll(to[1]);
+  }
+#else
+  for (int i = 0; i < 1024; ++i) {
+    uint64_t r = Op::apply(a[i], b[i]);
+    if (out)
+      out[i] = r;
+    count += __builtin_popcountll(r);
+  }
+#endif
+  return (count);
+}
+
+inline uint32_t roaring_popcount ( const uint64_t * bits )
+{
+  uint32_t count = 0;
+  for (int i = 0; i < 1024; ++i)
+    count += __builtin_popcountll(bits[i]);
+  return (count);
+}
+
+inline void roaring_set_range ( uint64_t * bits, uint32_t first, uint32_t last ) // [first, last]
+{
+  uint32_t w = first >> 6, lw = last >> 6;
+  uint64_t head = ~uint64_t(0) << (first & 63);
+  uint64_t tail = ~uint64_t(0) >> (63 - (last & 63));
+  if (w == lw) {
+    bits[w] |= head & tail;
+    return ;
+  }
+  bits[w] |= head;
+  while (++w < lw)
+    bits[w] = ~uint64_t(0);
+  bits[lw] |= tail;
+}
+
+// ---------------- Chunk ----------------
+// The values of a roaring_set that share their high 16 bits, as one of:
+// - array:  the sorted low 16 bits, up to array_max of them.
+// - bitmap: 65536 bits, once an array would take more room (8kB).
+// - run:    sorted (start, length - 1) pairs, for long ranges of values.
+// The roaring_set owns the memory; a chunk only reads it.
+struct roaring_chunk {
+  enum { array, bitmap, run };
+  static const uint32_t array_max = 4096;
+  static const uint32_t words = 1024;
+
+  uint16_t   key;
+  uint8_t    kind;
+  uint32_t   card;
+  uint32_t   size;      // Values of an array, pairs of a run.
+  uint32_t   capacity;  // In uint16_t, for an array or a run.
+  union {
+    uint16_t * values;
+    uint64_t * bits;
+  };
+
+  // The first of the size values of an array not less than low.
+  uint32_t lower ( uint16_t low ) const
+  {
+    uint32_t lo = 0, hi = size;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (values[mid] < low) lo = mid + 1;
+      else hi = mid;
+    }
+    return (lo);
+  }
+  // The last run starting at or before low, or size when there is none.
+  uint32_t run_of ( uint16_t low ) const
+  {
+    uint32_t lo = 0, hi = size;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (values[2 * mid] <= low) lo = mid + 1;
+      else hi = mid;
+    }
+    return ((lo) ? lo - 1 : size);
+  }
+  uint32_t run_end ( uint32_t i ) const { return (uint32_t(values[2 * i]) + values[2 * i + 1]); }
+
+  bool contains ( uint16_t low ) const
+  {
+    if (kind == bitmap)
+      return ((bits[low >> 6] >> (low & 63)) & 1);
+    if (kind == array) {
+      uint32_t i = lower(low);
+      return (i < size && values[i] == low);
+    }
+    uint32_t i = run_of(low);
+    return (i < size && low <= run_end(i));
+  }
+  uint32_t next_bit ( uint32_t from ) const // 65536 when there is none.
+  {
+    uint32_t w = from >> 6;
+    if (w >= words)
+      return (65536);
+    uint64_t word = bits[w] & (~uint64_t(0) << (from & 63));
+    while (word == 0) {
+      if (++w == words)
+        return (65536);
+      word = bits[w];
+    }
+    return ((w << 6) + __builtin_ctzll(word));
+  }
+
+  // ---------------- Positions ----------------
+  // A value is found at (at, off): its index in an array, its bit in a
+  // bitmap, or its run and its offset in that run.
+  void first ( uint32_t & at, uint32_t & off ) const
+  {
+    at = (kind == bitmap) ? next_bit(0) : 0;
+    off = 0;
+  }
+  bool next ( uint32_t & at, uint32_t & off ) const // false past the last value.
+  {
+    if (kind == bitmap)
+      return ((at = next_bit(at + 1)) < 65536);
+    if (kind == run && off < values[2 * at + 1])
+      return (++off, true);
+    off = 0;
+    return (++at < size);
+  }
+  uint16_t value ( uint32_t at, uint32_t off ) const
+  {
+    if (kind == bitmap)
+      return (static_cast<uint16_t>(at));
+    if (kind == array)
+      return (values[at]);
+    return (static_cast<uint16_t>(values[2 * at] + off));
+  }
+  // Where low is, or would be: the first value not less than low.
+  bool seek ( uint16_t low, uint32_t & at, uint32_t & off ) const // false past the last value.
+  {
+    off = 0;
+    if (kind == bitmap)
+      return ((at = next_bit(low)) < 65536);
+    if (kind == array)
+      return ((at = lower(low)) < size);
+    at = run_of(low);
+    if (at == size)
+      at = 0;
+    else if (low <= run_end(at))
+      off = low - values[2 * at];
+    else
+      ++at;
+    return (at < size);
+  }
+
+  // ---------------- Views ----------------
+  // The chunk as a bitmap: its own bits, or out filled from its values.
+  const uint64_t * as_bitmap ( uint64_t * out ) const
+  {
+    if (kind == bitmap)
+      return (bits);
+    std::memset(out, 0, words * sizeof(uint64_t));
+    if (kind == array)
+      for (uint32_t i = 0; i < size; ++i)
+        out[values[i] >> 6] |= uint64_t(1) << (values[i] & 63);
+    else
+      for (uint32_t i = 0; i < size; ++i)
+        roaring_set_range(out, values[2 * i], run_end(i));
+    return (out);
+  }
+  uint32_t runs ( void ) const // How many runs the values make.
+  {
+    if (kind == run)
+      return (size);
+    uint32_t n = 0;
+    if (kind == array) {
+      for (uint32_t i = 0; i < size; ++i)
+        n += (i == 0 || values[i] != values[i - 1] + 1);
+      return (n);
+    }
+    uint64_t carry = 0;
+    for (uint32_t i = 0; i < words; ++i) { // A run starts on a set bit after a clear one.
+      n += __builtin_popcountll(bits[i] & ~((bits[i] << 1) | carry));
+      carry = bits[i] >> 63;
+    }
+    return (n);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,721 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   roaring_set.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ROARING_SET_HPP
+#define ROARING_SET_HPP
+
+#include "Iterators/iterator_roaring.hpp"
+#include "roaring_chunk.hpp"
+#include "vector.hpp"
+#include <functional>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// A set of 32-bit unsigned integers, compressed: the values are split on
+// their high 16 bits into chunks, each stored as a sorted array, a bitmap or
+// a list of runs, whichever is smaller (see roaring_chunk.hpp). A sparse set
+// takes about 2 bytes per value and a dense one about 1 bit, and set
+// operations combine whole chunks, bitmaps a word at a time.
+// Insert and erase invalidate every iterator. Chunks become runs only on
+// run_optimize().
+template
+<
+class Alloc = std::allocator<uint32_t>
+>
+class roaring_set {
+public:
+  typedef uint32_t                                      key_type;
+  typedef uint32_t                                      value_type;
+  typedef std::less<uint32_t>                           key_compare;
+  typedef std::less<uint32_t>                           value_compare;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::iterator_roaring<roaring_chunk>           iterator;
+  typedef ft::iterator_roaring<roaring_chunk>           const_iterator;
+
+private:
+  typedef roaring_chunk                                               Chunk;
+  typedef typename allocator_type::template rebind<Chunk>::other     allocator_chunk_type;
+  typedef typename allocator_type::template rebind<uint16_t>::other  allocator_values_type;
+  typedef typename allocator_type::template rebind<uint64_t>::other  allocator_bits_type;
+  typedef ft::vector<Chunk, allocator_chunk_type>                     chunks_type;
+
+  allocator_type        _alloc;
+  allocator_values_type _alloc_values;
+  allocator_bits_type   _alloc_bits;
+  chunks_type           _chunks; // Sorted by key.
+  size_type             _size;
+
+public:
+  // [*] // explicit roaring_set ( const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > roaring_set ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type() );
+  // [*] // roaring_set ( const roaring_set& x );
+  // [*] // roaring_set& operator=( const roaring_set& other );
+  // [*] // ~roaring_set ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit roaring_set ( const allocator_type& alloc = allocator_type() )
+    : _alloc ( alloc )
+    , _alloc_values ( alloc )
+    , _alloc_bits ( alloc )
+    , _chunks ( allocator_chunk_type(alloc) )
+    , _size ( 0 )
+  { }
+  template < class InputIterator >
+  roaring_set ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _alloc ( alloc )
+    , _alloc_values ( alloc )
+    , _alloc_bits ( alloc )
+    , _chunks ( allocator_chunk_type(alloc) )
+    , _size ( 0 )
+  {
+    try {
+      insert(first, last);
+    } catch (...) {
+      clear();
+      throw ;
+    }
+  }
+  roaring_set ( const roaring_set& x )
+    : _alloc ( x._alloc )
+    , _alloc_values ( x._alloc_values )
+    , _alloc_bits ( x._alloc_bits )
+    , _chunks ( allocator_chunk_type(x._alloc) )
+    , _size ( 0 )
+  {
+    try {
+      _chunks.reserve(x._chunks.size());
+      for (size_t i = 0; i < x._chunks.size(); ++i)
+        _append(_clone(x._chunks[i]));
+    } catch (...) {
+      clear();
+      throw ;
+    }
+  }
+  roaring_set& operator=( const roaring_set& x )
+  {
+    if (this != &x) {
+      roaring_set tmp(x);
+      swap(tmp);
+    }
+    return (*this);
+  }
+  ~roaring_set ( ) { clear(); }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] / value_compare value_comp() const;
+  key_compare key_comp() const { return (key_compare()); }
+  value_compare value_comp() const { return (value_compare()); }
+
+  // [*] // iterator begin ( ) const;
+  // [*] // iterator end ( ) const;
+  iterator begin ( ) const
+  {
+    uint32_t at = 0, off = 0;
+    if (_chunks.size())
+      _chunks[0].first(at, off);
+    return (iterator(_chunks.data(), _chunks.size(), 0, at, off));
+  }
+  iterator end ( ) const
+  { return (iterator(_chunks.data(), _chunks.size(), _chunks.size(), 0, 0)); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (_size == 0); }
+  size_type size ( ) const { return (_size); }
+  size_type max_size ( ) const { return (size_type(~uint32_t(0)) + 1); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    uint16_t high = static_cast<uint16_t>(val >> 16), low = static_cast<uint16_t>(val);
+    size_t i = _chunkOf(high);
+    if (i == _chunks.size() || _chunks[i].key != high)
+      _chunks.insert(_chunks.begin() + i, _newChunk(high));
+    bool inserted;
+    try {
+      inserted = _add(_chunks[i], low);
+    } catch (...) {
+      if (_chunks[i].card == 0)
+        _chunks.erase(_chunks.begin() + i);
+      throw ;
+    }
+    _size += inserted;
+    return (ft::make_pair(_iterator(i, low), inserted));
+  }
+  iterator insert ( iterator position, const value_type& val ) // The chunk is found by its key anyway.
+  {
+    (void)position;
+    return (insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      insert(*(first++));
+  }
+
+  // [*] // size_type erase ( const value_type& val );
+  // [*] // void erase ( iterator position );
+  // Erasing inside a run may need room for one more run.
+  size_type erase ( const value_type& val )
+  {
+    uint16_t high = static_cast<uint16_t>(val >> 16), low = static_cast<uint16_t>(val);
+    size_t i = _chunkOf(high);
+    if (i == _chunks.size() || _chunks[i].key != high || !_remove(_chunks[i], low))
+      return (0);
+    --_size;
+    if (_chunks[i].card == 0) {
+      _freeData(_chunks[i]);
+      _chunks.erase(_chunks.begin() + i);
+    }
+    return (1);
+  }
+  void erase ( iterator position )
+  { erase(*position); }
+
+  // [*] // void swap ( roaring_set& x );
+  void swap ( roaring_set& x )
+  {
+    _chunks.swap(x._chunks);
+    size_type size_tmp = _size;
+    _size = x._size;
+    x._size = size_tmp;
+  }
+
+  // [*] // void clear ( );
+  void clear ( )
+  {
+    for (size_t i = 0; i < _chunks.size(); ++i)
+      _freeData(_chunks[i]);
+    _chunks.clear();
+    _size = 0;
+  }
+
+  // [*] // bool contains ( const value_type& val ) const;
+  // [*] // size_type count ( const value_type& val ) const;
+  // [*] // iterator find ( const value_type& val ) const;
+  // [*] // iterator lower_bound ( const value_type& val ) const;
+  bool contains ( const value_type& val ) const
+  {
+    uint16_t high = static_cast<uint16_t>(val >> 16);
+    size_t i = _chunkOf(high);
+    return (i < _chunks.size() && _chunks[i].key == high && _chunks[i].contains(static_cast<uint16_t>(val)));
+  }
+  size_type count ( const value_type& val ) const
+  { return (contains(val) ? 1 : 0); }
+  iterator find ( const value_type& val ) const
+  { return (contains(val) ? _iterator(_chunkOf(static_cast<uint16_t>(val >> 16)), static_cast<uint16_t>(val)) : end()); }
+  iterator lower_bound ( const value_type& val ) const
+  {
+    uint16_t high = static_cast<uint16_t>(val >> 16);
+    size_t i = _chunkOf(high);
+    uint32_t at = 0, off = 0;
+    if (i < _chunks.size() && _chunks[i].key == high) {
+      if (_chunks[i].seek(static_cast<uint16_t>(val), at, off))
+        return (iterator(_chunks.data(), _chunks.size(), i, at, off));
+      ++i;
+    }
+    if (i == _chunks.size())
+      return (end());
+    _chunks[i].first(at, off);
+    return (iterator(_chunks.data(), _chunks.size(), i, at, off));
+  }
+
+  // [*] // void run_optimize ( );
+  // Turns every chunk into the smallest of its three forms, and trims spare room.
+  void run_optimize ( )
+  {
+    for (size_t i = 0; i < _chunks.size(); ++i)
+      _optimize(_chunks[i]);
+  }
+
+  // ---------------- Set Operations ----------------
+  // The engine of set_union, set_intersection and set_difference below:
+  // chunks of one side only are copied or dropped, chunks on both sides are
+  // combined by Op.
+  template < class Op >
+  static void combine ( const roaring_set & a, const roaring_set & b, roaring_set & result )
+  {
+    roaring_set tmp(a.get_allocator()); // result may be one of the operands
+    uint64_t * scratch = nullptr;
+    size_t i = 0, j = 0;
+    try {
+      while (i < a._chunks.size() || j < b._chunks.size()) {
+        if (j == b._chunks.size() || (i < a._chunks.size() && a._chunks[i].key < b._chunks[j].key)) {
+          if (Op::keep_left) tmp._append(tmp._clone(a._chunks[i]));
+          ++i;
+        } else if (i == a._chunks.size() || b._chunks[j].key < a._chunks[i].key) {
+          if (Op::keep_right) tmp._append(tmp._clone(b._chunks[j]));
+          ++j;
+        } else {
+          Chunk c = tmp.template _apply<Op>(a._chunks[i++], b._chunks[j++], scratch);
+          if (c.card)
+            tmp._append(c);
+        }
+      }
+    } catch (...) {
+      tmp._freeScratch(scratch);
+      throw ;
+    }
+    tmp._freeScratch(scratch);
+    result.swap(tmp);
+  }
+  static size_type intersection_size ( const roaring_set & a, const roaring_set & b )
+  {
+    size_type n = 0;
+    uint64_t * scratch = nullptr;
+    size_t i = 0, j = 0;
+    try {
+      while (i < a._chunks.size() && j < b._chunks.size()) {
+        const Chunk & x = a._chunks[i], & y = b._chunks[j];
+        if (x.key < y.key) { ++i; continue ; }
+        if (y.key < x.key) { ++j; continue ; }
+        if (x.kind == Chunk::array && y.kind == Chunk::array)
+          n += _mergeArrays<roaring_and>(x, y, nullptr);
+        else if (x.kind == Chunk::array || y.kind == Chunk::array) {
+          const Chunk & small = (x.kind == Chunk::array) ? x : y, & large = (x.kind == Chunk::array) ? y : x;
+          for (uint32_t k = 0; k < small.size; ++k)
+            n += large.contains(small.values[k]);
+        } else {
+          if (scratch == nullptr)
+            scratch = a._scratch();
+          n += roaring_bitmap_op<roaring_and>(x.as_bitmap(scratch), y.as_bitmap(scratch + Chunk::words), nullptr);
+        }
+        ++i;
+        ++j;
+      }
+    } catch (...) {
+      a._freeScratch(scratch);
+      throw ;
+    }
+    a._freeScratch(scratch);
+    return (n);
+  }
+
+private:
+  // ---------------- Chunks ----------------
+  size_t _chunkOf ( uint16_t high ) const // The first chunk whose key is not less than high.
+  {
+    size_t lo = 0, hi = _chunks.size();
+    while (lo < hi) {
+      size_t mid = (lo + hi) / 2;
+      if (_chunks[mid].key < high) lo = mid + 1;
+      else hi = mid;
+    }
+    return (lo);
+  }
+  iterator _iterator ( size_t i, uint16_t low ) const
+  {
+    uint32_t at, off;
+    _chunks[i].seek(low, at, off);
+    return (iterator(_chunks.data(), _chunks.size(), i, at, off));
+  }
+  static Chunk _newChunk ( uint16_t key )
+  {
+    Chunk c;
+    c.key = key;
+    c.kind = Chunk::array;
+    c.card = 0;
+    c.size = 0;
+    c.capacity = 0;
+    c.values = nullptr;
+    return (c);
+  }
+  void _append ( const Chunk & c ) // Takes the memory of c.
+  {
+    try {
+      _chunks.push_back(c);
+    } catch (...) {
+      Chunk tmp = c;
+      _freeData(tmp);
+      throw ;
+    }
+    _size += c.card;
+  }
+  void _freeData ( Chunk & c )
+  {
+    if (c.kind == Chunk::bitmap)
+      _alloc_bits.deallocate(c.bits, Chunk::words);
+    else if (c.capacity)
+      _alloc_values.deallocate(c.values, c.capacity);
+    c.values = nullptr;
+    c.capacity = 0;
+  }
+  void _reserve ( Chunk & c, uint32_t n ) // Room for n uint16_t in an array or a run.
+  {
+    if (n <= c.capacity)
+      return ;
+    uint16_t * values = _alloc_values.allocate(n);
+    if (c.size)
+      std::memcpy(values, c.values, ((c.kind == Chunk::run) ? 2 * c.size : c.size) * sizeof(uint16_t));
+    _freeData(c);
+    c.values = values;
+    c.capacity = n;
+  }
+  Chunk _clone ( const Chunk & src )
+  {
+    Chunk c = src;
+    if (src.kind == Chunk::bitmap) {
+      c.bits = _alloc_bits.allocate(Chunk::words);
+      std::memcpy(c.bits, src.bits, Chunk::words * sizeof(uint64_t));
+    } else {
+      c.capacity = (src.kind == Chunk::run) ? 2 * src.size : src.size;
+      c.values = (c.capacity) ? _alloc_values.allocate(c.capacity) : nullptr;
+      if (c.capacity)
+        std::memcpy(c.values, src.values, c.capacity * sizeof(uint16_t));
+    }
+    return (c);
+  }
+  uint64_t * _scratch ( void ) const // Two bitmaps.
+  {
+    allocator_bits_type alloc(_alloc_bits);
+    return (alloc.allocate(2 * Chunk::words));
+  }
+  void _freeScratch ( uint64_t * scratch ) const
+  {
+    allocator_bits_type alloc(_alloc_bits);
+    if (scratch)
+      alloc.deallocate(scratch, 2 * Chunk::words);
+  }
+
+  // ---------------- Conversions ----------------
+  // The values are read in order from the old form, then the old memory goes.
+  void _toBitmap ( Chunk & c )
+  {
+    uint64_t * bits = _alloc_bits.allocate(Chunk::words);
+    c.as_bitmap(bits);
+    _freeData(c);
+    c.bits = bits;
+    c.kind = Chunk::bitmap;
+    c.size = 0;
+  }
+  void _toArray ( Chunk & c )
+  {
+    uint16_t * values = _alloc_values.allocate(c.card);
+    uint32_t at, off;
+    c.first(at, off);
+    for (uint32_t k = 0; k < c.card; ++k, c.next(at, off))
+      values[k] = c.value(at, off);
+    _freeData(c);
+    c.values = values;
+    c.capacity = c.card;
+    c.size = c.card;
+    c.kind = Chunk::array;
+  }
+  void _toRuns ( Chunk & c, uint32_t runs )
+  {
+    uint16_t * values = _alloc_values.allocate(2 * runs);
+    uint32_t at, off, n = 0;
+    c.first(at, off);
+    for (uint32_t k = 0; k < c.card; ++k, c.next(at, off)) {
+      uint16_t v = c.value(at, off);
+      if (n && uint32_t(values[2 * n - 2]) + values[2 * n - 1] + 1 == v)
+        ++values[2 * n - 1];
+      else {
+        values[2 * n] = v;
+        values[2 * n + 1] = 0;
+        ++n;
+      }
+    }
+    _freeData(c);
+    c.values = values;
+    c.capacity = 2 * runs;
+    c.size = runs;
+    c.kind = Chunk::run;
+  }
+  void _optimize ( Chunk & c )
+  {
+    uint32_t runs = c.runs();
+    uint32_t array_bytes = (c.card <= Chunk::array_max) ? 2 * c.card : ~uint32_t(0);
+    uint32_t bitmap_bytes = Chunk::words * sizeof(uint64_t);
+    if (4 * runs < array_bytes && 4 * runs < bitmap_bytes)
+      return (_toRuns(c, runs));
+    if (array_bytes <= bitmap_bytes)
+      return (_toArray(c));
+    if (c.kind != Chunk::bitmap)
+      _toBitmap(c);
+  }
+
+  // ---------------- Insert / Erase ----------------
+  bool _add ( Chunk & c, uint16_t low )
+  {
+    if (c.kind == Chunk::array) {
+      uint32_t i = c.lower(low);
+      if (i < c.size && c.values[i] == low)
+        return (false);
+      if (c.size == Chunk::array_max)
+        _toBitmap(c);
+      else {
+        if (c.size == c.capacity)
+          _reserve(c, (c.capacity < 2) ? 4 : ((2 * c.capacity < Chunk::array_max) ? 2 * c.capacity : Chunk::array_max));
+        std::memmove(c.values + i + 1, c.values + i, (c.size - i) * sizeof(uint16_t));
+        c.values[i] = low;
+        ++c.size;
+        ++c.card;
+        return (true);
+      }
+    }
+    if (c.kind == Chunk::bitmap) {
+      uint64_t bit = uint64_t(1) << (low & 63);
+      if (c.bits[low >> 6] & bit)
+        return (false);
+      c.bits[low >> 6] |= bit;
+      ++c.card;
+      return (true);
+    }
+    uint32_t i = c.run_of(low);
+    if (i < c.size && low <= c.run_end(i))
+      return (false);
+    uint32_t next = (i == c.size) ? 0 : i + 1;
+    bool join_prev = (i < c.size && c.run_end(i) + 1 == low);
+    bool join_next = (next < c.size && uint32_t(low) + 1 == c.values[2 * next]);
+    if (join_prev && join_next) {
+      c.values[2 * i + 1] = static_cast<uint16_t>(c.run_end(next) - c.values[2 * i]);
+      std::memmove(c.values + 2 * next, c.values + 2 * next + 2, 2 * (c.size - next - 1) * sizeof(uint16_t));
+      --c.size;
+    } else if (join_prev) {
+      ++c.values[2 * i + 1];
+    } else if (join_next) {
+      --c.values[2 * next];
+      ++c.values[2 * next + 1];
+    } else {
+      if (2 * c.size + 2 > c.capacity)
+        _reserve(c, (c.capacity < 4) ? 4 : 2 * c.capacity);
+      std::memmove(c.values + 2 * next + 2, c.values + 2 * next, 2 * (c.size - next) * sizeof(uint16_t));
+      c.values[2 * next] = low;
+      c.values[2 * next + 1] = 0;
+      ++c.size;
+    }
+    ++c.card;
+    if (4 * c.size >= Chunk::words * sizeof(uint64_t)) { // 2048 runs fill 8KB, as much as a bitmap: _optimize's rule.
+      try {
+        _toBitmap(c);
+      } catch (...) { }
+    }
+    return (true);
+  }
+  bool _remove ( Chunk & c, uint16_t low )
+  {
+    if (c.kind == Chunk::array) {
+      uint32_t i = c.lower(low);
+      if (i == c.size || c.values[i] != low)
+        return (false);
+      std::memmove(c.values + i, c.values + i + 1, (c.size - i - 1) * sizeof(uint16_t));
+      --c.size;
+      --c.card;
+      return (true);
+    }
+    if (c.kind == Chunk::bitmap) {
+      uint64_t bit = uint64_t(1) << (low & 63);
+      if ((c.bits[low >> 6] & bit) == 0)
+        return (false);
+      c.bits[low >> 6] &= ~bit;
+      if (--c.card == Chunk::array_max) {
+        try {
+          _toArray(c);
+        } catch (...) { }
+      }
+      return (true);
+    }
+    uint32_t i = c.run_of(low);
+    if (i == c.size || low > c.run_end(i))
+      return (false);
+    uint16_t start = c.values[2 * i];
+    uint32_t end = c.run_end(i);
+    if (start == end) {
+      std::memmove(c.values + 2 * i, c.values + 2 * i + 2, 2 * (c.size - i - 1) * sizeof(uint16_t));
+      --c.size;
+    } else if (low == start) {
+      ++c.values[2 * i];
+      --c.values[2 * i + 1];
+    } else if (low == end) {
+      --c.values[2 * i + 1];
+    } else { // Split in two.
+      if (2 * c.size + 2 > c.capacity)
+        _reserve(c, 2 * c.capacity);
+      std::memmove(c.values + 2 * i + 4, c.values + 2 * i + 2, 2 * (c.size - i - 1) * sizeof(uint16_t));
+      c.values[2 * i + 1] = static_cast<uint16_t>(low - 1 - start);
+      c.values[2 * i + 2] = static_cast<uint16_t>(low + 1);
+      c.values[2 * i + 3] = static_cast<uint16_t>(end - low - 1);
+      ++c.size;
+    }
+    --c.card;
+    return (true);
+  }
+
+  // ---------------- Chunk Operations ----------------
+  // The result of Op on two chunks with the same key: an array, or a bitmap
+  // when it holds more than array_max values. No memory when it is empty.
+  template < class Op >
+  Chunk _apply ( const Chunk & x, const Chunk & y, uint64_t *& scratch )
+  {
+    if (x.kind == Chunk::array && y.kind == Chunk::array)
+      return (_mergedArrays<Op>(x, y));
+    if (x.kind == Chunk::array && !Op::keep_right) // A part of x: each value is looked up in y.
+      return (_filter(x, y, !Op::keep_left));
+    if (y.kind == Chunk::array && !Op::keep_left)
+      return (_filter(y, x, true));
+    if (scratch == nullptr)
+      scratch = _scratch();
+    Chunk c = _newChunk(x.key);
+    c.bits = _alloc_bits.allocate(Chunk::words);
+    c.kind = Chunk::bitmap;
+    c.card = roaring_bitmap_op<Op>(x.as_bitmap(scratch), y.as_bitmap(scratch + Chunk::words), c.bits);
+    if (c.card == 0)
+      _freeData(c);
+    else if (c.card <= Chunk::array_max) {
+      try {
+        _toArray(c);
+      } catch (...) {
+        _freeData(c);
+        throw ;
+      }
+    }
+    return (c);
+  }
+  Chunk _filter ( const Chunk & x, const Chunk & y, bool in_y ) // The values of the array x that are (not) in y.
+  {
+    Chunk c = _newChunk(x.key);
+    c.values = _alloc_values.allocate(x.size);
+    c.capacity = x.size;
+    for (uint32_t k = 0; k < x.size; ++k)
+      if (y.contains(x.values[k]) == in_y)
+        c.values[c.size++] = x.values[k];
+    c.card = c.size;
+    if (c.card == 0)
+      _freeData(c);
+    return (c);
+  }
+  template < class Op >
+  Chunk _mergedArrays ( const Chunk & x, const Chunk & y )
+  {
+    Chunk c = _newChunk(x.key);
+    uint32_t n = (Op::keep_left) ? x.size + ((Op::keep_right) ? y.size : 0) : ((x.size < y.size) ? x.size : y.size);
+    if (n == 0)
+      return (c);
+    c.values = _alloc_values.allocate(n);
+    c.capacity = n;
+    c.card = c.size = _mergeArrays<Op>(x, y, c.values);
+    if (c.card == 0)
+      _freeData(c);
+    else if (c.card > Chunk::array_max) {
+      try {
+        _toBitmap(c);
+      } catch (...) {
+        _freeData(c);
+        throw ;
+      }
+    }
+    return (c);
+  }
+  // Walks two sorted arrays at once, writing to out unless it is nullptr, and
+  // returns how many values the result has. An intersection of a small array
+  // with a much larger one gallops through the larger one instead.
+  template < class Op >
+  static uint32_t _mergeArrays ( const Chunk & x, const Chunk & y, uint16_t * out )
+  {
+    uint32_t i = 0, j = 0, n = 0;
+    const bool keep_equal = Op::keep_right || !Op::keep_left;
+    if (!Op::keep_left && !Op::keep_right && (x.size > 64 * y.size || y.size > 64 * x.size)) {
+      const Chunk & small = (x.size < y.size) ? x : y, & large = (x.size < y.size) ? y : x;
+      for (; i < small.size && j < large.size; ++i) {
+        uint16_t v = small.values[i];
+        uint32_t step = 1;
+        while (j + step < large.size && large.values[j + step] < v)
+          step *= 2;
+        uint32_t lo = j, hi = (j + step < large.size) ? j + step + 1 : large.size;
+        while (lo < hi) {
+          uint32_t mid = (lo + hi) / 2;
+          if (large.values[mid] < v) lo = mid + 1;
+          else hi = mid;
+        }
+        j = lo;
+        if (j < large.size && large.values[j] == v) {
+          if (out) out[n] = v;
+          ++n;
+        }
+      }
+      return (n);
+    }
+    while (i < x.size && j < y.size) {
+      if (x.values[i] < y.values[j]) {
+        if (Op::keep_left) { if (out) out[n] = x.values[i]; ++n; }
+        ++i;
+      } else if (y.values[j] < x.values[i]) {
+        if (Op::keep_right) { if (out) out[n] = y.values[j]; ++n; }
+        ++j;
+      } else {
+        if (keep_equal) { if (out) out[n] = x.values[i]; ++n; }
+        ++i;
+        ++j;
+      }
+    }
+    for (; Op::keep_left && i < x.size; ++i, ++n)
+      if (out) out[n] = x.values[i];
+    for (; Op::keep_right && j < y.size; ++j, ++n)
+      if (out) out[n] = y.values[j];
+    return (n);
+  }
+};
+
+// ---------------- Set Algebra ----------------
+// The overloads of set_algebra.hpp for roaring_set. The result replaces the
+// content of `result`, which may be one of the operands.
+
+// [*] // void set_union ( const roaring_set& a, const roaring_set& b, roaring_set& result );
+// [*] // void set_intersection ( const roaring_set& a, const roaring_set& b, roaring_set& result );
+// [*] // void set_difference ( const roaring_set& a, const roaring_set& b, roaring_set& result );
+// [*] // size_type set_intersection_size ( const roaring_set& a, const roaring_set& b );
+template < class Alloc >
+void set_union ( const roaring_set<Alloc> & a, const roaring_set<Alloc> & b, roaring_set<Alloc> & result )
+{ roaring_set<Alloc>::template combine<roaring_or>(a, b, result); }
+
+template < class Alloc >
+void set_intersection ( const roaring_set<Alloc> & a, const roaring_set<Alloc> & b, roaring_set<Alloc> & result )
+{ roaring_set<Alloc>::template combine<roaring_and>(a, b, result); }
+
+template < class Alloc >
+void set_difference ( const roaring_set<Alloc> & a, const roaring_set<Alloc> & b, roaring_set<Alloc> & result )
+{ roaring_set<Alloc>::template combine<roaring_andnot>(a, b, result); }
+
+template < class Alloc >
+typename roaring_set<Alloc>::size_type set_intersection_size ( const roaring_set<Alloc> & a, const roaring_set<Alloc> & b )
+{ return (roaring_set<Alloc>::intersection_size(a, b)); }
+
+template < class Alloc >
+void swap ( roaring_set<Alloc> & x, roaring_set<Alloc> & y )
+{
+  x.swap(y);
+}
+
+template < class Alloc >
+bool operator== ( const roaring_set<Alloc> & lhs, const roaring_set<Alloc> & rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class Alloc >
+bool operator!= ( const roaring_set<Alloc> & lhs, const roaring_set<Alloc> & rhs )
+{
+  return (!(lhs == rhs));
+}
+}
+
+#endif
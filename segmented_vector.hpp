@@ -0,0 +1,397 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segmented_vector.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SEGMENTED_VECTOR_HPP
+#define SEGMENTED_VECTOR_HPP
+
+#include "Iterators/iterator_segmented.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "vector.hpp"
+#include "utils.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// A vector made of 4KB chunks found through a table of chunk pointers, so
+// it grows without ever moving an element: push_back costs at most one chunk
+// allocation, plus copying the table (a pointer per chunk) when it doubles,
+// and references stay valid until their element is popped. Chunks emptied by
+// pop_back stay cached at the end of the table for the next pushes;
+// shrink_to_fit() frees them. As the container of a very deep stack:
+//   ft::stack< T, ft::segmented_vector<T> >
+template
+<
+typename T,
+class Allocator = std::allocator<T>
+>
+class segmented_vector {
+public:
+  typedef T                                        value_type;
+  typedef Allocator                                allocator_type;
+  typedef typename allocator_type::size_type       size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef typename allocator_type::reference       reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer         pointer;
+  typedef typename allocator_type::const_pointer   const_pointer;
+
+  static const size_type chunk_size = (sizeof(T) < 4096) ? 4096 / sizeof(T) : 1;
+
+  typedef ft::iterator_segmented<value_type, chunk_size>        iterator;
+  typedef ft::iterator_segmented<const value_type, chunk_size>  const_iterator;
+  typedef ft::reverse_iterator<iterator>                        reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>                  const_reverse_iterator;
+
+private:
+  typedef typename allocator_type::template rebind<pointer>::other  allocator_table_type;
+
+  allocator_type                        _alloc;
+  ft::vector<pointer, allocator_table_type> _chunks; // In use, then cached.
+  size_type                             _size;
+  pointer                               _top;    // One past the last element, in its chunk; nullptr when empty.
+  pointer                               _topEnd; // The end of that chunk.
+  size_type                             _topChunk;
+
+  void boundChecking(const size_type& n) const
+  {
+    if (n >= this->size())
+      throw ( std::out_of_range ( "segmented_vector" ) );
+  }
+
+public:
+
+  // ==========================>> Constructors <<==========================
+
+  // [*] // segmented_vector ();
+  // [*] // explicit segmented_vector ( const Allocator& alloc );
+  // [*] // explicit segmented_vector ( size_type count, const T& value = T(), const Allocator& alloc = Allocator());
+  // [*] // template< class InputIt > segmented_vector ( InputIt first, InputIt last, const Allocator& alloc = Allocator() );
+  // [*] // segmented_vector ( const segmented_vector& other );
+  segmented_vector ( )
+    : _alloc(allocator_type()), _chunks(allocator_table_type(_alloc)),
+    _size(0), _top(nullptr), _topEnd(nullptr), _topChunk(0)
+  { }
+  explicit segmented_vector ( const allocator_type& alloc )
+    : _alloc(alloc), _chunks(allocator_table_type(alloc)),
+    _size(0), _top(nullptr), _topEnd(nullptr), _topChunk(0)
+  { }
+  explicit segmented_vector ( size_type count, const_reference val = value_type(), const allocator_type& alloc = allocator_type() )
+    : _alloc(alloc), _chunks(allocator_table_type(alloc)),
+    _size(0), _top(nullptr), _topEnd(nullptr), _topChunk(0)
+  {
+    try {
+      this->assign(count, val);
+    } catch (...) {
+      this->_release();
+      throw ;
+    }
+  }
+  template< class InputIt >
+  segmented_vector ( InputIt first, InputIt last, const allocator_type& alloc = allocator_type(), SFINAAE(InputIt) )
+    : _alloc(alloc), _chunks(allocator_table_type(alloc)),
+    _size(0), _top(nullptr), _topEnd(nullptr), _topChunk(0)
+  {
+    try {
+      this->assign(first, last);
+    } catch (...) {
+      this->_release();
+      throw ;
+    }
+  }
+  segmented_vector ( const segmented_vector& other )
+    : _alloc(other._alloc), _chunks(allocator_table_type(other._alloc)),
+    _size(0), _top(nullptr), _topEnd(nullptr), _topChunk(0)
+  {
+    try {
+      this->assign(other.begin(), other.end());
+    } catch (...) {
+      this->_release();
+      throw ;
+    }
+  }
+
+  // ==========================>> Destructor <<==========================
+
+  // [*] // ~segmented_vector ();
+  ~segmented_vector ( ) { this->_release(); }
+
+  // ==========================>> Assignment <<==========================
+
+  // [*] // segmented_vector& operator= ( const segmented_vector& other );
+  segmented_vector& operator= ( const segmented_vector& other )
+  {
+    if (&other != this)
+      this->assign(other.begin(), other.end());
+    return (*this);
+  }
+  // [*] // void assign ( size_type count, const T& value );
+  // [*] // template< class InputIt > void assign ( InputIt first, InputIt last );
+  void assign ( size_type count, const_reference value )
+  {
+    value_type copy(value); // value may be one of ours.
+    this->clear();
+    while (count--)
+      this->push_back(copy);
+  }
+  template< class InputIt >
+  void assign ( InputIt first, InputIt last, SFINAAE(InputIt) )
+  {
+    this->clear();
+    while (first != last)
+      { this->push_back(*first); ++first; }
+  }
+  // [*] // allocator_type get_allocator () const;
+  allocator_type get_allocator ( void ) const { return ( _alloc ); }
+
+  // ==========================>> Element access <<==========================
+
+  // [*] // reference at ( size_type pos );
+  reference at ( size_type pos )
+  {
+    this->boundChecking(pos);
+    return ((*this)[pos]);
+  }
+  // [*] // const_reference at ( size_type pos ) const;
+  const_reference at ( size_type pos ) const
+  {
+    this->boundChecking(pos);
+    return ((*this)[pos]);
+  }
+  // [*] // reference operator[] ( size_type pos );
+  reference operator[] ( size_type pos ) { return (_chunks[pos / chunk_size][pos % chunk_size]); }
+  // [*] // const_reference operator[] ( size_type pos ) const;
+  const_reference operator[] ( size_type pos ) const { return (_chunks[pos / chunk_size][pos % chunk_size]); }
+  // [*] // reference front ();
+  reference front ( void ) { return (*_chunks[0]); }
+  // [*] // const_reference front () const;
+  const_reference front ( void ) const { return (*_chunks[0]); }
+  // [*] // reference back ();
+  reference back ( void ) { return (*(_top - 1)); }
+  // [*] // const_reference back () const;
+  const_reference back ( void ) const { return (*(_top - 1)); }
+
+  // ==========================>> Iterators <<==========================
+
+  // [*] // iterator begin ();
+  // [*] // const_iterator begin () const;
+  iterator begin ( void ) { return (iterator(_chunks.data(), 0)); }
+  const_iterator begin ( void ) const { return (const_iterator(_chunks.data(), 0)); }
+  // [*] // iterator end ();
+  // [*] // const_iterator end () const;
+  iterator end ( void ) { return (iterator(_chunks.data(), _size)); }
+  const_iterator end ( void ) const { return (const_iterator(_chunks.data(), _size)); }
+  // [*] // reverse_iterator rbegin ();
+  // [*] // const_reverse_iterator rbegin () const;
+  reverse_iterator rbegin ( void ) { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( void ) const { return (const_reverse_iterator(this->end())); }
+  // [*] // reverse_iterator rend ();
+  // [*] // const_reverse_iterator rend () const;
+  reverse_iterator rend ( void ) { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( void ) const { return (const_reverse_iterator(this->begin())); }
+
+  // ============================>> Capacity <<============================
+
+  // [*] // bool empty () const;
+  bool empty ( void ) const { return (_size == 0); }
+  // [*] // size_type size () const;
+  size_type size ( void ) const { return (_size); }
+  // [*] // size_type max_size () const;
+  size_type max_size ( void ) const { return (_alloc.max_size()); }
+  // [*] // size_type capacity () const;
+  size_type capacity ( void ) const { return (_chunks.size() * chunk_size); }
+  // [*] // void shrink_to_fit ();
+  void shrink_to_fit ( void ) // Frees the cached chunks.
+  {
+    size_type used = (_size + chunk_size - 1) / chunk_size;
+    while (_chunks.size() > used) {
+      _alloc.deallocate(_chunks.back(), chunk_size);
+      _chunks.pop_back();
+    }
+  }
+
+  // ========================>> Modifiers <<==========================
+
+  // [*] // void clear();
+  void clear ( void )
+  {
+    while (_size)
+      this->pop_back();
+  }
+  // [*] // void push_back( const T& value );
+  void push_back ( const_reference value )
+  {
+    if (_top == _topEnd)
+      _nextChunk();
+    _alloc.construct(_top, value);
+    ++_top;
+    ++_size;
+  }
+#if __cplusplus >= 201103L
+  // [*] // void push_back( T&& value );
+  void push_back ( value_type&& value ) { this->emplace_back(std::move(value)); }
+  // [*] // template< class... Args > void emplace_back( Args&&... args );
+  template< class... Args >
+  void emplace_back ( Args&&... args ) // No element moves, so args may be ours.
+  {
+    if (_top == _topEnd)
+      _nextChunk();
+    _alloc.construct(_top, std::forward<Args>(args)...);
+    ++_top;
+    ++_size;
+  }
+#endif
+  // [*] // template< class InputIt > void insert( iterator pos, InputIt first, InputIt last );
+  // Appends [first, last), then rotates it into place: no element moves at
+  // end(), as for push_back, and O(size()) swaps anywhere else. If a copy
+  // throws, nothing is inserted.
+  template< class InputIt >
+  void insert ( iterator pos, InputIt first, InputIt last, SFINAAE(InputIt) )
+  {
+    size_type at = pos - this->begin();
+    size_type old = _size;
+    try {
+      while (first != last)
+        { this->push_back(*first); ++first; }
+    } catch (...) {
+      while (_size > old)
+        this->pop_back();
+      throw ;
+    }
+    if (at != old) {
+      _reverse(at, old);
+      _reverse(old, _size);
+      _reverse(at, _size);
+    }
+  }
+  // [*] // void pop_back();
+  void pop_back ( void )
+  {
+    _alloc.destroy(--_top);
+    --_size;
+    if (_top == _chunks[_topChunk]) {
+      if (_topChunk == 0) {
+        _top = _topEnd = nullptr;
+      } else {
+        --_topChunk;
+        _top = _topEnd = _chunks[_topChunk] + chunk_size;
+      }
+    }
+  }
+  // [*] // void resize( size_type count, T value = T() );
+  void resize ( size_type count, value_type value = value_type() )
+  {
+    if (count > this->max_size())
+      throw (std::length_error("segmented_vector::resize"));
+    while (_size < count)
+      this->push_back(value);
+    while (_size > count)
+      this->pop_back();
+  }
+  // [*] // void swap( segmented_vector& other );
+  void swap ( segmented_vector& other )
+  {
+    if (this == &other)
+      return ;
+    allocator_type save_alloc = other._alloc;
+    size_type      save_size = other._size;
+    pointer        save_top = other._top;
+    pointer        save_topEnd = other._topEnd;
+    size_type      save_topChunk = other._topChunk;
+
+    other._alloc = _alloc;
+    other._size = _size;
+    other._top = _top;
+    other._topEnd = _topEnd;
+    other._topChunk = _topChunk;
+    _alloc = save_alloc;
+    _size = save_size;
+    _top = save_top;
+    _topEnd = save_topEnd;
+    _topChunk = save_topChunk;
+    _chunks.swap(other._chunks);
+  }
+
+private:
+  void _nextChunk ( void ) // The top chunk is full, or there is none.
+  {
+    size_type next = (_top == nullptr) ? 0 : _topChunk + 1;
+    if (next == _chunks.size()) {
+      pointer chunk = _alloc.allocate(chunk_size);
+      try {
+        _chunks.push_back(chunk);
+      } catch (...) {
+        _alloc.deallocate(chunk, chunk_size);
+        throw ;
+      }
+    }
+    _topChunk = next;
+    _top = _chunks[next];
+    _topEnd = _top + chunk_size;
+  }
+  void _reverse ( size_type first, size_type last ) // Reverses [first, last).
+  {
+    while (first + 1 < last)
+      std::swap((*this)[first++], (*this)[--last]);
+  }
+  void _release ( void )
+  {
+    this->clear();
+    this->shrink_to_fit();
+  }
+};
+
+template< class T, class Alloc >
+bool operator==( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class T, class Alloc >
+bool operator!=( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class T, class Alloc >
+bool operator<( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class T, class Alloc >
+bool operator>( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class T, class Alloc >
+bool operator<=( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class T, class Alloc >
+bool operator>=( const ft::segmented_vector<T,Alloc>& lhs, const ft::segmented_vector<T,Alloc>& rhs )
+{
+  return (!(lhs < rhs));
+}
+
+template< class T, class Alloc >
+void swap( ft::segmented_vector<T,Alloc>& lhs, ft::segmented_vector<T,Alloc>& rhs )
+{ lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,277 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   seqlock_map.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SEQLOCK_MAP_HPP
+#define SEQLOCK_MAP_HPP
+
+#include "red_black_tree.hpp"
+#include "utilities/epoch.hpp"
+
+namespace ft
+{
+// An ordered map for one writer and many readers, where the readers never
+// lock: a write bumps a sequence number to odd before touching the tree's
+// links and back to even after, and a read walks the tree optimistically and
+// retries when the number moved. Nodes and values are built before the
+// write section and never changed inside one (assign() swaps in a new node),
+// so a torn walk only ever meets whole nodes; unlinked nodes are reclaimed
+// through epochs, so it never meets freed ones either.
+// Writes must come from one thread at a time. Reads copy their results out.
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class seqlock_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  struct                                                value_compare;
+  typedef ft::published<ft::no_augment>                 policy_type; // Links are stored atomically.
+  typedef typename allocator_type::size_type            size_type;
+
+private:
+  typedef RedBlackTree<seqlock_map>                     tree_type;
+  typedef typename tree_type::Node                      Node;
+  typedef typename Node::allocator_node_type            allocator_node_type;
+  typedef ft::epoch_domain<Node, seqlock_map, Alloc>    domain_type;
+  typedef ft::epoch_guard<domain_type>                  guard_type;
+  typedef typename domain_type::record                  record_type;
+
+  friend class ft::epoch_domain<Node, seqlock_map, Alloc>;
+
+  static const int _maxDepth = 2 * 8 * sizeof(size_type); // Deeper means the walk was torn.
+
+  key_compare         _comp;
+  allocator_type      _alloc;
+  allocator_node_type _alloc_node;
+  tree_type           _tree;
+  unsigned long       _seq;
+  size_type           _size;
+  mutable domain_type _domain;
+
+  seqlock_map ( const seqlock_map & );
+  seqlock_map & operator= ( const seqlock_map & );
+
+public:
+  // [*] // explicit seqlock_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // ~seqlock_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit seqlock_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _alloc_node ( alloc )
+    , _tree ( _comp, _alloc )
+    , _seq ( 0 )
+    , _size ( 0 )
+    , _domain ( this, alloc )
+  { }
+  ~seqlock_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  bool      empty ( ) const { return (size() == 0); }
+  size_type size ( ) const  { return (atomic_load(&_size)); }
+
+  // ---------------- writer side ----------------
+  // [*] // bool insert ( const value_type& val );
+  // [*] // bool assign ( const key_type& k, const mapped_type& v );
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void clear ( );
+  bool insert ( const value_type& val ) // false when the key was already there.
+  {
+    if (_tree.find(val.first))
+      return (false);
+    Node * node = make_node<Node>(_alloc, _alloc_node, val);
+    _writeBegin();
+    _tree.link(node);
+    _writeEnd();
+    atomic_store(&_size, _size + 1);
+    return (true);
+  }
+  bool assign ( const key_type& k, const mapped_type& v ) // Insert or replace; true when inserted.
+  {
+    Node * old = _tree.find(k);
+    Node * node = make_node<Node>(_alloc, _alloc_node, value_type(k, v));
+    if (!old) {
+      _writeBegin();
+      _tree.link(node);
+      _writeEnd();
+      atomic_store(&_size, _size + 1);
+      return (true);
+    }
+    guard_type guard(_domain);
+    _writeBegin();
+    _tree.unlink(old);
+    _tree.link(node);
+    _writeEnd();
+    _domain.retire(guard.pin(), old);
+    return (false);
+  }
+  size_type erase ( const key_type& k )
+  {
+    Node * node = _tree.find(k);
+    if (!node)
+      return (0);
+    guard_type guard(_domain);
+    _writeBegin();
+    _tree.unlink(node);
+    _writeEnd();
+    _domain.retire(guard.pin(), node);
+    atomic_store(&_size, _size - 1);
+    return (1);
+  }
+  void clear ( )
+  {
+    guard_type guard(_domain);
+    _writeBegin();
+    Node * root = _tree.release();
+    _writeEnd();
+    _retireTree(guard.pin(), root);
+    atomic_store(&_size, size_type(0));
+  }
+
+  // ---------------- reader side ----------------
+  // [*] // bool find ( const key_type& k, mapped_type& value ) const;
+  // [*] // size_type count ( const key_type& k ) const;
+  // [*] // bool lower_bound ( const key_type& k, ft::pair<key_type, mapped_type>& element ) const;
+  // [*] // bool upper_bound ( const key_type& k, ft::pair<key_type, mapped_type>& element ) const;
+  bool find ( const key_type& k, mapped_type& value ) const
+  {
+    guard_type guard(_domain);
+    for (;;) {
+      unsigned long seq = _readBegin();
+      Node * node = _bound(k, false);
+      bool found = node && !_comp(k, node->_value->first);
+      if (found)
+        value = node->_value->second;
+      if (_readValid(seq))
+        return (found);
+    }
+  }
+  size_type count ( const key_type& k ) const
+  {
+    guard_type guard(_domain);
+    for (;;) {
+      unsigned long seq = _readBegin();
+      Node * node = _bound(k, false);
+      bool found = node && !_comp(k, node->_value->first);
+      if (_readValid(seq))
+        return (found);
+    }
+  }
+  bool lower_bound ( const key_type& k, ft::pair<key_type, mapped_type>& element ) const
+  { return (_copyBound(k, false, element)); }
+  bool upper_bound ( const key_type& k, ft::pair<key_type, mapped_type>& element ) const
+  { return (_copyBound(k, true, element)); }
+
+private:
+  // ---------------- sequence ----------------
+  void _writeBegin ( )
+  {
+    atomic_store(&_seq, _seq + 1);
+    atomic_fence(); // No link may change before the readers can see the odd number.
+  }
+  void _writeEnd ( ) { atomic_store(&_seq, _seq + 1); }
+  unsigned long _readBegin ( ) const
+  {
+    unsigned long seq;
+    while ((seq = atomic_load(&_seq)) & 1)
+      ;
+    return (seq);
+  }
+  bool _readValid ( unsigned long seq ) const { return (atomic_load(&_seq) == seq); }
+
+  // ---------------- optimistic walk ----------------
+  // The first node not less than k (greater than k when upper), as far as a
+  // walk that may be torn can tell; only a valid read may trust it.
+  Node * _bound ( const key_type & k, bool upper ) const
+  {
+    Node * node = atomic_load(_tree.base());
+    Node * bound = nullptr;
+    for (int depth = 0; node && depth < _maxDepth; ++depth) {
+      if (upper ? _comp(k, node->_value->first) : !_comp(node->_value->first, k)) {
+        bound = node;
+        node = atomic_load(&node->_left);
+      } else {
+        node = atomic_load(&node->_right);
+      }
+    }
+    return (bound);
+  }
+  bool _copyBound ( const key_type & k, bool upper, ft::pair<key_type, mapped_type> & element ) const
+  {
+    guard_type guard(_domain);
+    for (;;) {
+      unsigned long seq = _readBegin();
+      Node * node = _bound(k, upper);
+      if (node)
+        element = ft::pair<key_type, mapped_type>(node->_value->first, node->_value->second);
+      if (_readValid(seq))
+        return (node != nullptr);
+    }
+  }
+
+  // ---------------- reclamation ----------------
+  // An unlinked node has no parent, which the readers never follow anyway.
+  static Node *& limbo ( Node * node ) { return (node->_parent); }
+  void reclaim ( Node * node ) { remove_node<Node>(_alloc, _alloc_node, node); }
+  void _retireTree ( record_type * rec, Node * node )
+  {
+    while (node) {
+      Node * left = node->_left;
+      Node * right = node->_right;
+      atomic_store_relaxed(&node->_left, (Node *)nullptr); // A late reader may still be walking it.
+      atomic_store_relaxed(&node->_right, (Node *)nullptr);
+      _domain.retire(rec, node);
+      _retireTree(rec, left);
+      node = right;
+    }
+  }
+
+public:
+  struct value_compare {
+  public:
+    typedef bool result_type;
+
+    Compare comp;
+    value_compare (Compare c) : comp(c) {}
+
+    result_type operator() (const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+    result_type operator() (const key_type& x, const key_type& y) const {
+      return comp(x, y);
+    }
+    result_type operator() (const value_type& x, const key_type& y) const {
+      return comp(x.first, y);
+    }
+    result_type operator() (const key_type& x, const value_type& y) const {
+      return comp(x, y.first);
+    }
+  };
+};
+}
+
+#endif
@@ -14,8 +14,12 @@
 #define SET_HPP
 
 #include "Iterators/iterator_tree.hpp"
+#include "Iterators/iterator_vector.hpp"
 #include "Iterators/reverse_iterator.hpp"
 #include "red_black_tree.hpp"
+#include "node_handle.hpp"
+#include "frozen_set.hpp"
+#include <stdexcept>
 
 #define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
 
@@ -25,7 +29,8 @@ template
 <
 class T,
 class Compare = std::less<T>,
-class Alloc = std::allocator<T>
+class Alloc = std::allocator<T>,
+class Policy = ft::no_augment
 >
 class set {
 public:
@@ -35,6 +40,7 @@ public:
   typedef Alloc                                         allocator_type;
   typedef Compare                                       key_compare;
   typedef Compare                                       value_compare;
+  typedef Policy                                        policy_type;
   typedef typename allocator_type::reference            reference;
   typedef typename allocator_type::const_reference      const_reference;
   typedef typename allocator_type::pointer              pointer;
@@ -48,12 +54,20 @@ public:
   typedef ft::iterator_tree<const value_type, Node>     const_iterator;
   typedef ft::reverse_iterator<iterator>                reverse_iterator;
   typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+  typedef ft::node_handle<Node>                         node_type;
+  struct insert_return_type {
+    iterator  position;
+    bool      inserted;
+    node_type node; // The rejected node when the key was already there.
+  };
 
 private:
   key_compare         _comp;
   allocator_type      _alloc;
   RedBlackTree< set > _tree;
 
+  template < class > friend struct algebra_access; // Builds from sorted set algebra output.
+
 public:
   // [*] // explicit set ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
   // [*] // template <class InputIterator>  set ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
@@ -153,12 +167,12 @@ public:
   // [*] // void erase ( iterator first, iterator last );
   size_type erase ( const key_type& k )
   { return (_tree._erase(k)); }
-  void erase ( iterator position )
-  { _tree._erase((*position)); }
+  void erase ( iterator position ) // Unlinks the node itself, no search.
+  { _tree.erase(position.base()); }
   void erase ( iterator first, iterator last )
   {
     while (first != last) {
-      _tree._erase((*(first++)));
+      _tree.erase((first++).base());
     }
   }
 
@@ -169,6 +183,80 @@ public:
   // [*] // void clear ( );
   void clear ( ) { _tree.clear(); }
 
+  // [*] // void split_at ( const key_type& k, set& x );
+  // [*] // void append_ordered ( set& x );
+  // O(log n), no element is copied or reallocated. Without ft::subtree_size,
+  // the first size() afterwards walks the tree. x must be another set: a
+  // split into itself throws std::invalid_argument and changes nothing.
+  void split_at ( const key_type& k, set& x ) // Moves the keys not less than k into x, replacing its content.
+  {
+    if (&x == this)
+      throw (std::invalid_argument("set::split_at : cannot split into itself"));
+    _tree.split(k, x._tree);
+  }
+  void append_ordered ( set& x ) // Moves all of x to the end; its keys must be greater than ours.
+  {
+    if (!x._tree.smallest()) return ;
+    if (_tree.smallest() && !_comp(*(--this->end()), *x.begin()))
+      throw (std::invalid_argument("set::append_ordered : keys are not ordered"));
+    _tree.join(x._tree);
+  }
+
+  // [*] // template < class ForwardIterator > void assign_sorted ( ForwardIterator first, ForwardIterator last );
+  // [*] // void merge ( set& x );
+  template < class ForwardIterator >
+  void assign_sorted ( ForwardIterator first, ForwardIterator last ) // O(n); the keys must be strictly increasing.
+  {
+    size_type n = 0;
+    for (ForwardIterator prev = first, it = first; it != last; prev = it++, ++n)
+      if (n && !_comp(*prev, *it))
+        throw (std::invalid_argument("set::assign_sorted : keys are not strictly increasing"));
+    _tree.build(first, n);
+  }
+  void merge ( set& x ) // Moves in the keys of x that are not here yet, without copying them.
+  { _tree.merge(x._tree); }
+
+  // [*] // node_type extract ( iterator position );
+  // [*] // node_type extract ( const key_type& k );
+  // [*] // insert_return_type insert ( node_type nh );
+  // The nodes are relinked as they are, nothing is allocated or copied.
+  node_type extract ( iterator position )
+  { return (node_type(_tree.unlink(position.base()), _alloc)); }
+  node_type extract ( const key_type& k )
+  {
+    Node * node = _tree.find(k);
+    if (node == nullptr)
+      return (node_type());
+    return (node_type(_tree.unlink(node), _alloc));
+  }
+  insert_return_type insert ( node_type nh )
+  {
+    insert_return_type result;
+    result.position = end();
+    result.inserted = false;
+    if (nh.empty())
+      return (result);
+    result.position = find(nh.value());
+    if (result.position != end()) {
+      result.node = nh;
+      return (result);
+    }
+    result.position = iterator(_tree.base(), _tree.link(nh.release()));
+    result.inserted = true;
+    return (result);
+  }
+
+  // [*] // void compact ( );
+  // Moves every element into one contiguous block laid out for searching
+  // (van Emde Boas order), to undo the scattering left by many inserts and
+  // erases. O(n), invalidates iterators; the set stays mutable.
+  void compact ( ) { _tree.compact(); }
+
+  // [*] // frozen_set freeze ( ) const;
+  // A read-only copy for tables that are built once and then only searched.
+  ft::frozen_set<T,Compare,Alloc> freeze ( ) const
+  { return (ft::frozen_set<T,Compare,Alloc>(begin(), end(), _comp, _alloc)); }
+
   // [*] // iterator find (const key_type& k);
   // [*] // const_iterator find (const key_type& k) const;
   // [*] // size_type count( const key_type& k ) const;
@@ -260,40 +348,57 @@ public:
   { return (ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
   pair<const_iterator,const_iterator> equal_range (const key_type& k) const
   { return (ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+  // [*] // size_type rank ( const key_type& k ) const;
+  // [*] // iterator select ( size_type i );
+  // [*] // const_iterator select ( size_type i ) const;
+  // [*] // size_type count_range ( const key_type& lo, const key_type& hi ) const;
+  // Order statistics, O(log n). They need ft::subtree_size as the Policy.
+  size_type rank ( const key_type& k ) const
+  { return (_tree.rank(k)); }
+  iterator select ( size_type i )
+  { return (iterator(_tree.base(), _tree.select(i))); }
+  const_iterator select ( size_type i ) const
+  { return (const_iterator(_tree.base(), _tree.select(i))); }
+  size_type count_range ( const key_type& lo, const key_type& hi ) const // Elements in [lo, hi).
+  {
+    if (!_comp(lo, hi)) return (0);
+    return (_tree.rank(hi) - _tree.rank(lo));
+  }
 };
 
-template< class T, class Compare, class Alloc >
-void swap (set<T,Compare,Alloc>& x, set<T,Compare,Alloc>& y)
+template< class T, class Compare, class Alloc, class Policy >
+void swap (set<T,Compare,Alloc,Policy>& x, set<T,Compare,Alloc,Policy>& y)
 {
   x.swap(y);
 }
 
-template< class T, class Compare, class Alloc >
-bool operator==( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator==( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
   if (lhs.size() != rhs.size()) return (false);
-  typedef typename ft::set<T,Compare,Alloc>::const_iterator const_iterator;
+  typedef typename ft::set<T,Compare,Alloc,Policy>::const_iterator const_iterator;
   const_iterator lbIt = lhs.begin();
   const_iterator leIt = lhs.end();
   const_iterator rbIt = rhs.begin();
   return (ft::equal(lbIt, leIt, rbIt));
 }
 
-template< class T, class Compare, class Alloc >
-bool operator!=( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator!=( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
   if (lhs.size() != rhs.size()) return (true);
-  typedef typename ft::set<T,Compare,Alloc>::const_iterator const_iterator;
+  typedef typename ft::set<T,Compare,Alloc,Policy>::const_iterator const_iterator;
   const_iterator lbIt = lhs.begin();
   const_iterator leIt = lhs.end();
   const_iterator rbIt = rhs.begin();
   return (!ft::equal(lbIt, leIt, rbIt));
 }
 
-template< class T, class Compare, class Alloc >
-bool operator<( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator<( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
-  typedef typename ft::set<T,Compare,Alloc>::const_iterator const_iterator;
+  typedef typename ft::set<T,Compare,Alloc,Policy>::const_iterator const_iterator;
   const_iterator lbIt = lhs.begin();
   const_iterator leIt = lhs.end();
   const_iterator rbIt = rhs.begin();
@@ -301,10 +406,10 @@ bool operator<( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,All
   return (ft::lexicographical_compare(lbIt, leIt, rbIt, reIt) && lhs != rhs);
 }
 
-template< class T, class Compare, class Alloc >
-bool operator>( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator>( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
-  typedef typename ft::set<T,Compare,Alloc>::const_iterator const_iterator;
+  typedef typename ft::set<T,Compare,Alloc,Policy>::const_iterator const_iterator;
   const_iterator lbIt = lhs.begin();
   const_iterator leIt = lhs.end();
   const_iterator rbIt = rhs.begin();
@@ -312,14 +417,14 @@ bool operator>( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,All
   return (!ft::lexicographical_compare(lbIt, leIt, rbIt, reIt) && lhs != rhs);
 }
 
-template< class T, class Compare, class Alloc >
-bool operator<=( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator<=( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
   return (lhs < rhs || lhs == rhs);
 }
 
-template< class T, class Compare, class Alloc >
-bool operator>=( const ft::set<T,Compare,Alloc>& lhs, const ft::set<T,Compare,Alloc>& rhs )
+template< class T, class Compare, class Alloc, class Policy >
+bool operator>=( const ft::set<T,Compare,Alloc,Policy>& lhs, const ft::set<T,Compare,Alloc,Policy>& rhs )
 {
   return (lhs > rhs || lhs == rhs);
 }
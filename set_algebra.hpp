@@ -0,0 +1,299 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set_algebra.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SET_ALGEBRA_HPP
+#define SET_ALGEBRA_HPP
+
+#include "map.hpp"
+#include "set.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+// ---------------- Set Operation Iterator ----------------
+// Walks two sorted ranges at once and stops on the elements of their union,
+// intersection or difference. Equal elements are taken from the first range.
+template < class Iterator, class Compare >
+class set_operation_iterator : public ft::iterator< std::forward_iterator_tag, const typename Iterator::value_type > {
+public:
+  enum operation { UNION, INTERSECTION, DIFFERENCE };
+
+  typedef const typename Iterator::value_type & reference;
+
+private:
+  operation _op;
+  Iterator  _first1, _last1, _first2, _last2;
+  Compare   _comp;
+  bool      _fromFirst;
+
+public:
+  set_operation_iterator ( operation op, Iterator first1, Iterator last1, Iterator first2, Iterator last2, Compare comp )
+    : _op(op), _first1(first1), _last1(last1), _first2(first2), _last2(last2), _comp(comp), _fromFirst(true)
+  { _settle(); }
+
+  reference operator* ( ) const { return ((_fromFirst) ? *_first1 : *_first2); }
+  Iterator  base ( ) const { return ((_fromFirst) ? _first1 : _first2); } // Where *this reads from.
+
+  set_operation_iterator & operator++ ( )
+  {
+    if (_op == UNION && _fromFirst == false) {
+      ++_first2;
+    } else {
+      if (_op != DIFFERENCE && _first2 != _last2 && !_comp(*_first1, *_first2)) // equal, skip both
+        ++_first2;
+      ++_first1;
+    }
+    _settle();
+    return (*this);
+  }
+  set_operation_iterator operator++ ( int )
+  {
+    set_operation_iterator tmp(*this);
+    ++(*this);
+    return (tmp);
+  }
+
+  bool operator== ( const set_operation_iterator & x ) const { return (_first1 == x._first1 && _first2 == x._first2); }
+  bool operator!= ( const set_operation_iterator & x ) const { return (!(*this == x)); }
+
+private:
+  void _settle ( void ) // Moves to the next element of the result, or to (last1, last2).
+  {
+    if (_op == UNION) {
+      _fromFirst = (_first2 == _last2) || (_first1 != _last1 && !_comp(*_first2, *_first1));
+      return ;
+    }
+    while (_first1 != _last1 && _first2 != _last2) {
+      if (_comp(*_first1, *_first2)) {
+        if (_op == DIFFERENCE) return ;
+        ++_first1;
+      } else if (_comp(*_first2, *_first1)) {
+        ++_first2;
+      } else {
+        if (_op == INTERSECTION) return ;
+        ++_first1; ++_first2;
+      }
+    }
+    if (_op == INTERSECTION || _first1 == _last1) {
+      _first1 = _last1;
+      _first2 = _last2;
+    }
+  }
+};
+
+// ---------------- Dereference Iterator ----------------
+// Reads through a range of iterators.
+template < class Iterator >
+class dereference_iterator : public ft::iterator< std::forward_iterator_tag, const typename Iterator::value_type::value_type > {
+public:
+  typedef const typename Iterator::value_type::value_type & reference;
+
+private:
+  Iterator _it;
+
+public:
+  dereference_iterator ( Iterator it ) : _it(it) { }
+
+  reference operator* ( ) const { return (**_it); }
+  dereference_iterator & operator++ ( ) { ++_it; return (*this); }
+  dereference_iterator operator++ ( int ) { dereference_iterator tmp(*this); ++_it; return (tmp); }
+  bool operator== ( const dereference_iterator & x ) const { return (_it == x._it); }
+  bool operator!= ( const dereference_iterator & x ) const { return (_it != x._it); }
+};
+
+// ---------------- Keys ----------------
+template < class Key, class Compare, class Alloc, class Policy >
+const Key & algebra_key ( const set<Key,Compare,Alloc,Policy> &, const Key & value )
+{ return (value); }
+template < class Key, class T, class Compare, class Alloc, class Policy >
+const Key & algebra_key ( const map<Key,T,Compare,Alloc,Policy> &, const typename map<Key,T,Compare,Alloc,Policy>::value_type & value )
+{ return (value.first); }
+
+// The lower bound of k in c, found from the lower bound of an earlier key
+// instead of from the root: climb until the subtree holds k, then descend.
+// Over m increasing keys, the walks only cover the union of their search
+// paths, O(m log(n / m + 1)) for a balanced tree of n. Start from begin().
+template < class Container >
+typename Container::const_iterator algebra_seek ( const Container & c, typename Container::const_iterator finger, const typename Container::key_type & k )
+{
+  typedef typename Container::const_iterator::nodePointer nodePointer;
+
+  typename Container::key_compare comp = c.key_comp();
+  nodePointer node = finger.base();
+  nodePointer found = nullptr;
+  if (node == nullptr)
+    return (finger); // Past the largest key already.
+  if (comp(algebra_key(c, *node->_value), k)) {
+    while (node->_parent) {
+      if (!node->_isRight && comp(k, algebra_key(c, *node->_parent->_value))) {
+        found = node->_parent;
+        break;
+      }
+      node = node->_parent;
+    }
+  }
+  while (node) {
+    if (comp(algebra_key(c, *node->_value), k)) {
+      node = node->_right;
+    } else {
+      found = node;
+      node = node->_left;
+    }
+  }
+  return (typename Container::const_iterator(finger.baseRoot(), found));
+}
+
+// Finger searches for m elements in a tree of n cost about m log(n / m),
+// against n + m for walking both.
+template < class Size >
+bool algebra_search_is_cheaper ( Size small, Size large )
+{
+  if (small == 0)
+    return (true);
+  Size log = 0;
+  for (Size n = large / small; n > 1; n >>= 1) ++log;
+  return (small * (log + 1) < large);
+}
+
+// map and set let these build their tree from output that is sorted by
+// construction, without the check assign_sorted makes on user ranges.
+template < class Container >
+struct algebra_access {
+  template < class InputIterator >
+  static void build ( Container & c, InputIterator first, typename Container::size_type n )
+  { c._tree.build(first, n); }
+};
+
+template < class Container >
+void algebra_assign_found ( Container & result, const ft::vector<typename Container::const_iterator> & found, const Container & model )
+{
+  typedef dereference_iterator<typename ft::vector<typename Container::const_iterator>::const_iterator> iterator;
+
+  Container tmp(model.key_comp(), model.get_allocator()); // result may be one of the operands
+  algebra_access<Container>::build(tmp, iterator(found.begin()), found.size());
+  result.swap(tmp);
+}
+
+// One walk of the operation, keeping where each output element lives: the
+// build needs the count first, and walking again would redo every compare.
+template < class Container >
+void algebra_assign ( Container & result, typename Container::const_iterator first, typename Container::const_iterator last,
+                      typename set_operation_iterator<typename Container::const_iterator, typename Container::value_compare>::operation op,
+                      typename Container::const_iterator first2, typename Container::const_iterator last2,
+                      const Container & model )
+{
+  typedef set_operation_iterator<typename Container::const_iterator, typename Container::value_compare> iterator;
+
+  ft::vector<typename Container::const_iterator> found;
+  iterator end(op, last, last, last2, last2, model.value_comp());
+  for (iterator it(op, first, last, first2, last2, model.value_comp()); it != end; ++it)
+    found.push_back(it.base());
+  algebra_assign_found(result, found, model);
+}
+
+// ---------------- Set Algebra ----------------
+// For ft::set and ft::map. The result replaces the content of `result`, which
+// may be one of the operands, and is built in O(n) from the sorted output.
+// Equal keys take their element from `a`. When one side is much smaller, its
+// elements are finger searched in the other instead of walking both.
+
+// [*] // void set_union ( const Container& a, const Container& b, Container& result );
+template < class Container >
+void set_union ( const Container & a, const Container & b, Container & result )
+{
+  typedef set_operation_iterator<typename Container::const_iterator, typename Container::value_compare> iterator;
+  algebra_assign(result, a.begin(), a.end(), iterator::UNION, b.begin(), b.end(), a);
+}
+
+// [*] // void set_intersection ( const Container& a, const Container& b, Container& result );
+template < class Container >
+void set_intersection ( const Container & a, const Container & b, Container & result )
+{
+  typedef typename Container::const_iterator                               const_iterator;
+  typedef set_operation_iterator<const_iterator, typename Container::value_compare> iterator;
+
+  typename Container::key_compare comp = a.key_comp();
+  if (algebra_search_is_cheaper(a.size(), b.size())) {
+    ft::vector<const_iterator> found;
+    const_iterator finger = b.begin();
+    for (const_iterator it = a.begin(); it != a.end() && finger != b.end(); ++it) {
+      finger = algebra_seek(b, finger, algebra_key(a, *it));
+      if (finger != b.end() && !comp(algebra_key(a, *it), algebra_key(b, *finger)))
+        found.push_back(it);
+    }
+    algebra_assign_found(result, found, a);
+  } else if (algebra_search_is_cheaper(b.size(), a.size())) {
+    ft::vector<const_iterator> found;
+    const_iterator finger = a.begin();
+    for (const_iterator it = b.begin(); it != b.end() && finger != a.end(); ++it) {
+      finger = algebra_seek(a, finger, algebra_key(b, *it));
+      if (finger != a.end() && !comp(algebra_key(b, *it), algebra_key(a, *finger)))
+        found.push_back(finger);
+    }
+    algebra_assign_found(result, found, a);
+  } else {
+    algebra_assign(result, a.begin(), a.end(), iterator::INTERSECTION, b.begin(), b.end(), a);
+  }
+}
+
+// [*] // void set_difference ( const Container& a, const Container& b, Container& result );
+template < class Container >
+void set_difference ( const Container & a, const Container & b, Container & result )
+{
+  typedef typename Container::const_iterator                               const_iterator;
+  typedef set_operation_iterator<const_iterator, typename Container::value_compare> iterator;
+
+  if (algebra_search_is_cheaper(a.size(), b.size())) {
+    typename Container::key_compare comp = a.key_comp();
+    ft::vector<const_iterator> found;
+    const_iterator finger = b.begin();
+    for (const_iterator it = a.begin(); it != a.end(); ++it) {
+      finger = algebra_seek(b, finger, algebra_key(a, *it));
+      if (finger == b.end() || comp(algebra_key(a, *it), algebra_key(b, *finger)))
+        found.push_back(it);
+    }
+    algebra_assign_found(result, found, a);
+  } else {
+    algebra_assign(result, a.begin(), a.end(), iterator::DIFFERENCE, b.begin(), b.end(), a);
+  }
+}
+
+// [*] // bool includes ( const Container& a, const Container& b );
+template < class Container >
+bool includes ( const Container & a, const Container & b ) // Every key of b is in a.
+{
+  typedef typename Container::const_iterator const_iterator;
+
+  if (b.size() > a.size())
+    return (false);
+  typename Container::value_compare comp = a.value_comp();
+  if (algebra_search_is_cheaper(b.size(), a.size())) {
+    const_iterator finger = a.begin();
+    for (const_iterator it = b.begin(); it != b.end(); ++it) {
+      finger = algebra_seek(a, finger, algebra_key(b, *it));
+      if (finger == a.end() || comp(*it, *finger))
+        return (false);
+    }
+    return (true);
+  }
+  const_iterator it = a.begin();
+  for (const_iterator it2 = b.begin(); it2 != b.end(); ++it2) {
+    while (it != a.end() && comp(*it, *it2)) ++it;
+    if (it == a.end() || comp(*it2, *it))
+      return (false);
+    ++it;
+  }
+  return (true);
+}
+}
+
+#endif
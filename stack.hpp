@@ -14,6 +14,7 @@
 #define STACK_HPP
 
 #include "vector.hpp"
+#include <utility>
 
 namespace ft
 {
@@ -62,9 +63,51 @@ public:
   void push ( const value_type& val )
   { _c.push_back( val ); }
 
+  // Pushes [first, last) in order, so *--last ends on top, with a single
+  // range insert: one reservation instead of a capacity check per element.
+  // The container needs insert ( iterator, InputIt, InputIt ).
+  template < class InputIt >
+  void push_range ( InputIt first, InputIt last )
+  { _c.insert( _c.end(), first, last ); }
+
   void pop()
   { _c.pop_back(); }
 
+  // Hands the top n elements to out, the top first, as n top()/pop() would.
+  template < class OutputIt >
+  OutputIt pop_n ( size_type n, OutputIt out )
+  {
+    for (; n; --n, ++out) {
+#if __cplusplus >= 201103L
+      *out = std::move( _c.back() );
+#else
+      *out = _c.back();
+#endif
+      _c.pop_back();
+    }
+    return ( out );
+  }
+
+  value_type pop_value ( )
+  {
+#if __cplusplus >= 201103L
+    value_type val( std::move( _c.back() ) );
+#else
+    value_type val( _c.back() );
+#endif
+    _c.pop_back();
+    return ( val );
+  }
+
+#if __cplusplus >= 201103L
+  void push ( value_type&& val )
+  { _c.push_back( std::move( val ) ); }
+
+  template < class... Args >
+  void emplace ( Args&&... args )
+  { _c.emplace_back( std::forward<Args>( args )... ); }
+#endif
+
   void swap ( stack & x )
   { _c.swap(x._c); }
 
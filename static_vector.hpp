@@ -0,0 +1,373 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_VECTOR_HPP
+#define STATIC_VECTOR_HPP
+
+#include "Iterators/iterator_vector.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "utils.hpp"
+#include "utilities/aligned_storage.hpp"
+#include <stdexcept>
+#include <new>
+#include <utility>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// A vector whose N slots live inside the object: it never allocates, and
+// growing past N throws std::length_error instead. Iterators are plain
+// iterator_vector pointers. As the container of a stack of known depth:
+//   ft::stack< T, ft::static_vector<T, 256> >
+template
+<
+typename T,
+std::size_t N
+>
+class static_vector {
+public:
+  typedef T                                        value_type;
+  typedef std::size_t                              size_type;
+  typedef std::ptrdiff_t                           difference_type;
+  typedef value_type &                             reference;
+  typedef const value_type &                       const_reference;
+  typedef value_type *                             pointer;
+  typedef const value_type *                       const_pointer;
+  typedef ft::iterator_vector<value_type>          iterator;
+  typedef ft::iterator_vector<const value_type>    const_iterator;
+  typedef ft::reverse_iterator<iterator>           reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+private:
+  ft::aligned_storage<value_type, N>  _storage;
+  size_type                           _size;
+
+  pointer       _start ( void )       { return (_storage.data()); }
+  const_pointer _start ( void ) const { return (_storage.data()); }
+
+  void boundChecking(const size_type& n) const
+  {
+    if (n >= this->size())
+      throw ( std::out_of_range ( "static_vector" ) );
+  }
+  void capacityChecking(const size_type& n, const char * what) const
+  {
+    if (n > N)
+      throw ( std::length_error ( what ) );
+  }
+  // Opens count slots at pos and fills them from src, stepping by step
+  // (0 repeats *src). Like erase, it assigns over live slots and only
+  // constructs past the end, counting each one into _size at once: a copy
+  // that throws leaves every slot below _size alive and none above it.
+  void _insert ( pointer pos, size_type count, const_pointer src, size_type step )
+  {
+    pointer end = _start() + _size;
+    size_type tail = end - pos;
+
+    if (tail > count) {
+      for (pointer ptr = end - count; ptr != end; ++ptr)
+        { new (ptr + count) value_type(*ptr); ++_size; }
+      for (pointer ptr = end - count; ptr != pos; )
+        { --ptr; ptr[count] = *ptr; }
+      for (size_type i = 0; i < count; ++i)
+        pos[i] = src[i * step];
+    }
+    else {
+      for (size_type i = tail; i < count; ++i)
+        { new (pos + i) value_type(src[i * step]); ++_size; }
+      for (pointer ptr = pos; ptr != end; ++ptr)
+        { new (ptr + count) value_type(*ptr); ++_size; }
+      for (size_type i = 0; i < tail; ++i)
+        pos[i] = src[i * step];
+    }
+  }
+
+public:
+
+  // ==========================>> Constructors <<==========================
+
+  // [*] // static_vector ();
+  // [*] // explicit static_vector ( size_type count, const T& value = T() );
+  // [*] // template< class InputIt > static_vector ( InputIt first, InputIt last );
+  // [*] // static_vector ( const static_vector& other );
+  static_vector ( )
+    : _size(0)
+  { }
+  explicit static_vector ( size_type count, const_reference val = value_type() )
+    : _size(0)
+  {
+    this->assign(count, val);
+  }
+  template< class InputIt >
+  static_vector ( InputIt first, InputIt last, SFINAAE(InputIt) )
+    : _size(0)
+  {
+    try {
+      this->assign(first, last);
+    } catch (...) {
+      this->clear();
+      throw ;
+    }
+  }
+  static_vector ( const static_vector& other )
+    : _size(0)
+  {
+    try {
+      this->assign(other.begin(), other.end());
+    } catch (...) {
+      this->clear();
+      throw ;
+    }
+  }
+
+  // ==========================>> Destructor <<==========================
+
+  // [*] // ~static_vector ();
+  ~static_vector ( ) { this->clear(); }
+
+  // ==========================>> Assignment <<==========================
+
+  // [*] // static_vector& operator= ( const static_vector& other );
+  static_vector& operator= ( const static_vector& other )
+  {
+    if (&other != this)
+      this->assign(other.begin(), other.end());
+    return (*this);
+  }
+  // [*] // void assign ( size_type count, const T& value );
+  // [*] // template< class InputIt > void assign ( InputIt first, InputIt last );
+  void assign ( size_type count, const_reference value )
+  {
+    this->capacityChecking(count, "static_vector::assign");
+    this->clear();
+    while (count--)
+      this->push_back(value);
+  }
+  template< class InputIt >
+  void assign ( InputIt first, InputIt last, SFINAAE(InputIt) )
+  {
+    this->clear();
+    while (first != last)
+      { this->push_back(*first); ++first; }
+  }
+
+  // ==========================>> Element access <<==========================
+
+  // [*] // reference at ( size_type pos );
+  reference at ( size_type pos )
+  {
+    this->boundChecking(pos);
+    return ((*this)[pos]);
+  }
+  // [*] // const_reference at ( size_type pos ) const;
+  const_reference at ( size_type pos ) const
+  {
+    this->boundChecking(pos);
+    return ((*this)[pos]);
+  }
+  // [*] // reference operator[] ( size_type pos );
+  reference operator[] ( size_type pos ) { return (_start()[pos]); }
+  // [*] // const_reference operator[] ( size_type pos ) const;
+  const_reference operator[] ( size_type pos ) const { return (_start()[pos]); }
+  // [*] // reference front ();
+  reference front ( void ) { return (_start()[0]); }
+  // [*] // const_reference front () const;
+  const_reference front ( void ) const { return (_start()[0]); }
+  // [*] // reference back ();
+  reference back ( void ) { return (_start()[_size - 1]); }
+  // [*] // const_reference back () const;
+  const_reference back ( void ) const { return (_start()[_size - 1]); }
+  // [*] // value_type* data ();
+  pointer data ( void ) { return (_start()); }
+  // [*] // const value_type* data () const;
+  const_pointer data ( void ) const { return (_start()); }
+
+  // ==========================>> Iterators <<==========================
+
+  // [*] // iterator begin ();
+  // [*] // const_iterator begin () const;
+  iterator begin ( void ) { return (iterator(_start())); }
+  const_iterator begin ( void ) const { return (const_iterator(_start())); }
+  // [*] // iterator end ();
+  // [*] // const_iterator end () const;
+  iterator end ( void ) { return (iterator(_start() + _size)); }
+  const_iterator end ( void ) const { return (const_iterator(_start() + _size)); }
+  // [*] // reverse_iterator rbegin ();
+  // [*] // const_reverse_iterator rbegin () const;
+  reverse_iterator rbegin ( void ) { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin ( void ) const { return (const_reverse_iterator(this->end())); }
+  // [*] // reverse_iterator rend ();
+  // [*] // const_reverse_iterator rend () const;
+  reverse_iterator rend ( void ) { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend ( void ) const { return (const_reverse_iterator(this->begin())); }
+
+  // ============================>> Capacity <<============================
+
+  // [*] // bool empty () const;
+  bool empty ( void ) const { return (_size == 0); }
+  // [*] // bool full () const;
+  bool full ( void ) const { return (_size == N); }
+  // [*] // size_type size () const;
+  size_type size ( void ) const { return (_size); }
+  // [*] // size_type max_size () const;
+  size_type max_size ( void ) const { return (N); }
+  // [*] // void reserve ( size_type new_cap );
+  void reserve ( size_type new_cap ) { this->capacityChecking(new_cap, "static_vector::reserve"); }
+  // [*] // size_type capacity () const;
+  size_type capacity ( void ) const { return (N); }
+
+  // ========================>> Modifiers <<==========================
+
+  // [*] // void clear();
+  void clear ( void )
+  {
+    while (_size)
+      _start()[--_size].~value_type();
+  }
+  // [*] // iterator insert (iterator position, const value_type& val);
+  // [*] // void insert (iterator position, size_type n, const value_type& val);
+  // [*] // template <class InputIterator> void insert (iterator position, InputIterator first, InputIterator last);
+  iterator insert ( iterator pos, const_reference value )
+  {
+    difference_type offset = pos - this->begin();
+    this->insert(pos, 1, value);
+    return (this->begin() + offset);
+  }
+  void insert ( iterator pos, size_type count, const_reference value )
+  {
+    this->capacityChecking(_size + count, "static_vector::insert");
+    value_type copy(value); // value may be one of ours.
+    this->_insert(pos.base(), count, &copy, 0);
+  }
+  template< class InputIt >
+  void insert ( iterator pos, InputIt first, InputIt last, SFINAAE(InputIt) )
+  {
+    static_vector tmp(first, last);
+
+    this->capacityChecking(_size + tmp.size(), "static_vector::insert");
+    this->_insert(pos.base(), tmp.size(), tmp._start(), 1);
+  }
+  // [*] // iterator erase( iterator pos );
+  // [*] // iterator erase( iterator first, iterator last );
+  iterator erase ( iterator pos )
+  {
+    return (erase(pos, pos + 1));
+  }
+  iterator erase ( iterator first, iterator last )
+  {
+    pointer ptr_f = first.base();
+    pointer ptr_l = last.base();
+    pointer end = _start() + _size;
+    while (ptr_l < end)
+      { *ptr_f = *ptr_l; ptr_f++; ptr_l++; }
+    while (ptr_f < end)
+      (--end)->~value_type();
+    _size = end - _start();
+    return (first);
+  }
+  // [*] // void push_back( const T& value );
+  void push_back ( const_reference value )
+  {
+    if (_size == N)
+      throw (std::length_error("static_vector::push_back"));
+    new (_start() + _size) value_type(value);
+    ++_size;
+  }
+#if __cplusplus >= 201103L
+  // [*] // void push_back( T&& value );
+  void push_back ( value_type&& value ) { this->emplace_back(std::move(value)); }
+  // [*] // template< class... Args > void emplace_back( Args&&... args );
+  template< class... Args >
+  void emplace_back ( Args&&... args ) // Nothing moves, so args may be ours.
+  {
+    if (_size == N)
+      throw (std::length_error("static_vector::emplace_back"));
+    new (_start() + _size) value_type(std::forward<Args>(args)...);
+    ++_size;
+  }
+#endif
+  // [*] // void pop_back();
+  void pop_back ( void )
+  {
+    _start()[--_size].~value_type();
+  }
+  // [*] // void resize( size_type count, T value = T() );
+  void resize ( size_type count, value_type value = value_type() )
+  {
+    this->capacityChecking(count, "static_vector::resize");
+    while (_size < count)
+      this->push_back(value);
+    while (_size > count)
+      this->pop_back();
+  }
+  // [*] // void swap( static_vector& other );
+  // Swaps the elements themselves: O(N), not O(1) as for ft::vector.
+  void swap ( static_vector& other )
+  {
+    static_vector & shorter = (_size < other._size) ? *this : other;
+    static_vector & longer = (_size < other._size) ? other : *this;
+    size_type common = shorter._size;
+
+    for (size_type i = 0; i < common; ++i) {
+      value_type tmp(shorter[i]);
+      shorter[i] = longer[i];
+      longer[i] = tmp;
+    }
+    for (size_type i = common; i < longer._size; ++i)
+      shorter.push_back(longer[i]);
+    longer.erase(longer.begin() + common, longer.end());
+  }
+};
+
+template< class T, std::size_t N >
+bool operator==( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template< class T, std::size_t N >
+bool operator!=( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (!(lhs == rhs));
+}
+
+template< class T, std::size_t N >
+bool operator<( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template< class T, std::size_t N >
+bool operator>( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (rhs < lhs);
+}
+
+template< class T, std::size_t N >
+bool operator<=( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (!(rhs < lhs));
+}
+
+template< class T, std::size_t N >
+bool operator>=( const ft::static_vector<T,N>& lhs, const ft::static_vector<T,N>& rhs )
+{
+  return (!(lhs < rhs));
+}
+
+template< class T, std::size_t N >
+void swap( ft::static_vector<T,N>& lhs, ft::static_vector<T,N>& rhs )
+{ lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,315 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sum_map.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SUM_MAP_HPP
+#define SUM_MAP_HPP
+
+#include "Iterators/iterator_tree.hpp"
+#include "Iterators/reverse_iterator.hpp"
+#include "red_black_tree.hpp"
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// An ordered map whose nodes keep the sum of the mapped values of their
+// subtree, for prefix and range sums in O(log n). T needs T() as zero and a
+// commutative operator+.
+// The sums depend on the mapped values, so iterators are read-only: change a
+// value with assign().
+template
+<
+class Key,
+class T,
+class Compare = std::less<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class sum_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Alloc                                         allocator_type;
+  typedef Compare                                       key_compare;
+  struct                                                value_compare;
+  struct                                                sum;
+  typedef ft::monoid_augment<sum>                       policy_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+private:
+  typedef typename RedBlackTree<sum_map>::Node Node;
+public:
+  typedef ft::iterator_tree<const value_type, Node>     iterator;
+  typedef ft::iterator_tree<const value_type, Node>     const_iterator;
+  typedef ft::reverse_iterator<iterator>                reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+
+public:
+  struct value_compare {
+  public:
+    typedef bool result_type;
+
+    Compare comp;
+    value_compare (Compare c) : comp(c) {}
+
+    result_type operator() (const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+    result_type operator() (const key_type& x, const key_type& y) const {
+      return comp(x, y);
+    }
+    result_type operator() (const value_type& x, const key_type& y) const {
+      return comp(x.first, y);
+    }
+    result_type operator() (const key_type& x, const value_type& y) const {
+      return comp(x, y.first);
+    }
+  };
+  struct sum {
+    typedef mapped_type data_type;
+
+    static data_type identity ( ) { return (data_type()); }
+    static data_type lift ( const value_type & value ) { return (value.second); }
+    static data_type combine ( const data_type & lhs, const data_type & rhs ) { return (lhs + rhs); }
+  };
+
+private:
+  key_compare             _comp;
+  allocator_type          _alloc;
+  RedBlackTree< sum_map > _tree;
+
+public:
+  // [*] // explicit sum_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > sum_map ( InputIterator first, InputIterator last, ... );
+  // [*] // sum_map ( const sum_map& x );
+  // [*] // sum_map& operator=( const sum_map& other );
+  // [*] // ~sum_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit sum_map ( const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  { }
+  template < class InputIterator >
+  sum_map ( InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _comp ( comp )
+    , _alloc ( alloc )
+    , _tree ( _comp, _alloc )
+  {
+    while (first != last)
+      insert(*(first++));
+  }
+  sum_map ( const sum_map& x )
+    : _comp ( x._comp )
+    , _alloc ( x._alloc )
+    , _tree ( x._tree )
+  { }
+  sum_map& operator=( const sum_map& x )
+  {
+    _tree = x._tree;
+    return (*this);
+  }
+  ~sum_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // key_compare key_comp() const
+  // [*] // value_compare value_comp() const;
+  key_compare key_comp() const
+  {
+    return (_comp);
+  }
+  value_compare value_comp() const
+  {
+    return (_comp);
+  }
+
+  // [*] // const mapped_type& at (const key_type& k) const;
+  const mapped_type& at (const key_type& k) const
+  {
+    Node * findNode = _tree.find(k);
+    if ( findNode )
+      return (findNode->_value->second);
+    else
+      throw (std::out_of_range("sum_map::at : key not found"));
+  }
+
+  // [*] // const_iterator begin ( ) const;
+  // [*] // const_iterator end ( ) const;
+  // [*] // const_reverse_iterator rbegin ( ) const;
+  // [*] // const_reverse_iterator rend ( ) const;
+  const_iterator begin ( ) const { return (const_iterator(_tree.base(), _tree.smallest())); }
+  const_iterator end ( ) const   { return (const_iterator(_tree.base(), nullptr)); }
+
+  const_reverse_iterator rbegin ( ) const { return (const_reverse_iterator(this->end())); }
+  const_reverse_iterator rend ( ) const   { return (const_reverse_iterator(this->begin())); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_tree.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( iterator position, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  // [*] // iterator assign ( const key_type& k, const mapped_type& v );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    iterator it = find(val.first);
+    if ( it != end() )
+      return (ft::make_pair<iterator,bool>(it, false));
+    it = iterator(_tree.base(), _tree.add(val));
+    return (ft::make_pair<iterator,bool>(it, true));
+  }
+  iterator insert ( iterator position, const value_type& val )
+  {
+    (void)position;
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(*(first++));
+  }
+  iterator assign ( const key_type& k, const mapped_type& v ) // Insert or overwrite, then fix the sums above.
+  {
+    Node * node = _tree.find(k);
+    if (node == nullptr)
+      return (iterator(_tree.base(), _tree.add(ft::make_pair<const key_type, mapped_type>(k, v))));
+    node->_value->second = v;
+    _tree.refresh(node);
+    return (iterator(_tree.base(), node));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  { return (_tree._erase(k)); }
+  void erase ( iterator position ) // Unlinks the node itself, no search.
+  { _tree.erase(position.base()); }
+  void erase ( iterator first, iterator last )
+  {
+    while (first != last) {
+      _tree.erase((first++).base());
+    }
+  }
+
+  // [*] // void swap ( sum_map& x );
+  // [*] // void clear ( );
+  void swap ( sum_map& x )
+  { _tree.swap(x._tree); }
+  void clear ( ) { _tree.clear(); }
+
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  // [*] // const_iterator lower_bound (const key_type& k) const;
+  // [*] // const_iterator upper_bound (const key_type& k) const;
+  const_iterator find (const key_type& k) const
+  {
+    return (const_iterator(_tree.base(), _tree.find(k)));
+  }
+  size_type count( const key_type& k ) const
+  {
+    return ((_tree.find(k)) ? 1 : 0);
+  }
+  const_iterator lower_bound (const key_type& k) const
+  {
+    Node * node = *_tree.base();
+    Node * bound = nullptr;
+    while (node) {
+      if (_comp(node->_value->first, k)) {
+        node = node->_right;
+      } else {
+        bound = node; node = node->_left;
+      }
+    }
+    return (const_iterator(_tree.base(), bound));
+  }
+  const_iterator upper_bound (const key_type& k) const
+  {
+    Node * node = *_tree.base();
+    Node * bound = nullptr;
+    while (node) {
+      if (_comp(k, node->_value->first)) {
+        bound = node; node = node->_left;
+      } else {
+        node = node->_right;
+      }
+    }
+    return (const_iterator(_tree.base(), bound));
+  }
+
+  // [*] // mapped_type total ( ) const;
+  // [*] // mapped_type prefix_sum ( const key_type& k ) const;
+  // [*] // mapped_type range_sum ( const key_type& lo, const key_type& hi ) const;
+  // All O(log n).
+  mapped_type total ( ) const
+  { return (policy_type::get(*_tree.base())); }
+  mapped_type prefix_sum ( const key_type& k ) const // Sum of the values whose key is less than k.
+  {
+    mapped_type result = sum::identity();
+    Node * node = *_tree.base();
+    while (node) {
+      if (_comp(node->_value->first, k)) {
+        result = result + policy_type::get(node->_left) + node->_value->second;
+        node = node->_right;
+      } else {
+        node = node->_left;
+      }
+    }
+    return (result);
+  }
+  mapped_type range_sum ( const key_type& lo, const key_type& hi ) const // Sum of the values in [lo, hi).
+  {
+    Node * split = *_tree.base();
+    while (split) { // The highest node inside the range.
+      if (_comp(split->_value->first, lo))       split = split->_right;
+      else if (!_comp(split->_value->first, hi)) split = split->_left;
+      else break;
+    }
+    if (split == nullptr) return (sum::identity());
+    mapped_type result = split->_value->second;
+    for (Node * node = split->_left; node; ) { // keys >= lo on the left
+      if (_comp(node->_value->first, lo)) {
+        node = node->_right;
+      } else {
+        result = result + node->_value->second + policy_type::get(node->_right);
+        node = node->_left;
+      }
+    }
+    for (Node * node = split->_right; node; ) { // keys < hi on the right
+      if (_comp(node->_value->first, hi)) {
+        result = result + policy_type::get(node->_left) + node->_value->second;
+        node = node->_right;
+      } else {
+        node = node->_left;
+      }
+    }
+    return (result);
+  }
+};
+
+template< class Key, class T, class Compare, class Alloc >
+void swap (sum_map<Key,T,Compare,Alloc>& x, sum_map<Key,T,Compare,Alloc>& y)
+{
+  x.swap(y);
+}
+}
+
+#endif
@@ -0,0 +1,358 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   art_map_tests.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../art_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::art_map methods can be slower up to ft::map methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::art_map<int, std::string> amap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename AMap, typename Map>
+bool sameContent(const AMap &am, const Map &m)
+{
+    if (am.size() != m.size())
+        return false;
+    typename Map::const_iterator it = m.begin();
+    for (typename AMap::const_iterator it2 = am.begin(); it2 != am.end(); ++it, ++it2)
+        if (it->first != it2->first || it->second != it2->second)
+            return false;
+    typename Map::const_reverse_iterator rit = m.rbegin();
+    for (typename AMap::const_reverse_iterator rit2 = am.rbegin(); rit2 != am.rend(); ++rit, ++rit2)
+        if (rit->first != rit2->first)
+            return false;
+    return true;
+}
+
+template <typename AMap, typename Map>
+bool sameBounds(const AMap &am, const Map &m, const typename Map::key_type &k)
+{
+    typename Map::const_iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+    typename AMap::const_iterator am_lb = am.lower_bound(k), am_ub = am.upper_bound(k);
+    return ((lb == m.end()) == (am_lb == am.end()) && (lb == m.end() || lb->first == am_lb->first)
+        && (ub == m.end()) == (am_ub == am.end()) && (ub == m.end() || ub->first == am_ub->first)
+        && am.count(k) == m.count(k));
+}
+
+std::string randomString(std::mt19937 &generator)
+{
+    const char alphabet[] = {'\0', 'a', 'b', 'c', 'z', '\xff'};
+    std::string s(generator() % 3 ? "" : "shared/prefix/longer/than/a/node/"); // Past the stored prefix bytes.
+    for (size_t len = generator() % 8; len > 0; len--)
+        s += alphabet[generator() % sizeof(alphabet)];
+    return s;
+}
+
+void testArtMap()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase / bounds "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distr(-5e3, 5e3);
+        std::map<int, std::string> m;
+        amap am;
+
+        for (size_t i = 0; i < 2e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = m.erase(k) == am.erase(k);
+            else if (i % 3 == 1)
+            {
+                m[k] = std::to_string(i);
+                am[k] = std::to_string(i);
+            }
+            else
+                cond = m.insert(std::make_pair(k, std::to_string(k))).second == am.insert(ft::make_pair(k, std::to_string(k))).second;
+        }
+        cond = cond && sameContent(am, m);
+        for (int k = -5e3 - 2; k < 5e3 + 2 && cond; k += 3)
+            cond = sameBounds(am, m, k);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 64-bit and string keys "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937_64 generator(43);
+        std::mt19937 str_generator(43);
+        std::map<unsigned long, int> mu;
+        ft::art_map<unsigned long, int> amu;
+        std::map<long, int> ml;
+        ft::art_map<long, int> aml;
+        std::map<std::string, int> ms;
+        ft::art_map<std::string, int> ams;
+
+        for (int i = 0; i < 1e5 && cond; i++)
+        {
+            unsigned long u = generator() >> (generator() % 64); // Every depth of the tree.
+            long l = long(generator()) >> (generator() % 64);
+            std::string s = randomString(str_generator);
+            if (i % 4 == 0)
+                cond = mu.erase(u) == amu.erase(u) && ml.erase(l) == aml.erase(l) && ms.erase(s) == ams.erase(s);
+            else
+            {
+                mu[u] = i;
+                amu[u] = i;
+                ml[l] = i;
+                aml[l] = i;
+                ms[s] = i;
+                ams[s] = i;
+            }
+        }
+        cond = cond && sameContent(amu, mu) && sameContent(aml, ml) && sameContent(ams, ms);
+        for (int i = 0; i < 1e4 && cond; i++)
+            cond = sameBounds(amu, mu, generator() >> (generator() % 64)) && sameBounds(aml, ml, long(generator()) >> (generator() % 64))
+                && sameBounds(ams, ms, randomString(str_generator));
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " prefix scans "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(44);
+        std::map<std::string, int> m;
+        ft::art_map<std::string, int> am;
+
+        for (int i = 0; i < 2e4; i++)
+        {
+            std::string s = randomString(generator);
+            m[s] = i;
+            am[s] = i;
+        }
+        for (int i = 0; i < 2e3 && cond; i++)
+        {
+            std::string prefix = randomString(generator);
+            prefix.resize(std::min(prefix.size(), size_t(generator() % 40)));
+            ft::pair<ft::art_map<std::string, int>::iterator, ft::art_map<std::string, int>::iterator> range = am.prefix_range(prefix);
+            std::map<std::string, int>::iterator it = m.lower_bound(prefix);
+            for (; range.first != range.second && cond; ++range.first, ++it)
+                cond = it != m.end() && it->first == range.first->first && it->first.compare(0, prefix.size(), prefix) == 0;
+            cond = cond && (it == m.end() || it->first.compare(0, prefix.size(), prefix) != 0);
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase by iterator / range erase "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::map<int, std::string> m;
+        amap am;
+
+        for (int i = 0; i < 1e5; i++)
+        {
+            m.insert(m.end(), std::make_pair(i * 2, std::to_string(i)));
+            am.insert(am.end(), ft::make_pair(i * 2, std::to_string(i)));
+        }
+        m.erase(m.find(1000), m.find(150000));
+        am.erase(am.find(1000), am.find(150000));
+        m.erase(m.begin());
+        am.erase(am.begin());
+        m.erase(--m.end());
+        am.erase(--am.end());
+        for (int i = 150000; i < 170000; i += 6)
+        {
+            m.erase(i);
+            am.erase(am.find(i));
+        }
+        cond = cond && sameContent(am, m);
+        amap copy(am);
+        am.erase(am.begin(), am.end());
+        cond = cond && am.empty() && am.begin() == am.end() && sameContent(copy, m);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / swap / compare / at "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        amap am, other;
+
+        for (int i = 0; i < 1e4; i++)
+            am[i] = std::to_string(i);
+        amap copy(am);
+        other = copy;
+        cond = copy == am && other == am && !(other != am) && other <= am && other >= am;
+        other[10000] = "more";
+        cond = cond && am < other && other > am && am != other;
+        copy.swap(other);
+        cond = cond && copy.size() == 10001 && other == am;
+        cond = cond && am.at(42) == "42";
+        try
+        {
+            am.at(-1);
+            cond = false;
+        }
+        catch (const std::out_of_range &)
+        {
+        }
+        amap range(am.begin(), am.end());
+        cond = cond && range == am;
+        range.clear();
+        cond = cond && range.empty() && range.find(3) == range.end() && range.lower_bound(3) == range.end();
+        EQUAL(cond);
+    }
+}
+
+size_t allocated = 0;
+
+// Counts the bytes the containers ask for, without the malloc overhead.
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+    counting_allocator() {}
+    template <class U>
+    counting_allocator(const counting_allocator<U> &) {}
+    T *allocate(size_t n, const void * = 0)
+    {
+        allocated += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n)
+    {
+        allocated -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+typedef unsigned long id_type;
+typedef ft::pair<const id_type, id_type> id_pair;
+
+template <typename Map>
+time_t timeOps(const std::vector<id_type> &keys, const std::vector<id_type> &queries, int op, long &result, time_t limit = 0)
+{
+    size_t before = allocated;
+    Map m;
+    time_t start, end;
+
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(id_pair(keys[i], i));
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    if (op == 0)
+        for (size_t i = 0; i < queries.size(); i++)
+            result += m.count(queries[i]);
+    else if (op == 1)
+        for (size_t i = 1; i < queries.size(); i += 10) // From hits.
+        {
+            typename Map::const_iterator it = m.lower_bound(queries[i]);
+            for (int j = 0; j < 100 && it != m.end(); j++, ++it)
+                result += it->second;
+        }
+    else
+        result += (allocated - before) / keys.size();
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"lookups", "range scans", "bytes per key"};
+    const char *sets[] = {"dense", "sparse"};
+
+    for (int set = 0; set < 2; set++)
+    {
+        size_t n = 1e6;
+        std::mt19937_64 generator(n);
+        std::vector<id_type> keys(n), queries(n);
+        for (size_t i = 0; i < n; i++) // Consecutive ids, or random 64-bit ones.
+            keys[i] = (set == 0) ? i : id_type(generator());
+        queries = keys;
+        std::shuffle(queries.begin(), queries.end(), generator);
+        for (size_t i = 0; i < n; i += 2) // Half of them misses.
+            queries[i] = (set == 0) ? n + i : id_type(generator());
+        for (int op = 0; op < 3; op++)
+        {
+            std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                      << (" " + std::string(names[op]) + " " + sets[set] + " " + std::to_string(n) + " keys ")
+                      << "] --------------------]\t\t\033[0m";
+            long res(0), a_res(0);
+            time_t diff = timeOps<ft::map<id_type, id_type, std::less<id_type>, counting_allocator<id_pair> > >(keys, queries, op, res);
+            time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+            time_t a_diff = timeOps<ft::art_map<id_type, id_type, ft::art_key<id_type>, counting_allocator<id_pair> > >(keys, queries, op, a_res, limit);
+            if (op == 2)
+            {
+                EQUAL(a_res < res);
+                std::cout << "\t\t(map " << res << " bytes, art_map " << a_res << " bytes)" << std::endl;
+                continue;
+            }
+            EQUAL(res == a_res);
+            std::cout << "\t\t(map " << diff << "ms, art_map " << a_diff << "ms)" << std::endl;
+        }
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing art_map;" << RESET << std::endl;
+    TEST_CASE(testArtMap);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,287 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map_tests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../btree_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::btree_map methods can be slower up to ft::map methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::btree_map<int, std::string> bmap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename BMap, typename Map>
+bool sameContent(const BMap &bm, const Map &m)
+{
+    if (bm.size() != m.size())
+        return false;
+    typename Map::const_iterator it = m.begin();
+    for (typename BMap::const_iterator it2 = bm.begin(); it2 != bm.end(); ++it, ++it2)
+        if (it->first != it2->first || it->second != it2->second)
+            return false;
+    typename Map::const_reverse_iterator rit = m.rbegin();
+    for (typename BMap::const_reverse_iterator rit2 = bm.rbegin(); rit2 != bm.rend(); ++rit, ++rit2)
+        if (rit->first != rit2->first)
+            return false;
+    return true;
+}
+
+template <typename BMap, typename Map>
+bool sameBounds(const BMap &bm, const Map &m, const typename Map::key_type &k)
+{
+    typename Map::const_iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+    typename BMap::const_iterator bm_lb = bm.lower_bound(k), bm_ub = bm.upper_bound(k);
+    return ((lb == m.end()) == (bm_lb == bm.end()) && (lb == m.end() || lb->first == bm_lb->first)
+        && (ub == m.end()) == (bm_ub == bm.end()) && (ub == m.end() || ub->first == bm_ub->first)
+        && bm.count(k) == m.count(k));
+}
+
+void testBtreeMap()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase / bounds "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(40);
+        std::uniform_int_distribution<int> distr(0, 5e3);
+        std::map<int, std::string> m;
+        bmap bm;
+
+        for (size_t i = 0; i < 2e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = m.erase(k) == bm.erase(k);
+            else if (i % 3 == 1)
+            {
+                m[k] = std::to_string(i);
+                bm[k] = std::to_string(i);
+            }
+            else
+                cond = m.insert(std::make_pair(k, std::to_string(k))).second == bm.insert(ft::make_pair(k, std::to_string(k))).second;
+        }
+        cond = cond && sameContent(bm, m);
+        for (int k = -1; k < 5e3 + 2 && cond; k += 3)
+            cond = sameBounds(bm, m, k);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " arithmetic keys (node search) "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(41);
+        std::uniform_int_distribution<int> distr(-2e4, 2e4);
+        std::map<long, int> ml;
+        ft::btree_map<long, int> bml;
+        std::map<double, int> md;
+        ft::btree_map<double, int> bmd;
+        std::map<unsigned int, int> mu;
+        ft::btree_map<unsigned int, int> bmu;
+
+        for (int i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 4 == 0)
+                cond = ml.erase(k * 7919L) == bml.erase(k * 7919L) && md.erase(k / 4.0) == bmd.erase(k / 4.0)
+                    && mu.erase(k) == bmu.erase(k);
+            else
+            {
+                ml[k * 7919L] = i;
+                bml[k * 7919L] = i;
+                md[k / 4.0] = i;
+                bmd[k / 4.0] = i;
+                mu[k] = i; // Negative keys wrap around: the sign bit is set.
+                bmu[k] = i;
+            }
+        }
+        cond = cond && sameContent(bml, ml) && sameContent(bmd, md) && sameContent(bmu, mu);
+        for (int k = -2e4 - 1; k < 2e4 + 2 && cond; k += 13)
+            cond = sameBounds(bml, ml, k * 7919L) && sameBounds(bmd, md, k / 4.0) && sameBounds(bmu, mu, k);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " hinted insert / range erase "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::map<int, std::string> m;
+        bmap bm;
+
+        for (int i = 0; i < 1e5; i++) // Appending at end() never searches.
+        {
+            m.insert(m.end(), std::make_pair(i * 2, std::to_string(i)));
+            bm.insert(bm.end(), ft::make_pair(i * 2, std::to_string(i)));
+        }
+        for (int i = 0; i < 1e5; i += 3) // Right before the hint, then a wrong hint.
+        {
+            m.insert(m.find(i * 2), std::make_pair(i * 2 - 1, "odd"));
+            cond = cond && bm.insert(bm.find(i * 2), ft::make_pair(i * 2 - 1, std::string("odd")))->first == i * 2 - 1;
+            m.insert(m.begin(), std::make_pair(i * 2 + 1, "wrong hint"));
+            cond = cond && bm.insert(bm.begin(), ft::make_pair(i * 2 + 1, std::string("wrong hint")))->first == i * 2 + 1;
+        }
+        cond = cond && sameContent(bm, m);
+        m.erase(m.find(1000), m.find(150000));
+        bm.erase(bm.find(1000), bm.find(150000));
+        m.erase(m.begin());
+        bm.erase(bm.begin());
+        m.erase(--m.end());
+        bm.erase(--bm.end());
+        cond = cond && sameContent(bm, m);
+        bmap copy(bm);
+        bm.erase(bm.begin(), bm.end());
+        cond = cond && bm.empty() && bm.begin() == bm.end() && sameContent(copy, m);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / swap / compare / at "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        bmap bm, other;
+
+        for (int i = 0; i < 1e4; i++)
+            bm[i] = std::to_string(i);
+        bmap copy(bm);
+        other = copy;
+        cond = copy == bm && other == bm && !(other != bm) && other <= bm && other >= bm;
+        other[10000] = "more";
+        cond = cond && bm < other && other > bm && bm != other;
+        copy.swap(other);
+        cond = cond && copy.size() == 10001 && other == bm;
+        cond = cond && bm.at(42) == "42";
+        try
+        {
+            bm.at(-1);
+            cond = false;
+        }
+        catch (const std::out_of_range &)
+        {
+        }
+        bmap range(bm.begin(), bm.end());
+        cond = cond && range == bm;
+        range.clear();
+        cond = cond && range.empty() && range.find(3) == range.end() && range.lower_bound(3) == range.end();
+        EQUAL(cond);
+    }
+}
+
+template <typename Map>
+time_t timeOps(const std::vector<int> &keys, int op, long &result, time_t limit = 0)
+{
+    Map m;
+    time_t start, end;
+
+    for (size_t i = 0; op && i < keys.size(); i++)
+        m.insert(ft::make_pair(keys[i], int(i)));
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    if (op == 0)
+        for (size_t i = 0; i < keys.size(); i++)
+            m.insert(ft::make_pair(keys[i], int(i)));
+    else if (op == 1)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += m.find(keys[i])->second;
+    else if (op == 2)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += m.erase(keys[i]);
+    else
+        for (int rep = 0; rep < 10; rep++)
+            for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+                result += it->second;
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    result += m.size();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"insert", "find", "erase", "scan x10"};
+
+    for (size_t n = 1e3; n <= 1e6; n *= 10)
+    {
+        std::mt19937 generator(n);
+        std::vector<int> keys(n);
+        for (size_t i = 0; i < n; i++)
+            keys[i] = generator();
+        int reps = 1e6 / n; // Small trees are timed over several runs.
+        for (int op = 0; op < 4; op++)
+        {
+            std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                      << (" " + std::string(names[op]) + " " + std::to_string(n) + " keys ")
+                      << "] --------------------]\t\t\033[0m";
+            time_t diff(0), b_diff(0);
+            long res(0), b_res(0);
+            for (int r = 0; r < reps; r++)
+                diff += timeOps<ft::map<int, int> >(keys, op, res);
+            time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+            for (int r = 0; r < reps; r++)
+                b_diff += timeOps<ft::btree_map<int, int> >(keys, op, b_res, (limit > b_diff) ? limit - b_diff : 1);
+            EQUAL(res == b_res);
+            std::cout << "\t\t(map " << diff << "ms, btree_map " << b_diff << "ms)" << std::endl;
+        }
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing btree_map;" << RESET << std::endl;
+    TEST_CASE(testBtreeMap);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,237 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set_tests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../btree_set.hpp"
+#include "../set.hpp"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::btree_set methods can be slower up to ft::set methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename BSet, typename Set>
+bool sameContent(const BSet &bs, const Set &s)
+{
+    if (bs.size() != s.size())
+        return false;
+    typename Set::const_iterator it = s.begin();
+    for (typename BSet::const_iterator it2 = bs.begin(); it2 != bs.end(); ++it, ++it2)
+        if (*it != *it2)
+            return false;
+    typename Set::const_reverse_iterator rit = s.rbegin();
+    for (typename BSet::const_reverse_iterator rit2 = bs.rbegin(); rit2 != bs.rend(); ++rit, ++rit2)
+        if (*rit != *rit2)
+            return false;
+    return true;
+}
+
+template <typename BSet, typename Set>
+bool sameBounds(const BSet &bs, const Set &s, const typename Set::key_type &k)
+{
+    typename Set::const_iterator lb = s.lower_bound(k), ub = s.upper_bound(k);
+    typename BSet::const_iterator bs_lb = bs.lower_bound(k), bs_ub = bs.upper_bound(k);
+    return ((lb == s.end()) == (bs_lb == bs.end()) && (lb == s.end() || *lb == *bs_lb)
+        && (ub == s.end()) == (bs_ub == bs.end()) && (ub == s.end() || *ub == *bs_ub)
+        && bs.count(k) == s.count(k));
+}
+
+void testBtreeSet()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " int keys (SIMD node search) "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distr(-1e4, 1e4);
+        std::set<int> s;
+        ft::btree_set<int> bs;
+
+        for (size_t i = 0; i < 2e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = s.erase(k) == bs.erase(k);
+            else
+                cond = s.insert(k).second == bs.insert(k).second;
+        }
+        cond = cond && sameContent(bs, s);
+        for (int k = -1e4 - 1; k < 1e4 + 2 && cond; k += 3)
+            cond = sameBounds(bs, s, k);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " string keys (binary search) "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(43);
+        std::uniform_int_distribution<int> distr(0, 3e3);
+        std::set<std::string> s;
+        ft::btree_set<std::string> bs;
+
+        for (size_t i = 0; i < 5e4 && cond; i++)
+        {
+            std::string k = std::to_string(distr(generator));
+            if (i % 3 == 0)
+                cond = s.erase(k) == bs.erase(k);
+            else
+                cond = s.insert(k).second == bs.insert(k).second;
+        }
+        cond = cond && sameContent(bs, s);
+        for (int k = 0; k < 3e3 && cond; k += 7)
+            cond = sameBounds(bs, s, std::to_string(k));
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " hint / range / copy / compare "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::set<int> s;
+        ft::btree_set<int> bs;
+
+        for (int i = 0; i < 1e5; i++)
+        {
+            s.insert(s.end(), i * 2);
+            bs.insert(bs.end(), i * 2);
+        }
+        for (int i = 0; i < 1e5; i += 5)
+        {
+            s.insert(s.find(i * 2), i * 2 - 1);
+            cond = cond && *bs.insert(bs.find(i * 2), i * 2 - 1) == i * 2 - 1;
+        }
+        s.erase(s.find(500), s.find(90000));
+        bs.erase(bs.find(500), bs.find(90000));
+        cond = cond && sameContent(bs, s);
+        ft::btree_set<int> copy(bs), other;
+        other = copy;
+        cond = cond && copy == bs && other <= bs && !(other < bs);
+        other.insert(-5);
+        cond = cond && other < bs && bs > other && other != bs;
+        other.swap(copy);
+        cond = cond && other == bs && copy.size() == bs.size() + 1;
+        ft::btree_set<int> range(s.begin(), s.end());
+        cond = cond && range == bs;
+        EQUAL(cond);
+    }
+}
+
+template <typename Set>
+time_t timeOps(const std::vector<int> &keys, int op, long &result, time_t limit = 0)
+{
+    Set s;
+    time_t start, end;
+
+    for (size_t i = 0; op && i < keys.size(); i++)
+        s.insert(keys[i]);
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    if (op == 0)
+        for (size_t i = 0; i < keys.size(); i++)
+            s.insert(keys[i]);
+    else if (op == 1)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += *s.find(keys[i]) & 1;
+    else if (op == 2)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += s.erase(keys[i]);
+    else
+        for (int rep = 0; rep < 10; rep++)
+            for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+                result += *it & 1;
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    result += s.size();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"insert", "find", "erase", "scan x10"};
+
+    for (size_t n = 1e3; n <= 1e6; n *= 1e3)
+    {
+        std::mt19937 generator(n);
+        std::vector<int> keys(n);
+        for (size_t i = 0; i < n; i++)
+            keys[i] = generator();
+        int reps = 1e6 / n;
+        for (int op = 0; op < 4; op++)
+        {
+            std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                      << (" " + std::string(names[op]) + " " + std::to_string(n) + " keys ")
+                      << "] --------------------]\t\t\033[0m";
+            time_t diff(0), b_diff(0);
+            long res(0), b_res(0);
+            for (int r = 0; r < reps; r++)
+                diff += timeOps<ft::set<int> >(keys, op, res);
+            time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+            for (int r = 0; r < reps; r++)
+                b_diff += timeOps<ft::btree_set<int> >(keys, op, b_res, (limit > b_diff) ? limit - b_diff : 1);
+            EQUAL(res == b_res);
+            std::cout << "\t\t(set " << diff << "ms, btree_set " << b_diff << "ms)" << std::endl;
+        }
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing btree_set;" << RESET << std::endl;
+    TEST_CASE(testBtreeSet);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
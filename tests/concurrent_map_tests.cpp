@@ -0,0 +1,277 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_map_tests.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../concurrent_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::concurrent_map can be slower up to a single locked ft::map * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::concurrent_map<int, int> cmap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+struct Collect
+{
+    std::vector<int> *keys;
+    void operator()(const ft::pair<const int, int> &x) { keys->push_back(x.first); }
+};
+
+struct Worker
+{
+    cmap *cm;
+    int id;
+    bool ok;
+};
+
+void *updateWorker(void *arg)
+{
+    Worker *w = static_cast<Worker *>(arg);
+    int base = w->id * 100000;
+
+    for (int i = 0; i < 20000; i++)
+        w->ok = w->cm->insert(ft::make_pair(base + i, base + i)) && w->ok;
+    for (int i = 0; i < 20000; i += 2)
+        w->ok = w->cm->erase(base + i) == 1 && w->ok;
+    for (int i = 0; i < 20000; i++)
+    {
+        int v(-1);
+        bool found = w->cm->find(base + i, v);
+        w->ok = (i % 2 ? found && v == base + i : !found) && w->ok;
+    }
+    std::vector<int> keys;
+    Collect c = {&keys};
+    w->cm->scan(0, 1 << 30, c);
+    for (size_t i = 1; i < keys.size(); i++)
+        w->ok = keys[i - 1] < keys[i] && w->ok;
+    return NULL;
+}
+
+void testConcurrentUpdates()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " concurrent insert / erase / find "
+              << "] --------------------]\t\t\033[0m";
+    {
+        cmap cm(5);
+        pthread_t threads[8];
+        Worker workers[8];
+        bool cond(cm.shard_count() == 8);
+
+        for (int i = 0; i < 8; i++)
+        {
+            workers[i].cm = &cm;
+            workers[i].id = i;
+            workers[i].ok = true;
+            pthread_create(&threads[i], NULL, updateWorker, &workers[i]);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            pthread_join(threads[i], NULL);
+            cond = cond && workers[i].ok;
+        }
+        EQUAL(cond && cm.size() == 8 * 10000);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " merged scan / per shard scans "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(37);
+        std::uniform_int_distribution<int> distr(0, 1e5);
+        std::map<int, int> m;
+        cmap cm;
+
+        for (int i = 0; i < 5e4; i++)
+        {
+            int k = distr(generator);
+            m[k] = i;
+            cm.assign(k, i);
+        }
+        for (int q = 0; q < 50 && cond; q++)
+        {
+            int lo = distr(generator), hi = distr(generator);
+            std::vector<int> keys, expected;
+            Collect c = {&keys};
+            cm.scan(lo, hi, c);
+            for (std::map<int, int>::iterator it = m.lower_bound(lo); it != m.end() && it->first < hi; ++it)
+                expected.push_back(it->first);
+            cond = keys == expected;
+        }
+        size_t total(0);
+        for (size_t s = 0; s < cm.shard_count() && cond; s++)
+        {
+            std::vector<int> keys;
+            Collect c = {&keys};
+            cm.scan_shard(s, 0, 1e5 + 1, c);
+            for (size_t i = 0; i < keys.size() && cond; i++)
+                cond = cm.shard_of(keys[i]) == s && (i == 0 || keys[i - 1] < keys[i]);
+            total += keys.size();
+        }
+        EQUAL(cond && total == m.size() && cm.size() == m.size());
+    }
+}
+
+struct LockedMap
+{
+    pthread_mutex_t lock;
+    ft::map<int, int> map;
+};
+
+struct Bench
+{
+    LockedMap *lm;
+    cmap *cm;
+    int id;
+    int ops;
+    long found; // Keeps the reads from being optimized out.
+};
+
+void *lockedWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        int k = distr(generator);
+        pthread_mutex_lock(&b->lm->lock);
+        if (i % 10 == 0)
+            b->lm->map[k] = i;
+        else
+            b->found += b->lm->map.count(k);
+        pthread_mutex_unlock(&b->lm->lock);
+    }
+    return NULL;
+}
+
+void *shardedWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        int k = distr(generator);
+        if (i % 10 == 0)
+            b->cm->assign(k, i);
+        else
+            b->found += b->cm->count(k);
+    }
+    return NULL;
+}
+
+time_t runBench(void *(*fn)(void *), LockedMap *lm, cmap *cm, int nthreads)
+{
+    std::vector<pthread_t> threads(nthreads);
+    std::vector<Bench> benches(nthreads);
+    time_t start = get_time();
+
+    for (int i = 0; i < nthreads; i++)
+    {
+        Bench b = {lm, cm, i, 640000 / nthreads, 0};
+        benches[i] = b;
+        pthread_create(&threads[i], NULL, fn, &benches[i]);
+    }
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    return (get_time() - start);
+}
+
+void testThroughput()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 90% reads: locked map vs sharded "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t locked_diff(0), sharded_diff(0), diff;
+        std::vector<time_t> locked_times, sharded_times;
+        long seen(0), cm_seen(0);
+
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            LockedMap lm;
+            pthread_mutex_init(&lm.lock, NULL);
+            locked_times.push_back(runBench(lockedWorker, &lm, NULL, nthreads));
+            locked_diff += locked_times.back();
+            seen += lm.map.size();
+            pthread_mutex_destroy(&lm.lock);
+        }
+        diff = (locked_diff) ? (locked_diff * TIME_FAC) : TIME_FAC;
+
+        ualarm(diff * 1e3, 0);
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            cmap cm(64);
+            sharded_times.push_back(runBench(shardedWorker, NULL, &cm, nthreads));
+            sharded_diff += sharded_times.back();
+            cm_seen += cm.size();
+        }
+        ualarm(0, 0);
+        EQUAL(seen == cm_seen);
+        for (size_t i = 0; i < locked_times.size(); i++)
+            std::cout << "\t\t(" << std::setw(2) << std::right << (1 << i) << " threads: locked map " << locked_times[i]
+                      << "ms, sharded " << sharded_times[i] << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing concurrent_map;" << RESET << std::endl;
+    TEST_CASE(testConcurrentUpdates);
+    TEST_CASE(testThroughput);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,282 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_skiplist_map_tests.cpp                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../concurrent_skiplist_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::concurrent_skiplist_map can be slower up to a single locked ft::map * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::concurrent_skiplist_map<int, int> smap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+struct Worker
+{
+    smap *sm;
+    int id;
+    int nthreads;
+    std::set<int> model; // The keys of this worker: k % nthreads == id.
+    bool ok;
+};
+
+void *updateWorker(void *arg)
+{
+    Worker *w = static_cast<Worker *>(arg);
+    std::mt19937 generator(w->id);
+    std::uniform_int_distribution<int> distr(0, 2e3);
+
+    for (int i = 0; i < 5e4 && w->ok; i++)
+    {
+        int k = distr(generator) * w->nthreads + w->id;
+        if (i % 4 == 0)
+            w->ok = w->sm->insert(ft::make_pair(k, k)).second == w->model.insert(k).second;
+        else if (i % 4 == 1)
+            w->ok = w->sm->erase(k) == w->model.erase(k);
+        else if (i % 4 == 2)
+        {
+            smap::iterator it = w->sm->find(k);
+            w->ok = (it != w->sm->end()) == (w->model.count(k) == 1) && (it == w->sm->end() || it->second == k);
+        }
+        else
+        {
+            int last(-1);
+            for (smap::const_iterator it = w->sm->lower_bound(k - 100); it != w->sm->end() && it->first < k + 100 && w->ok; ++it)
+            {
+                w->ok = last < it->first;
+                last = it->first;
+            }
+        }
+    }
+    return NULL;
+}
+
+void testConcurrentUpdates()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " concurrent insert / erase / find "
+              << "] --------------------]\t\t\033[0m";
+    {
+        smap sm;
+        pthread_t threads[8];
+        Worker workers[8];
+        bool cond(true);
+
+        for (int i = 0; i < 8; i++)
+        {
+            workers[i].sm = &sm;
+            workers[i].id = i;
+            workers[i].nthreads = 8;
+            workers[i].ok = true;
+            pthread_create(&threads[i], NULL, updateWorker, &workers[i]);
+        }
+        std::set<int> all;
+        for (int i = 0; i < 8; i++)
+        {
+            pthread_join(threads[i], NULL);
+            cond = cond && workers[i].ok;
+            all.insert(workers[i].model.begin(), workers[i].model.end());
+        }
+        std::set<int>::iterator it = all.begin();
+        for (smap::iterator it2 = sm.begin(); it2 != sm.end() && cond; ++it, ++it2)
+            cond = it != all.end() && *it == it2->first;
+        EQUAL(cond && it == all.end() && sm.size() == all.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " bounds / copy / clear "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(38);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::map<int, int> m;
+        smap sm;
+
+        for (int i = 0; i < 2e4; i++)
+        {
+            int k = distr(generator);
+            if (i % 3)
+                cond = cond && m.insert(std::make_pair(k, i)).second == sm.insert(ft::make_pair(k, i)).second;
+            else
+                cond = cond && m.erase(k) == sm.erase(k);
+        }
+        for (int k = -1; k < 1e4 + 2 && cond; k += 7)
+        {
+            std::map<int, int>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+            smap::iterator sm_lb = sm.lower_bound(k), sm_ub = sm.upper_bound(k);
+            cond = (lb == m.end()) == (sm_lb == sm.end()) && (lb == m.end() || lb->first == sm_lb->first);
+            cond = cond && (ub == m.end()) == (sm_ub == sm.end()) && (ub == m.end() || ub->first == sm_ub->first);
+            cond = cond && sm.count(k) == m.count(k);
+        }
+        smap copy(sm);
+        cond = cond && copy.size() == m.size() && copy.begin()->first == m.begin()->first;
+        copy.erase(copy.begin());
+        sm.clear();
+        cond = cond && copy.size() + 1 == m.size() && sm.empty() && sm.begin() == sm.end();
+        EQUAL(cond);
+    }
+}
+
+struct LockedMap
+{
+    pthread_mutex_t lock;
+    ft::map<int, int> map;
+};
+
+struct Bench
+{
+    LockedMap *lm;
+    smap *sm;
+    int id;
+    int ops;
+};
+
+void *lockedWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        int k = distr(generator);
+        pthread_mutex_lock(&b->lm->lock);
+        if (i % 2)
+            b->lm->map.insert(ft::make_pair(k, i));
+        else
+            b->lm->map.erase(k);
+        pthread_mutex_unlock(&b->lm->lock);
+    }
+    return NULL;
+}
+
+void *skiplistWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        int k = distr(generator);
+        if (i % 2)
+            b->sm->insert(ft::make_pair(k, i));
+        else
+            b->sm->erase(k);
+    }
+    return NULL;
+}
+
+time_t runBench(void *(*fn)(void *), LockedMap *lm, smap *sm, int nthreads)
+{
+    std::vector<pthread_t> threads(nthreads);
+    std::vector<Bench> benches(nthreads);
+    time_t start = get_time();
+
+    for (int i = 0; i < nthreads; i++)
+    {
+        Bench b = {lm, sm, i, 640000 / nthreads};
+        benches[i] = b;
+        pthread_create(&threads[i], NULL, fn, &benches[i]);
+    }
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    return (get_time() - start);
+}
+
+void testThroughput()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 100% writes: locked map vs skiplist "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t locked_diff(0), skiplist_diff(0), diff;
+        std::vector<time_t> locked_times, skiplist_times;
+        long seen(0), sm_seen(0);
+
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            LockedMap lm;
+            pthread_mutex_init(&lm.lock, NULL);
+            locked_times.push_back(runBench(lockedWorker, &lm, NULL, nthreads));
+            locked_diff += locked_times.back();
+            seen += lm.map.size() != 0;
+            pthread_mutex_destroy(&lm.lock);
+        }
+        diff = (locked_diff) ? (locked_diff * TIME_FAC) : TIME_FAC;
+
+        ualarm(diff * 1e3, 0);
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            smap sm;
+            skiplist_times.push_back(runBench(skiplistWorker, NULL, &sm, nthreads));
+            skiplist_diff += skiplist_times.back();
+            sm_seen += sm.size() != 0;
+        }
+        ualarm(0, 0);
+        EQUAL(seen == sm_seen);
+        for (size_t i = 0; i < locked_times.size(); i++)
+            std::cout << "\t\t(" << std::setw(2) << std::right << (1 << i) << " threads: locked map " << locked_times[i]
+                      << "ms, skiplist " << skiplist_times[i] << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing concurrent_skiplist_map;" << RESET << std::endl;
+    TEST_CASE(testConcurrentUpdates);
+    TEST_CASE(testThroughput);
+    std::cout << std::endl;
+    return 0;
+}
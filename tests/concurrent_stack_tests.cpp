@@ -0,0 +1,277 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack_tests.cpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../concurrent_stack.hpp"
+#include "../stack.hpp"
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::concurrent_stack can be slower up to a single locked ft::stack * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::concurrent_stack<std::string> sstack;
+typedef ft::concurrent_stack<int> istack;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+struct Worker
+{
+    istack *s;
+    int id;
+    int pushes;
+    std::vector<int> popped;
+};
+
+// Pushes its own values, and pops as many as it can in between.
+void *exchangeWorker(void *arg)
+{
+    Worker *w = static_cast<Worker *>(arg);
+    int v;
+
+    for (int i = 0; i < w->pushes; i++)
+    {
+        w->s->push(i * 64 + w->id);
+        if (i % 2 && w->s->try_pop(v))
+            w->popped.push_back(v);
+        if (i % 3 == 0 && w->s->try_pop(v))
+            w->popped.push_back(v);
+    }
+    return NULL;
+}
+
+void testConcurrentStack()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push / try_pop "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(45);
+        ft::stack<std::string> model;
+        sstack s;
+        std::string v;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            if (generator() % 3)
+            {
+                model.push(std::to_string(i));
+                s.push(std::to_string(i));
+            }
+            else if (model.empty())
+                cond = !s.try_pop(v) && s.empty();
+            else
+            {
+                cond = s.try_pop(v) && v == model.top();
+                model.pop();
+            }
+        }
+        size_t pooled = s.pooled();
+        s.clear();
+        for (size_t i = 0; i < pooled; i++) // Every node comes from the pool now.
+            s.push("again");
+        cond = cond && s.empty() == false && s.pooled() == pooled;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 16 threads: every value popped once "
+              << "] --------------------]\t\t\033[0m";
+    {
+        const int nthreads = 16, pushes = 1e5;
+        istack s;
+        std::vector<pthread_t> threads(nthreads);
+        std::vector<Worker> workers(nthreads);
+        std::vector<char> seen(pushes * 64, 0);
+        bool cond(true);
+        int v;
+
+        for (int i = 0; i < nthreads; i++)
+        {
+            workers[i].s = &s;
+            workers[i].id = i;
+            workers[i].pushes = pushes;
+            pthread_create(&threads[i], NULL, exchangeWorker, &workers[i]);
+        }
+        for (int i = 0; i < nthreads; i++)
+            pthread_join(threads[i], NULL);
+        for (int i = 0; i < nthreads; i++)
+            for (size_t j = 0; j < workers[i].popped.size(); j++)
+                seen[workers[i].popped[j]]++;
+        while (s.try_pop(v))
+            seen[v]++;
+        for (int i = 0; i < pushes && cond; i++)
+            for (int id = 0; id < nthreads && cond; id++)
+                cond = seen[i * 64 + id] == 1;
+        EQUAL(cond && s.empty());
+    }
+}
+
+struct LockedStack
+{
+    pthread_mutex_t lock;
+    ft::stack<int> stack;
+};
+
+struct Bench
+{
+    LockedStack *ls;
+    istack *s;
+    int id;
+    int ops;
+    long sum;
+};
+
+void *lockedWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        pthread_mutex_lock(&b->ls->lock);
+        if (i % 2 == 0)
+            b->ls->stack.push(i);
+        else if (!b->ls->stack.empty())
+        {
+            b->sum += b->ls->stack.top();
+            b->ls->stack.pop();
+        }
+        pthread_mutex_unlock(&b->ls->lock);
+    }
+    return NULL;
+}
+
+void *lockFreeWorker(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    int v;
+
+    for (int i = 0; i < b->ops; i++)
+    {
+        if (i % 2 == 0)
+            b->s->push(i);
+        else if (b->s->try_pop(v))
+            b->sum += v;
+    }
+    return NULL;
+}
+
+time_t runBench(void *(*fn)(void *), LockedStack *ls, istack *s, int nthreads, long &sum)
+{
+    std::vector<pthread_t> threads(nthreads);
+    std::vector<Bench> benches(nthreads);
+    time_t start = get_time();
+
+    for (int i = 0; i < nthreads; i++)
+    {
+        Bench b = {ls, s, i, 2000000 / nthreads, 0};
+        benches[i] = b;
+        pthread_create(&threads[i], NULL, fn, &benches[i]);
+    }
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    time_t diff = get_time() - start;
+    for (int i = 0; i < nthreads; i++)
+        sum += benches[i].sum;
+    return (diff);
+}
+
+void testThroughput()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push/pop pairs: locked vs lock-free "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t locked_diff(0), lock_free_diff(0), diff;
+        std::vector<time_t> locked_times, lock_free_times;
+        bool cond(true);
+
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            LockedStack ls;
+            long sum(0);
+            pthread_mutex_init(&ls.lock, NULL);
+            locked_times.push_back(runBench(lockedWorker, &ls, NULL, nthreads, sum));
+            locked_diff += locked_times.back();
+            while (!ls.stack.empty())
+            {
+                sum += ls.stack.top();
+                ls.stack.pop();
+            }
+            cond = cond && sum == (long)nthreads * (2000000 / nthreads / 2) * (2000000 / nthreads / 2 - 1);
+            pthread_mutex_destroy(&ls.lock);
+        }
+        diff = (locked_diff) ? (locked_diff * TIME_FAC) : TIME_FAC;
+
+        ualarm(diff * 1e3, 0);
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            istack s;
+            long sum(0);
+            int v;
+            lock_free_times.push_back(runBench(lockFreeWorker, NULL, &s, nthreads, sum));
+            lock_free_diff += lock_free_times.back();
+            while (s.try_pop(v))
+                sum += v;
+            cond = cond && sum == (long)nthreads * (2000000 / nthreads / 2) * (2000000 / nthreads / 2 - 1);
+        }
+        ualarm(0, 0);
+        EQUAL(cond);
+        for (size_t i = 0; i < locked_times.size(); i++)
+            std::cout << "\t\t(" << std::setw(2) << std::right << (1 << i) << " threads: locked stack " << locked_times[i]
+                      << "ms, concurrent_stack " << lock_free_times[i] << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing concurrent_stack;" << RESET << std::endl;
+    TEST_CASE(testConcurrentStack);
+    TEST_CASE(testThroughput);
+    std::cout << std::endl;
+    return 0;
+}
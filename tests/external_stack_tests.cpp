@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   external_stack_tests.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../external_stack.hpp"
+#include "../stack.hpp"
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 3 // ft::external_stack can be slower up to the in-memory ft::stack * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+// 4KB: a block holds 256 of them, so a window of 2 blocks spills often.
+struct Frame
+{
+    long id;
+    char pad[4096 - sizeof(long)];
+};
+
+void testExternalStack()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " random walks over a 2-block window "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(49);
+        std::vector<long> model;
+        ft::external_stack<Frame> s(0);
+        size_t most_spilled(0);
+
+        for (long i = 0; i < 3000 && cond; i++)
+        {
+            // Long runs, drifting upwards, so that the walk crosses the
+            // window and block boundaries many times both ways.
+            long run = generator() % 2000;
+            bool up = generator() % 5 < 3 || model.empty();
+            for (long j = 0; j < run && cond; j++)
+            {
+                if (up)
+                {
+                    Frame f;
+                    f.id = i * 10000 + j;
+                    f.pad[100] = char(f.id);
+                    s.push(f);
+                    model.push_back(f.id);
+                }
+                else if (!model.empty())
+                {
+                    cond = s.top().id == model.back() && s.top().pad[100] == char(model.back());
+                    s.pop();
+                    model.pop_back();
+                }
+                cond = cond && s.size() == model.size() && s.empty() == model.empty()
+                       && (model.empty() || s.top().id == model.back());
+            }
+            most_spilled = std::max(most_spilled, s.spilled());
+        }
+        while (cond && !model.empty())
+        {
+            cond = s.top().id == model.back();
+            s.pop();
+            model.pop_back();
+        }
+        EQUAL(cond && s.empty() && s.spilled() == 0 && most_spilled > 10 * 256);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 1e7 ints under a 4MB cap "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        ft::external_stack<int> s(4 << 20);
+        for (int i = 0; i < 1e7; i++)
+            s.push(i);
+        cond = s.size() == 1e7 && s.spilled() >= 1e7 - (1 << 20) && s.top() == 1e7 - 1;
+        for (int i = 1e7 - 1; i >= 0 && cond; i--)
+        {
+            cond = s.top() == i;
+            s.pop();
+        }
+        EQUAL(cond && s.empty());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " bad directory "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool thrown(false);
+        try { ft::external_stack<int> s(4 << 20, "/nonexistent/ft"); } catch (const std::runtime_error &) { thrown = true; }
+        EQUAL(thrown);
+    }
+}
+
+// A depth-first search's stack: a deep descent with some backtracking,
+// pushing three vertices for each one it pops, then the unwinding.
+template <typename Stack>
+time_t timeSearch(Stack &s, long &sum, time_t limit = 0)
+{
+    time_t start, end;
+    std::mt19937 generator(50);
+
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    while (s.size() < 5e7)
+    {
+        s.push(generator());
+        s.push(generator());
+        s.push(generator());
+        sum += s.top();
+        s.pop();
+    }
+    while (!s.empty())
+    {
+        sum += s.top();
+        s.pop();
+    }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 5e7-deep search, 16MB cap "
+              << "] --------------------]\t\t\033[0m";
+    long sum(0), external_sum(0);
+    ft::stack<unsigned> in_memory;
+    time_t diff = timeSearch(in_memory, sum);
+    time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+    ft::external_stack<unsigned> external(16 << 20);
+    time_t external_diff = timeSearch(external, external_sum, limit);
+    EQUAL(sum == external_sum);
+    std::cout << "\t\t(ft::stack " << diff << "ms, 256MB; external_stack " << external_diff << "ms, 16MB)" << std::endl;
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing external_stack;" << RESET << std::endl;
+    TEST_CASE(testExternalStack);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,211 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interval_map_tests.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../interval_map.hpp"
+#include "../map.hpp"
+#include "../vector.hpp"
+
+#include <vector>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::interval_map queries can be slower up to a linear scan * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::interval_map<int, int> imap;
+typedef ft::map<ft::pair<int, int>, int> scan_map;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <class Map>
+size_t scanOverlapping(Map &m, int lo, int hi)
+{
+    size_t count(0);
+    for (typename Map::iterator it = m.begin(); it != m.end() && it->first.first < hi; ++it)
+        if (lo < it->first.second)
+            count++;
+    return count;
+}
+
+void testInsertErase()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase / find "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        scan_map m;
+        imap im;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int lo = distr(generator);
+            ft::pair<int, int> key(lo, lo + distr(generator) % 100 + 1);
+            if (i % 3)
+                cond = m.insert(ft::make_pair(key, (int)i)).second == im.insert(ft::make_pair(key, (int)i)).second;
+            else
+                cond = m.erase(key) == im.erase(key);
+        }
+        cond = cond && m.size() == im.size();
+        scan_map::iterator it = m.begin();
+        for (imap::iterator it2 = im.begin(); cond && it2 != im.end(); ++it, ++it2)
+            cond = it->first == it2->first && it->second == it2->second;
+        cond = cond && im.find(m.begin()->first) != im.end() && im.count(ft::make_pair(-1, 0)) == 0;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / swap / clear "
+              << "] --------------------]\t\t\033[0m";
+    {
+        imap im, other;
+        for (int i = 0; i < 100; i++)
+            im.insert(ft::make_pair(ft::make_pair(i * 10, i * 10 + 5), i));
+        imap copy(im);
+        copy.erase(ft::make_pair(0, 5));
+        bool cond = copy.size() == 99 && im.overlaps(0, 1) && !copy.overlaps(0, 1) && copy.overlaps(990, 991);
+        other.swap(copy);
+        cond = cond && copy.empty() && other.size() == 99 && !other.overlaps(995, 2000);
+        other.clear();
+        EQUAL(cond && other.empty() && !other.overlaps(0, 1000));
+    }
+}
+
+void testOverlaps()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " overlaps / overlapping "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(3);
+        std::uniform_int_distribution<int> distr(0, 1e5);
+        scan_map m;
+        imap im;
+
+        for (size_t i = 0; i < 2e4 && cond; i++)
+        {
+            int lo = distr(generator);
+            ft::pair<int, int> key(lo, lo + distr(generator) % ((i % 10) ? 50 : 5000) + 1);
+            if (i % 5)
+            {
+                m.insert(ft::make_pair(key, 0));
+                im.insert(ft::make_pair(key, 0));
+            }
+            else if (m.lower_bound(key) != m.end())
+            {
+                key = m.lower_bound(key)->first;
+                m.erase(key);
+                im.erase(im.find(key));
+            }
+            if (i % 10 == 0)
+            {
+                int qlo = distr(generator), qhi = qlo + distr(generator) % 200;
+                ft::vector<imap::iterator> found;
+                im.overlapping(qlo, qhi, std::back_inserter(found));
+                size_t expected = scanOverlapping(m, qlo, qhi);
+                cond = found.size() == expected && im.overlaps(qlo, qhi) == (expected != 0);
+                for (size_t j = 0; cond && j < found.size(); j++)
+                    cond = found[j]->first.first < qhi && qlo < found[j]->first.second && (j == 0 || found[j - 1]->first < found[j]->first);
+            }
+        }
+        EQUAL(cond && m.size() == im.size());
+    }
+}
+
+void testOverlapTime()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " overlapping O(min(n, k log n)) vs scan "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(5);
+        std::uniform_int_distribution<int> distr(0, 1e7);
+        scan_map m;
+        imap im;
+        size_t sum(0), im_sum(0);
+
+        for (size_t i = 0; i < 1e5; i++)
+        {
+            int lo = distr(generator);
+            m.insert(ft::make_pair(ft::make_pair(lo, lo + 100), 0));
+            im.insert(ft::make_pair(ft::make_pair(lo, lo + 100), 0));
+        }
+        start = get_time();
+        for (int i = 0; i < 200; i++)
+            sum += scanOverlapping(m, i * 5e4, i * 5e4 + 1000);
+        end = get_time();
+        diff = end - start;
+        time_t scan_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        ft::vector<imap::iterator> found;
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 200; i++)
+        {
+            found.clear();
+            im.overlapping(i * 5e4, i * 5e4 + 1000, std::back_inserter(found));
+            im_sum += found.size();
+        }
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sum == im_sum);
+        std::cout << "\t\t(linear scan " << scan_diff << "ms, overlapping " << end - start << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing interval_map;" << RESET << std::endl;
+    TEST_CASE(testInsertErase);
+    TEST_CASE(testOverlaps);
+    TEST_CASE(testOverlapTime);
+    std::cout << std::endl;
+    return 0;
+}
@@ -25,6 +25,8 @@
 #include <signal.h>
 #include <sys/time.h>
 #include <random>
+#include <cstdio>
+#include <cctype>
 
 #define BLUE "\e[0;34m"
 #define RED "\e[0;31m"
@@ -2210,6 +2212,797 @@ void testRetionalOperators()
     EQUAL(((foo <= bar) == (ft_foo <= ft_bar)) && (res == ft_res));
 }
 
+template <typename Map>
+time_t findAll(const Map &m, const std::vector<std::string> &keys, size_t &found)
+{
+    time_t start = get_time();
+    found = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        found += m.count(keys[i]);
+    return (get_time() - start);
+}
+
+template <typename Map>
+bool prefixCase(const char *title, const std::vector<std::string> &keys, const std::vector<std::string> &probes)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << title
+              << "] --------------------]\t\t\033[0m";
+    bool cond(true);
+    std::map<std::string, int> m;
+    ft::map<std::string, int> ft_m;
+    Map ft_pm;
+    size_t found, ft_found, pm_found;
+
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        m.insert(std::make_pair(keys[i], i));
+        ft_m.insert(ft::make_pair(keys[i], i));
+        ft_pm.insert(ft::make_pair(keys[i], i));
+    }
+    for (size_t i = 0; i < keys.size(); i += 3)
+    {
+        m.erase(keys[i]);
+        ft_m.erase(keys[i]);
+        ft_pm.erase(keys[i]);
+    }
+    cond = m.size() == ft_pm.size() && comparemaps(m.begin(), m.end(), ft_pm.begin(), ft_pm.end());
+
+    time_t diff = findAll(ft_m, probes, ft_found);
+    time_t ft_diff = diff;
+    diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+    ualarm(diff * 1e3, 0);
+    time_t pm_diff = findAll(ft_pm, probes, pm_found);
+    ualarm(0, 0);
+    findAll(m, probes, found);
+
+    cond = cond && found == ft_found && found == pm_found;
+    EQUAL(cond);
+    std::cout << "\t\t(ft::map " << ft_diff << "ms, string_prefix_less " << pm_diff << "ms)" << std::endl;
+    return (cond);
+}
+
+void testKeyPrefix()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> len(4, 24);
+    std::uniform_int_distribution<int> chr('a', 'z');
+    std::vector<std::string> random_keys, shared_keys, probes;
+
+    for (size_t i = 0; i < 2e5; i++)
+    {
+        std::string key(len(generator), 'a');
+        for (size_t j = 0; j < key.size(); j++)
+            key[j] = chr(generator);
+        random_keys.push_back(key);
+    }
+    for (size_t i = 0; i < 2e5; i++)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%s/%08zu", (i % 2) ? "tenant/eu" : "tenant/us", (i * 7919) % 1000003);
+        shared_keys.push_back(buf);
+    }
+    probes = random_keys;
+    for (size_t i = 0; i < 1e5; i++)
+        probes.push_back(random_keys[i].substr(0, random_keys[i].size() / 2));
+    prefixCase<ft::map<std::string, int, ft::string_prefix_less> >(" random keys ", random_keys, probes);
+    probes = shared_keys;
+    for (size_t i = 0; i < 1e5; i++)
+        probes.push_back(shared_keys[i] + "x");
+    prefixCase<ft::map<std::string, int, ft::string_prefix_less> >(" shared-prefix keys ", shared_keys, probes);
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " embedded zero bytes "
+              << "] --------------------]\t\t\033[0m";
+    {
+        std::map<std::string, int> m;
+        ft::map<std::string, int, ft::string_prefix_less> ft_m;
+        const char *raw[] = {"", "a", "ab", "ab\0", "ab\0\0", "abcdefgh", "abcdefgh\0", "abcdefghi", "abcdefgg\xff", "\xff"};
+        const size_t sizes[] = {0, 1, 2, 3, 4, 8, 9, 9, 9, 1};
+        for (size_t i = 0; i < 10; i++)
+        {
+            m[std::string(raw[i], sizes[i])] = i;
+            ft_m[std::string(raw[i], sizes[i])] = i;
+        }
+        EQUAL(m.size() == ft_m.size() && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()));
+    }
+}
+
+void testOrderStatistics()
+{
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::subtree_size> os_map;
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " rank / select / count_range "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::map<int, int> m;
+        os_map ft_m;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3)
+            {
+                m[k] = i;
+                ft_m[k] = i;
+            }
+            else
+            {
+                m.erase(k);
+                ft_m.erase(k);
+            }
+            if (i % 1000 == 0)
+            {
+                int lo = distr(generator), hi = distr(generator);
+                size_t rank = std::distance(m.begin(), m.lower_bound(lo));
+                size_t range = (lo < hi) ? std::distance(m.lower_bound(lo), m.lower_bound(hi)) : 0;
+                std::map<int, int>::iterator it = m.begin();
+                std::advance(it, rank);
+                cond = ft_m.rank(lo) == rank && ft_m.count_range(lo, hi) == range;
+                cond = cond && ((it == m.end()) ? ft_m.select(rank) == ft_m.end() : ft_m.select(rank)->first == it->first);
+                cond = cond && ft::distance(ft_m.lower_bound(lo), ft_m.end()) == std::distance(m.lower_bound(lo), m.end());
+            }
+        }
+        cond = cond && m.size() == ft_m.size() && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end());
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " rank vs linear distance "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, int> ft_m;
+        os_map os_m;
+        size_t sum(0), os_sum(0);
+
+        for (size_t i = 0; i < 1e5; i++)
+        {
+            ft_m.insert(ft::make_pair(i, i));
+            os_m.insert(ft::make_pair(i, i));
+        }
+        start = get_time();
+        for (size_t i = 0; i < 1e5; i += 100)
+            sum += ft::distance(ft_m.begin(), ft_m.lower_bound(i));
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 0; i < 1e5; i += 100)
+            os_sum += os_m.rank(i);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sum == os_sum);
+        std::cout << "\t\t(ft::distance " << ft_diff << "ms, rank " << end - start << "ms)" << std::endl;
+    }
+}
+
+void testSplitJoin()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " split_at / append_ordered "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(17);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 200 && cond; round++)
+        {
+            std::map<int, int> m, upper;
+            ft::map<int, int> ft_m, ft_upper;
+            size_t n = distr(generator) % 2000;
+            for (size_t i = 0; i < n; i++)
+            {
+                int k = distr(generator);
+                m[k] = i;
+                ft_m[k] = i;
+            }
+            int k = distr(generator);
+            ft_upper[-1] = 0;
+            upper.insert(m.lower_bound(k), m.end());
+            m.erase(m.lower_bound(k), m.end());
+            ft_m.split_at(k, ft_upper);
+            cond = m.size() == ft_m.size() && upper.size() == ft_upper.size();
+            cond = cond && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end());
+            cond = cond && comparemaps(upper.begin(), upper.end(), ft_upper.begin(), ft_upper.end());
+            m[-2] = 0;
+            ft_m[-2] = 0;
+            m.insert(upper.begin(), upper.end());
+            ft_m.append_ordered(ft_upper);
+            cond = cond && ft_upper.empty() && m.size() == ft_m.size() && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end());
+        }
+        ft::map<int, int> low, high;
+        low[1] = 1;
+        high[0] = 0;
+        try
+        {
+            low.append_ordered(high);
+            cond = false;
+        }
+        catch (std::invalid_argument &)
+        {
+        }
+        EQUAL(cond && low.size() == 1 && high.size() == 1);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " split/append vs reinsert "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, int> hot, cold;
+        ft::map<int, int> ft_hot, ft_cold;
+
+        for (size_t i = 0; i < 1e6; i++)
+        {
+            hot.insert(ft::make_pair(i, i));
+            ft_hot.insert(ft::make_pair(i, i));
+        }
+        start = get_time();
+        for (size_t i = 1; i <= 10; i++) // tier the oldest tenth out, ten times
+        {
+            ft::map<int, int>::iterator bound = hot.lower_bound(i * 1e4);
+            cold.insert(hot.begin(), bound);
+            hot.erase(hot.begin(), bound);
+        }
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 1; i <= 10; i++)
+        {
+            ft::map<int, int> old;
+            ft_hot.split_at(i * 1e4, old);
+            ft_hot.swap(old);
+            ft_cold.append_ordered(old);
+        }
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(hot.size() == ft_hot.size() && cold.size() == ft_cold.size() && ft_hot.begin()->first == 100000);
+        std::cout << "\t\t(reinsert " << ft_diff << "ms, split/append " << end - start << "ms)" << std::endl;
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " split_at into itself "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::map<int, int> m;
+        for (int i = 0; i < 10; i++)
+            m[i] = i * i;
+        bool thrown(false);
+        try { m.split_at(5, m); } catch (const std::invalid_argument &) { thrown = true; }
+        EQUAL(thrown && m.size() == 10 && m.at(9) == 81);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " merge into itself "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::map<int, int> m;
+        for (int i = 0; i < 10; i++)
+            m[i] = i * i;
+        m.merge(m);
+        bool cond = m.size() == 10 && m.begin()->first == 0 && (--m.end())->second == 81;
+        for (int i = 0; i < 10 && cond; i++)
+            cond = m.at(i) == i * i;
+        EQUAL(cond);
+    }
+}
+
+void testNodeHandles()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " extract / insert node "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(31);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::map<int, std::string> m, other;
+        ft::map<int, std::string> ft_m, ft_other;
+
+        for (size_t i = 0; i < 1e4; i++)
+        {
+            int k = distr(generator);
+            m[k] = std::to_string(k);
+            ft_m[k] = std::to_string(k);
+        }
+        for (size_t i = 0; i < 2e4 && cond; i++)
+        {
+            int k = distr(generator);
+            ft::map<int, std::string>::node_type nh = (i % 2) ? ft_m.extract(k) : ft_other.extract(k);
+            std::map<int, std::string> &from = (i % 2) ? m : other, &to = (i % 2) ? other : m;
+            cond = nh.empty() == (from.count(k) == 0);
+            if (!nh.empty())
+            {
+                cond = cond && nh.value().first == k && nh.mapped() == from[k];
+                nh.mapped() += "!";
+                to[k] = from[k] + "!";
+                from.erase(k);
+                ft::map<int, std::string>::insert_return_type ret = (i % 2) ? ft_other.insert(nh) : ft_m.insert(nh);
+                cond = cond && ret.inserted && ret.node.empty() && nh.empty() && ret.position->second == to[k];
+            }
+        }
+        ft_m[-1] = "a";
+        ft_other[-1] = "b";
+        ft::map<int, std::string>::insert_return_type ret = ft_m.insert(ft_other.extract(-1));
+        cond = cond && !ret.inserted && ret.position->second == "a" && ret.node.mapped() == "b";
+        ft_m.erase(-1);
+        ft_other.erase(-1);
+        cond = cond && m.size() == ft_m.size() && other.size() == ft_other.size();
+        cond = cond && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && comparemaps(other.begin(), other.end(), ft_other.begin(), ft_other.end());
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " extract/insert vs erase/insert "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, std::string> hot, cold, ft_hot, ft_cold;
+
+        for (size_t i = 0; i < 3e5; i++)
+        {
+            hot.insert(ft::make_pair(i, std::string(64, 'x')));
+            ft_hot.insert(ft::make_pair(i, std::string(64, 'x')));
+        }
+        start = get_time();
+        for (size_t i = 0; i < 3e5; i += 2)
+        {
+            ft::map<int, std::string>::iterator it = hot.find(i);
+            cold.insert(*it);
+            hot.erase(it);
+        }
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 0; i < 3e5; i += 2)
+            ft_cold.insert(ft_hot.extract(i));
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(hot.size() == ft_hot.size() && cold.size() == ft_cold.size() && comparemaps(cold.begin(), cold.end(), ft_cold.begin(), ft_cold.end()));
+        std::cout << "\t\t(erase/insert " << ft_diff << "ms, extract/insert " << end - start << "ms)" << std::endl;
+    }
+}
+
+void testThreaded()
+{
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::threaded<> > threaded_map;
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " threaded iteration "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(33);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::map<int, int> m;
+        threaded_map ft_m;
+
+        for (size_t i = 0; i < 5e4 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3)
+            {
+                m[k] = i;
+                ft_m[k] = i;
+            }
+            else
+            {
+                threaded_map::iterator it = ft_m.lower_bound(k);
+                if (it != ft_m.end())
+                {
+                    m.erase(it->first);
+                    ft_m.erase(it);
+                }
+            }
+            if (i % 5000 == 0)
+            {
+                threaded_map rest;
+                ft_m.split_at(k, rest);
+                threaded_map copy(rest);
+                ft_m.append_ordered(copy);
+                cond = comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size();
+            }
+        }
+        std::map<int, int>::reverse_iterator rit = m.rbegin();
+        for (threaded_map::reverse_iterator ft_rit = ft_m.rbegin(); cond && ft_rit != ft_m.rend(); ++ft_rit, ++rit)
+            cond = ft_rit->first == rit->first && ft_rit->second == rit->second;
+        EQUAL(cond && rit == m.rend());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " full scan: climbing vs threaded "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, int> m;
+        threaded_map ft_m;
+        long sum(0), ft_sum(0);
+
+        for (size_t i = 0; i < 1e6; i++)
+        {
+            int k = (i * 7919) % 1000003;
+            m.insert(ft::make_pair(k, k));
+            ft_m.insert(ft::make_pair(k, k));
+        }
+        start = get_time();
+        for (int r = 0; r < 10; r++)
+            for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+                sum += it->second;
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int r = 0; r < 10; r++)
+            for (threaded_map::iterator it = ft_m.begin(); it != ft_m.end(); ++it)
+                ft_sum += it->second;
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sum == ft_sum);
+        std::cout << "\t\t(climbing " << ft_diff << "ms, threaded " << end - start << "ms)" << std::endl;
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " erase loop: climbing vs threaded "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, int> m;
+        threaded_map ft_m;
+
+        for (size_t i = 0; i < 1e6; i++)
+        {
+            m.insert(ft::make_pair(i, i));
+            ft_m.insert(ft::make_pair(i, i));
+        }
+        start = get_time();
+        for (ft::map<int, int>::iterator it = m.begin(); it != m.end();)
+            if (it->first % 2)
+                m.erase(it++);
+            else
+                ++it;
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (threaded_map::iterator it = ft_m.begin(); it != ft_m.end();)
+            if (it->first % 2)
+                ft_m.erase(it++);
+            else
+                ++it;
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(m.size() == ft_m.size() && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()));
+        std::cout << "\t\t(climbing " << ft_diff << "ms, threaded " << end - start << "ms)" << std::endl;
+    }
+}
+
+void testCompact()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " compact "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(34);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::map<int, std::string> m;
+        ft::map<int, std::string> ft_m, ft_other;
+
+        for (size_t i = 0; i < 5e4 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3)
+            {
+                m[k] = std::to_string(i);
+                ft_m[k] = std::to_string(i);
+            }
+            else if (i % 2)
+            {
+                m.erase(k);
+                ft_m.erase(k);
+            }
+            else
+            {
+                ft::map<int, std::string>::node_type nh = ft_m.extract(k);
+                m.erase(k);
+                if (!nh.empty())
+                    ft_other.insert(nh);
+            }
+            if (i % 5000 == 0)
+            {
+                ft_m.compact();
+                cond = comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size();
+            }
+        }
+        ft_other.clear();
+        ft_m.compact();
+        ft_m[-1] = "-1";
+        m[-1] = "-1";
+        EQUAL(cond && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " lookups: fragmented vs compacted "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(35);
+        std::uniform_int_distribution<int> distr(0, 4e6);
+        ft::map<int, int> ft_m;
+        std::vector<int *> noise;
+        std::vector<int> keys;
+        long found(0), ft_found(0);
+
+        for (size_t i = 0; i < 2e6; i++)
+        {
+            ft_m[distr(generator)] = i;
+            noise.push_back(new int(i));
+            if (i % 2)
+                ft_m.erase(distr(generator));
+        }
+        for (size_t i = 0; i < noise.size(); i++)
+            delete noise[i];
+        for (size_t i = 0; i < 2e6; i++)
+            keys.push_back(distr(generator));
+        start = get_time();
+        for (size_t i = 0; i < keys.size(); i++)
+            found += ft_m.count(keys[i]);
+        for (int r = 0; r < 5; r++)
+            for (ft::map<int, int>::iterator it = ft_m.begin(); it != ft_m.end(); ++it)
+                found += it->second & 1;
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        ft_m.compact();
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 0; i < keys.size(); i++)
+            ft_found += ft_m.count(keys[i]);
+        for (int r = 0; r < 5; r++)
+            for (ft::map<int, int>::iterator it = ft_m.begin(); it != ft_m.end(); ++it)
+                ft_found += it->second & 1;
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(found == ft_found);
+        std::cout << "\t\t(fragmented " << ft_diff << "ms, compacted " << end - start << "ms)" << std::endl;
+    }
+}
+
+void testFreeze()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " freeze "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(35);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 100 && cond; round++)
+        {
+            std::map<int, std::string> m;
+            ft::map<int, std::string> ft_m;
+            size_t n = distr(generator) % 1000;
+            for (size_t i = 0; i < n; i++)
+            {
+                int k = distr(generator);
+                m[k] = std::to_string(k);
+                ft_m[k] = std::to_string(k);
+            }
+            ft::frozen_map<int, std::string> frozen = ft_m.freeze(), copy;
+            copy = frozen;
+            cond = copy.size() == m.size() && comparemaps(m.begin(), m.end(), copy.begin(), copy.end());
+            cond = cond && comparemaps(m.rbegin(), m.rend(), frozen.rbegin(), frozen.rend());
+            for (size_t q = 0; q < 200 && cond; q++)
+            {
+                int k = distr(generator);
+                std::map<int, std::string>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+                ft::frozen_map<int, std::string>::const_iterator ft_lb = frozen.lower_bound(k), ft_ub = frozen.upper_bound(k);
+                cond = (lb == m.end()) == (ft_lb == frozen.end()) && (lb == m.end() || lb->first == ft_lb->first);
+                cond = cond && (ub == m.end()) == (ft_ub == frozen.end()) && (ub == m.end() || ub->first == ft_ub->first);
+                cond = cond && m.count(k) == frozen.count(k) && (!m.count(k) || frozen.find(k)->second == m[k]);
+            }
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " lookups: map vs frozen_map "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(36);
+        std::uniform_int_distribution<int> distr(0, 4e6);
+        ft::map<int, int> m;
+        std::vector<int> keys;
+        long found(0), ft_found(0);
+
+        for (size_t i = 0; i < 2e6; i++)
+            m[distr(generator)] = i;
+        for (size_t i = 0; i < 2e6; i++)
+            keys.push_back(distr(generator));
+        ft::frozen_map<int, int> ft_m = m.freeze();
+        start = get_time();
+        for (size_t i = 0; i < keys.size(); i++)
+            found += m.count(keys[i]);
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 0; i < keys.size(); i++)
+            ft_found += ft_m.count(keys[i]);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(found == ft_found);
+        std::cout << "\t\t(map " << ft_diff << "ms, frozen_map " << end - start << "ms)" << std::endl;
+    }
+}
+
+// A key compared without case, so its ft::hash has to ignore case too.
+struct Word
+{
+    std::string s;
+
+    Word(const std::string &x) : s(x) {}
+    std::string lowered() const
+    {
+        std::string l(s);
+        for (size_t i = 0; i < l.size(); i++)
+            l[i] = std::tolower(static_cast<unsigned char>(l[i]));
+        return l;
+    }
+};
+struct WordLess
+{
+    bool operator()(const Word &a, const Word &b) const { return a.lowered() < b.lowered(); }
+};
+namespace ft
+{
+template <>
+struct hash<Word>
+{
+    std::size_t operator()(const Word &w) const { return ft::hash<std::string>()(w.lowered()); }
+};
+}
+
+void testFiltered()
+{
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::filtered<> > filtered_map;
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " filtered map "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(44);
+        std::uniform_int_distribution<int> distr(0, 2e4);
+        std::map<int, int> m;
+        filtered_map ft_m;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 4 == 0)
+                cond = m.erase(k) == ft_m.erase(k);
+            else if (i % 4 == 1)
+            {
+                m[k] = i;
+                ft_m[k] = i;
+            }
+            else if (i % 4 == 2)
+            {
+                filtered_map::iterator it = ft_m.lower_bound(k); // Erasing by position leaves stale keys too.
+                if (it != ft_m.end())
+                {
+                    m.erase(it->first);
+                    ft_m.erase(it);
+                }
+            }
+            else
+                cond = m.count(k) == ft_m.count(k) && (ft_m.find(k) == ft_m.end() || ft_m.find(k)->second == m[k]);
+            if (i % 10000 == 0)
+            {
+                filtered_map rest, copy;
+                ft_m.split_at(k, rest);
+                copy = rest;
+                cond = cond && (rest.empty() || copy.count(rest.begin()->first)) && !ft_m.count(k);
+                ft_m.append_ordered(copy);
+                filtered_map::node_type nh = ft_m.extract(k);
+                if (!nh.empty())
+                    ft_m.insert(nh);
+                cond = cond && comparemaps(m.begin(), m.end(), ft_m.begin(), ft_m.end()) && m.size() == ft_m.size();
+            }
+        }
+        for (std::map<int, int>::iterator it = m.begin(); cond && it != m.end(); ++it)
+            cond = ft_m.count(it->first) == 1;
+        filtered_map other;
+        other[-1] = -1;
+        other.swap(ft_m);
+        cond = cond && ft_m.count(-1) && !ft_m.count(m.begin()->first) && other.size() == m.size();
+        other.clear();
+        cond = cond && !other.count(m.begin()->first) && other.empty();
+        other[1] = 1;
+        cond = cond && other.count(1) && other.size() == 1;
+
+        ft::map<std::string, int, std::less<std::string>, std::allocator<ft::pair<const std::string, int> >, ft::filtered<> > words;
+        for (int i = 0; i < 1000; i++)
+            words[std::to_string(i * 7)] = i;
+        for (int i = 0; i < 7000 && cond; i++)
+            cond = words.count(std::to_string(i)) == (i % 7 == 0);
+
+        ft::map<Word, int, WordLess, std::allocator<ft::pair<const Word, int> >, ft::filtered<> > nocase;
+        nocase.insert(ft::make_pair(Word("Hello"), 1));
+        nocase.insert(ft::make_pair(Word("World"), 2));
+        cond = cond && nocase.count(Word("HELLO")) && nocase.find(Word("world"))->second == 2
+               && nocase.erase(Word("hello")) == 1 && nocase.size() == 1;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " bloom false positive rate "
+              << "] --------------------]\t\t\033[0m";
+    {
+        size_t n = 1e6;
+        ft::blocked_bloom<> bloom;
+        ft::hash<int> hash;
+        bloom.reset(n);
+        for (size_t i = 0; i < n; i++)
+            bloom.insert(ft::hash_mix(hash(i)));
+        bool cond(true);
+        size_t positives(0), half_positives(0);
+        for (size_t i = 0; i < n; i++)
+        {
+            cond = cond && bloom.may_contain(ft::hash_mix(hash(i)));
+            positives += bloom.may_contain(ft::hash_mix(hash(n + i)));
+        }
+        bloom.reset(2 * n); // A filter right after its rebuild.
+        for (size_t i = 0; i < n; i++)
+            bloom.insert(ft::hash_mix(hash(i)));
+        for (size_t i = 0; i < n; i++)
+            half_positives += bloom.may_contain(ft::hash_mix(hash(n + i)));
+        double full = 100.0 * positives / n, half = 100.0 * half_positives / n;
+        EQUAL(cond && full < 1.5 && half < 0.1);
+        std::cout << std::setprecision(3) << "\t\t(full " << full << "%, half full " << half << "%, "
+                  << bloom.bytes() * 8.0 / (2 * n) << " bits per key)" << std::endl;
+    }
+    std::mt19937 generator(45);
+    ft::map<int, int> ft_m;
+    filtered_map filtered;
+
+    for (int i = 0; i < 1e6; i++) // Even keys are there, odd ones are not.
+    {
+        int k = (generator() % 2000000) & ~1;
+        ft_m[k] = i;
+        filtered[k] = i;
+    }
+    int misses[] = {0, 50, 90, 99};
+    for (int m = 0; m < 4; m++)
+    {
+        std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                  << (" count, " + std::to_string(misses[m]) + "% misses: plain vs filtered ")
+                  << "] --------------------]\t\t\033[0m";
+        time_t start, end, diff;
+        std::vector<int> keys;
+        long found(0), ft_found(0);
+
+        for (size_t i = 0; i < 1e6; i++)
+            keys.push_back(((generator() % 2000000) & ~1) | (int(generator() % 100) < misses[m]));
+        start = get_time();
+        for (size_t i = 0; i < keys.size(); i++)
+            found += ft_m.count(keys[i]);
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (size_t i = 0; i < keys.size(); i++)
+            ft_found += filtered.count(keys[i]);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(found == ft_found);
+        std::cout << "\t\t(plain " << ft_diff << "ms, filtered " << end - start << "ms)" << std::endl;
+    }
+}
+
 void alarm_handler(int seg)
 {
     (void)seg;
@@ -2270,5 +3063,31 @@ int main()
     std::cout << YELLOW << "Testing Non-Member Swap  ; " << RESET << std::endl;
     TEST_CASE(testNonMemberSwap);
     std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Key Prefix Caching; " << RESET << std::endl;
+    TEST_CASE(testKeyPrefix);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Order Statistics; " << RESET << std::endl;
+    TEST_CASE(testOrderStatistics);
+    TEST_CASE(testSplitJoin);
+    TEST_CASE(testNodeHandles);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Threaded Iteration; " << RESET << std::endl;
+    TEST_CASE(testThreaded);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Compaction; " << RESET << std::endl;
+    TEST_CASE(testCompact);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Frozen Maps; " << RESET << std::endl;
+    TEST_CASE(testFreeze);
+    std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Filtered Lookups; " << RESET << std::endl;
+    TEST_CASE(testFiltered);
+    std::cout << std::endl;
     return 0;
 }
@@ -0,0 +1,255 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap_tests.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../multimap.hpp"
+
+#include <map>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::multimap methods can be slower up to std::multimap methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::multimap<int, int> ft_mmap;
+typedef ft::multimap<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::subtree_size> os_mmap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <class Map>
+bool sameMaps(const Map &ft_m, const std::multimap<int, int> &m)
+{
+    if (ft_m.size() != m.size())
+        return false;
+    std::multimap<int, int>::const_iterator it = m.begin();
+    for (typename Map::const_iterator it2 = ft_m.begin(); it2 != ft_m.end(); ++it, ++it2)
+        if (it->first != it2->first || it->second != it2->second)
+            return false;
+    return true;
+}
+
+void testModifiers()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(37);
+        std::uniform_int_distribution<int> distr(0, 500);
+        std::multimap<int, int> m;
+        ft_mmap ft_m;
+
+        for (int i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 5 < 3)
+            {
+                m.insert(std::make_pair(k, i));
+                ft_m.insert(ft::make_pair(k, i));
+            }
+            else if (i % 5 == 3)
+            {
+                m.insert(m.lower_bound(k), std::make_pair(k, i));
+                ft_m.insert(ft_m.lower_bound(k), ft::make_pair(k, i));
+                m.insert(m.begin(), std::make_pair(k, -i)); // a wrong hint
+                ft_m.insert(ft_m.begin(), ft::make_pair(k, -i));
+            }
+            else if (i % 10 == 4)
+                cond = m.erase(k) == ft_m.erase(k);
+            else if (m.find(k) != m.end())
+            {
+                cond = ft_m.find(k)->second == m.find(k)->second;
+                m.erase(m.find(k));
+                ft_m.erase(ft_m.find(k));
+            }
+        }
+        EQUAL(cond && sameMaps(ft_m, m));
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / compare / swap "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft_mmap a;
+        for (int i = 0; i < 100; i++)
+            a.insert(ft::make_pair(i % 10, i));
+        ft_mmap b(a.begin(), a.end());
+        bool cond = a == b && !(a < b) && a <= b;
+        b.insert(ft::make_pair(9, 0));
+        cond = cond && a != b && a < b && b > a;
+        a.swap(b);
+        cond = cond && a.size() == 101 && b.size() == 100;
+        EQUAL(cond);
+    }
+}
+
+void testLookup()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " equal_range / count / bounds "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(41);
+        std::uniform_int_distribution<int> distr(0, 1000);
+        std::multimap<int, int> m;
+        ft_mmap ft_m;
+        os_mmap os_m;
+
+        for (int i = 0; i < 5e4; i++)
+        {
+            int k = distr(generator);
+            m.insert(std::make_pair(k, i));
+            ft_m.insert(ft::make_pair(k, i));
+            os_m.insert(ft::make_pair(k, i));
+        }
+        for (int k = -1; k <= 1001 && cond; k++)
+        {
+            ft::pair<ft_mmap::iterator, ft_mmap::iterator> range = ft_m.equal_range(k);
+            std::pair<std::multimap<int, int>::iterator, std::multimap<int, int>::iterator> std_range = m.equal_range(k);
+            cond = ft_m.count(k) == m.count(k) && os_m.count(k) == m.count(k);
+            for (; cond && std_range.first != std_range.second; ++range.first, ++std_range.first)
+                cond = range.first->second == std_range.first->second;
+            cond = cond && range.first == range.second;
+            cond = cond && (ft_m.upper_bound(k) == ft_m.end()) == (m.upper_bound(k) == m.end());
+        }
+        EQUAL(cond && sameMaps(os_m, m));
+    }
+}
+
+void testTime()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert time "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(43);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::multimap<int, int> m;
+        ft_mmap ft_m;
+
+        start = get_time();
+        for (int i = 0; i < 1e6; i++)
+            m.insert(std::make_pair(distr(generator), i));
+        end = get_time();
+        diff = end - start;
+        time_t std_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        generator.seed(43);
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e6; i++)
+            ft_m.insert(ft::make_pair(distr(generator), i));
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sameMaps(ft_m, m));
+        std::cout << "\t\t(std " << std_diff << "ms, ft " << end - start << "ms)" << std::endl;
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " hinted insert time "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::multimap<int, int> m;
+        ft_mmap ft_m;
+
+        start = get_time();
+        for (int i = 0; i < 1e6; i++)
+            m.insert(m.end(), std::make_pair(i / 8, i));
+        end = get_time();
+        diff = end - start;
+        time_t std_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e6; i++)
+            ft_m.insert(ft_m.end(), ft::make_pair(i / 8, i));
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sameMaps(ft_m, m));
+        std::cout << "\t\t(std " << std_diff << "ms, ft " << end - start << "ms)" << std::endl;
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " equal_range / count time "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::multimap<int, int> m;
+        os_mmap os_m;
+        size_t sum(0), os_sum(0);
+
+        for (int i = 0; i < 1e6; i++)
+        {
+            m.insert(std::make_pair(i % 100, i));
+            os_m.insert(ft::make_pair(i % 100, i));
+        }
+        start = get_time();
+        for (int i = 0; i < 1e4; i++)
+            sum += m.count(i % 100);
+        end = get_time();
+        diff = end - start;
+        time_t std_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e4; i++)
+            os_sum += os_m.count(i % 100);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sum == os_sum);
+        std::cout << "\t\t(std " << std_diff << "ms, ft subtree_size " << end - start << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing multimap;" << RESET << std::endl;
+    TEST_CASE(testModifiers);
+    TEST_CASE(testLookup);
+    TEST_CASE(testTime);
+    std::cout << std::endl;
+    return 0;
+}
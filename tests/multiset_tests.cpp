@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multiset_tests.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../multiset.hpp"
+
+#include <set>
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::multiset methods can be slower up to std::multiset methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+void testMultiset()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase / count "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(47);
+        std::uniform_int_distribution<int> distr(0, 300);
+        std::multiset<int> st;
+        ft::multiset<int> ft_st;
+
+        for (int i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 4 == 0)
+                cond = st.erase(k) == ft_st.erase(k);
+            else if (i % 4 == 1)
+            {
+                st.insert(st.upper_bound(k), k);
+                ft_st.insert(ft_st.upper_bound(k), k);
+            }
+            else
+            {
+                st.insert(k);
+                ft_st.insert(k);
+            }
+            if (i % 100 == 0)
+                cond = cond && st.count(k) == ft_st.count(k) && (st.find(k) == st.end()) == (ft_st.find(k) == ft_st.end());
+        }
+        EQUAL(cond && st.size() == ft_st.size() && std::equal(st.begin(), st.end(), ft_st.begin()));
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert time "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::multiset<int> st;
+        ft::multiset<int> ft_st;
+
+        start = get_time();
+        for (int i = 0; i < 1e6; i++)
+            st.insert(i % 1000);
+        end = get_time();
+        diff = end - start;
+        time_t std_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e6; i++)
+            ft_st.insert(i % 1000);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(st.size() == ft_st.size() && std::equal(st.begin(), st.end(), ft_st.begin()));
+        std::cout << "\t\t(std " << std_diff << "ms, ft " << end - start << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing multiset;" << RESET << std::endl;
+    TEST_CASE(testMultiset);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,214 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map_tests.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../persistent_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::persistent_map publishing can be slower up to a full copy * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::persistent_map<int, std::string> pmap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+bool sameContent(const pmap &pm, const std::map<int, std::string> &m)
+{
+    if (pm.size() != m.size())
+        return false;
+    std::map<int, std::string>::const_iterator it = m.begin();
+    for (pmap::const_iterator it2 = pm.begin(); it2 != pm.end(); ++it, ++it2)
+        if (it->first != it2->first || it->second != it2->second)
+            return false;
+    std::map<int, std::string>::const_reverse_iterator rit = m.rbegin();
+    for (pmap::const_reverse_iterator rit2 = pm.rbegin(); rit2 != pm.rend(); ++rit, ++rit2)
+        if (rit->first != rit2->first)
+            return false;
+    return true;
+}
+
+void testSnapshots()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / assign / erase "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(36);
+        std::uniform_int_distribution<int> distr(0, 5e3);
+        std::map<int, std::string> m;
+        pmap pm;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = m.erase(k) == pm.erase(k);
+            else if (i % 3 == 1)
+            {
+                m[k] = std::to_string(i);
+                cond = pm.assign(k, std::to_string(i))->second == m[k];
+            }
+            else
+                cond = m.insert(std::make_pair(k, std::to_string(k))).second == pm.insert(ft::make_pair(k, std::to_string(k))).second;
+        }
+        cond = cond && sameContent(pm, m);
+        for (int k = -1; k < 5e3 + 2 && cond; k += 7)
+        {
+            std::map<int, std::string>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+            pmap::const_iterator pm_lb = pm.lower_bound(k), pm_ub = pm.upper_bound(k);
+            cond = (lb == m.end()) == (pm_lb == pm.end()) && (lb == m.end() || lb->first == pm_lb->first);
+            cond = cond && (ub == m.end()) == (pm_ub == pm.end()) && (ub == m.end() || ub->first == pm_ub->first);
+            cond = cond && pm.count(k) == m.count(k);
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " snapshots stay unchanged "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(37);
+        std::uniform_int_distribution<int> distr(0, 2e3);
+        std::map<int, std::string> m;
+        std::vector<std::map<int, std::string> > expected;
+        std::vector<pmap> snapshots;
+        pmap pm;
+
+        for (size_t i = 0; i < 5e4; i++)
+        {
+            int k = distr(generator);
+            if (i % 2)
+            {
+                m.erase(k);
+                pm.erase(k);
+            }
+            else
+            {
+                m[k] = std::to_string(i);
+                pm.assign(k, std::to_string(i));
+            }
+            if (i % 2500 == 0)
+            {
+                snapshots.push_back(pm.snapshot());
+                expected.push_back(m);
+            }
+        }
+        pm.clear();
+        for (size_t i = 0; i < snapshots.size() && cond; i++)
+            cond = sameContent(snapshots[i], expected[i]);
+        pmap copy;
+        copy = snapshots.back();
+        copy.swap(pm);
+        cond = cond && copy.empty() && sameContent(pm, expected.back()) && pm.at(pm.begin()->first) == pm.begin()->second;
+        EQUAL(cond);
+    }
+}
+
+void testPublishTime()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " publish: map copy vs snapshot "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(38);
+        std::uniform_int_distribution<int> distr(0, 2e5);
+        ft::map<int, std::string> m;
+        pmap pm;
+        long seen(0), pm_seen(0);
+
+        for (int i = 0; i < 1e5; i++)
+        {
+            int k = distr(generator);
+            m[k] = std::to_string(k);
+            pm.assign(k, std::to_string(k));
+        }
+        start = get_time();
+        for (int i = 0; i < 200; i++)
+        {
+            int k = distr(generator);
+            m[k] = std::to_string(i);
+            ft::map<int, std::string> published(m);
+            seen += published.size();
+        }
+        end = get_time();
+        diff = end - start;
+        time_t copy_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        generator.seed(38);
+        for (int i = 0; i < 1e5; i++)
+            distr(generator);
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 200; i++)
+        {
+            int k = distr(generator);
+            pm.assign(k, std::to_string(i));
+            pmap published(pm.snapshot());
+            pm_seen += published.size();
+        }
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(seen == pm_seen);
+        std::cout << "\t\t(map copy " << copy_diff << "ms, snapshot " << end - start << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing persistent_map;" << RESET << std::endl;
+    TEST_CASE(testSnapshots);
+    TEST_CASE(testPublishTime);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,318 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   roaring_set_tests.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../roaring_set.hpp"
+#include "../set_algebra.hpp"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::roaring_set methods can be slower up to ft::set methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+size_t allocated = 0;
+
+// Counts the bytes the containers ask for, without the malloc overhead.
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+    counting_allocator() {}
+    template <class U>
+    counting_allocator(const counting_allocator<U> &) {}
+    T *allocate(size_t n, const void * = 0)
+    {
+        allocated += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n)
+    {
+        allocated -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+typedef ft::roaring_set<counting_allocator<uint32_t> > rset;
+typedef ft::set<uint32_t, std::less<uint32_t>, counting_allocator<uint32_t> > tset;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename Set>
+bool sameContent(const rset &rs, const Set &s)
+{
+    if (rs.size() != s.size())
+        return false;
+    typename Set::const_iterator it = s.begin();
+    for (rset::const_iterator it2 = rs.begin(); it2 != rs.end(); ++it, ++it2)
+        if (*it != *it2)
+            return false;
+    return true;
+}
+
+// Values spread over the whole range, packed into a few chunks, or in long
+// ranges: every kind of chunk.
+uint32_t randomValue(std::mt19937 &generator, int shape)
+{
+    if (shape == 0)
+        return generator();
+    if (shape == 1)
+        return (generator() % 4) << 16 | (generator() % 65536);
+    return (generator() % 4) << 16 | ((generator() % 8) * 4000 + generator() % 1000);
+}
+
+void testRoaringSet()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / erase / find / lower_bound "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(43);
+
+        for (int shape = 0; shape < 3 && cond; shape++)
+        {
+            std::set<uint32_t> s;
+            rset rs;
+            for (size_t i = 0; i < 2e5 && cond; i++)
+            {
+                uint32_t v = randomValue(generator, shape);
+                if (i % 3 == 0)
+                    cond = s.erase(v) == rs.erase(v);
+                else if (i % 3 == 1)
+                    cond = s.insert(v).second == rs.insert(v).second && *rs.find(v) == v;
+                else
+                {
+                    std::set<uint32_t>::iterator lb = s.lower_bound(v);
+                    rset::iterator rs_lb = rs.lower_bound(v);
+                    cond = (lb == s.end()) == (rs_lb == rs.end()) && (lb == s.end() || *lb == *rs_lb) && rs.count(v) == s.count(v);
+                }
+                if (i % 50000 == 0)
+                    rs.run_optimize(); // Runs are updated in place too.
+            }
+            cond = cond && sameContent(rs, s);
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " run_optimize "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::set<uint32_t> s;
+        size_t before = allocated;
+        rset rs;
+
+        for (uint32_t v = 1e5; v < 5e5; v++) // Full and partial chunks.
+            if (v % 1000 != 0)
+            {
+                rs.insert(v);
+                s.insert(v);
+            }
+        size_t bitmaps = allocated - before;
+        rs.run_optimize();
+        cond = sameContent(rs, s) && allocated - before < bitmaps / 10;
+        for (uint32_t v = 1e5; v < 5e5; v += 777) // Splits and joins runs.
+        {
+            cond = cond && rs.erase(v) == s.erase(v);
+            rs.insert(v + 1);
+            s.insert(v + 1);
+        }
+        cond = cond && sameContent(rs, s);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " union / intersection / difference "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(44);
+
+        for (int shapes = 0; shapes < 9 && cond; shapes++)
+        {
+            std::set<uint32_t> a, b;
+            rset ra, rb;
+            for (int i = 0; i < 3e4; i++)
+            {
+                uint32_t v = randomValue(generator, shapes % 3), w = randomValue(generator, shapes / 3);
+                a.insert(v);
+                ra.insert(v);
+                b.insert(w);
+                rb.insert(w);
+            }
+            if (shapes % 2)
+                ra.run_optimize();
+            std::vector<uint32_t> u, in, d;
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(u));
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(in));
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(d));
+            rset ru, rin, rd(ra);
+            ft::set_union(ra, rb, ru);
+            ft::set_intersection(ra, rb, rin);
+            ft::set_difference(rd, rb, rd); // The result may be an operand.
+            cond = sameContent(ru, u) && sameContent(rin, in) && sameContent(rd, d) && ft::set_intersection_size(ra, rb) == in.size();
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / swap / compare "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        rset rs, other;
+
+        for (uint32_t v = 0; v < 1e5; v += 3)
+            rs.insert(v * 7);
+        rset copy(rs);
+        other = copy;
+        cond = copy == rs && other == rs && !(other != rs);
+        other.insert(1);
+        cond = cond && other != rs;
+        copy.swap(other);
+        cond = cond && copy.size() == rs.size() + 1 && other == rs;
+        rset range(rs.begin(), rs.end());
+        cond = cond && range == rs;
+        range.clear();
+        cond = cond && range.empty() && range.begin() == range.end() && range.find(3) == range.end();
+        EQUAL(cond);
+    }
+}
+
+template <typename Set>
+time_t timeOps(const Set &a, const Set &b, int op, long &result, time_t limit = 0)
+{
+    time_t start, end;
+
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    for (int rep = 0; rep < 5; rep++)
+    {
+        Set out;
+        if (op == 0)
+            ft::set_intersection(a, b, out);
+        else if (op == 1)
+            ft::set_union(a, b, out);
+        else
+            ft::set_difference(a, b, out);
+        result += out.size();
+    }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"intersection", "union", "difference"};
+    const char *lists[] = {"sparse", "clustered"};
+
+    for (int list = 0; list < 2; list++)
+    {
+        size_t n = 5e5;
+        std::mt19937 generator(n);
+        std::vector<uint32_t> va(n), vb(n);
+        for (size_t i = 0; i < n; i++) // Ids anywhere, or a quarter of the ids below 4M.
+        {
+            va[i] = (list == 0) ? generator() : generator() % (4 << 20);
+            vb[i] = (list == 0) ? generator() % (1 << 30) : generator() % (4 << 20);
+        }
+        size_t before = allocated;
+        tset a(va.begin(), va.end()), b(vb.begin(), vb.end());
+        size_t set_bytes = allocated - before;
+        before = allocated;
+        rset ra(va.begin(), va.end()), rb(vb.begin(), vb.end());
+        ra.run_optimize();
+        rb.run_optimize();
+        size_t roaring_bytes = allocated - before;
+        std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                  << (" bytes per id " + std::string(lists[list]) + " " + std::to_string(n) + " ids ")
+                  << "] --------------------]\t\t\033[0m";
+        EQUAL(roaring_bytes < set_bytes && ra.size() == a.size() && rb.size() == b.size());
+        std::cout << "\t\t(set " << double(set_bytes) / (a.size() + b.size()) << " bytes, roaring_set "
+                  << double(roaring_bytes) / (ra.size() + rb.size()) << " bytes)" << std::endl;
+        for (int op = 0; op < 3; op++)
+        {
+            std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                      << (" " + std::string(names[op]) + " " + lists[list] + " x5 ")
+                      << "] --------------------]\t\t\033[0m";
+            long res(0), r_res(0);
+            time_t diff = timeOps(a, b, op, res);
+            time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+            time_t r_diff = timeOps(ra, rb, op, r_res, limit);
+            EQUAL(res == r_res);
+            std::cout << "\t\t(set " << diff << "ms, roaring_set " << r_diff << "ms)" << std::endl;
+        }
+        std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                  << (" intersection size " + std::string(lists[list]) + " x100 ")
+                  << "] --------------------]\t\t\033[0m";
+        time_t start = get_time();
+        size_t count(0);
+        for (int rep = 0; rep < 100; rep++)
+            count += ft::set_intersection_size(ra, rb);
+        time_t r_diff = get_time() - start;
+        tset in;
+        ft::set_intersection(a, b, in);
+        EQUAL(count == 100 * in.size());
+        std::cout << "\t\t(roaring_set " << r_diff << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing roaring_set;" << RESET << std::endl;
+    TEST_CASE(testRoaringSet);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,261 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segmented_vector_tests.cpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../segmented_vector.hpp"
+#include "../stack.hpp"
+#include "../vector.hpp"
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <ctime>
+#include <chrono>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 3 // the stack over ft::segmented_vector can be slower up to the default ft::stack * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::segmented_vector<std::string> svector;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+bool sameContent(const svector &v, const std::vector<std::string> &model)
+{
+    if (v.size() != model.size() || (!model.empty() && (v.front() != model.front() || v.back() != model.back())))
+        return false;
+    for (size_t i = 0; i < model.size(); i++)
+        if (v[i] != model[i] || v.at(i) != model[i])
+            return false;
+    return true;
+}
+
+void testSegmentedVector()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push_back / pop_back / resize "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(48);
+        std::vector<std::string> model;
+        svector v;
+
+        // Chunks of std::string hold a little over a hundred elements, so the
+        // sizes below cross many chunk boundaries in both directions.
+        for (size_t i = 0; i < 2e4 && cond; i++)
+        {
+            std::string s = std::to_string(i);
+            switch (generator() % 8)
+            {
+            case 0:
+            case 1:
+            case 2:
+                model.push_back(s);
+                v.push_back(s);
+                break;
+            case 3:
+            case 4:
+                if (!model.empty())
+                {
+                    model.pop_back();
+                    v.pop_back();
+                }
+                break;
+            case 5:
+            {
+                size_t n = generator() % 1000;
+                model.resize(n, s);
+                v.resize(n, s);
+                break;
+            }
+            case 6:
+                if (!model.empty())
+                {
+                    size_t pos = generator() % model.size();
+                    model[pos] = s;
+                    v[pos] = s;
+                }
+                break;
+            default:
+                if (generator() % 50 == 0)
+                    v.shrink_to_fit();
+            }
+            if (i % 10 == 0)
+                cond = sameContent(v, model);
+        }
+        cond = cond && sameContent(v, model) && std::equal(model.begin(), model.end(), v.begin())
+               && std::equal(model.rbegin(), model.rend(), v.rbegin())
+               && v.end() - v.begin() == (long)model.size() && v.capacity() >= v.size();
+        svector copy(v), other(5, "x");
+        copy.swap(other);
+        cond = cond && other == v && copy == svector(5, "x") && (v.empty() || copy != v);
+        other = copy;
+        cond = cond && other == copy && !(other < copy) && other <= copy && other >= copy;
+        svector range(model.begin(), model.end());
+        cond = cond && range == v;
+        range.clear();
+        cond = cond && range.empty() && range.begin() == range.end() && range.capacity() > 0;
+        range.shrink_to_fit();
+        cond = cond && range.capacity() == 0;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " range insert "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(49);
+        std::vector<std::string> model, batch;
+        svector v;
+
+        for (size_t round = 0; round < 300 && cond; round++)
+        {
+            batch.clear();
+            for (size_t i = generator() % 300; i; i--)
+                batch.push_back(std::to_string(round * 1000 + i));
+            size_t pos = (round % 2) ? model.size() : generator() % (model.size() + 1);
+            model.insert(model.begin() + pos, batch.begin(), batch.end());
+            v.insert(v.begin() + pos, batch.begin(), batch.end());
+            cond = sameContent(v, model);
+        }
+        v.insert(v.end(), v.begin(), v.begin() + 10); // a range of its own
+        model.insert(model.end(), model.begin(), model.begin() + 10);
+        EQUAL(cond && sameContent(v, model));
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " references survive growth "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        ft::segmented_vector<int> v;
+        std::vector<int *> addresses;
+        for (int i = 0; i < 1e5; i++)
+        {
+            v.push_back(i);
+            addresses.push_back(&v.back());
+        }
+        for (int i = 0; i < 1e5 && cond; i++)
+            cond = addresses[i] == &v[i] && *addresses[i] == i;
+        size_t capacity = v.capacity();
+        v.resize(10);
+        v.resize(1e5, 7);
+        cond = cond && v.capacity() == capacity && addresses[99999] == &v[99999] && v[99999] == 7;
+        try { v.at(1e5); cond = false; } catch (const std::out_of_range &) { }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " stack over segmented_vector "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::stack<std::string, svector> s, t;
+        ft::stack<std::string> model;
+        for (int i = 0; i < 5000; i++)
+        {
+            s.push(std::to_string(i));
+            model.push(std::to_string(i));
+        }
+        t = s;
+        bool cond = s == t && !(s < t) && s.size() == model.size();
+        while (cond && !model.empty())
+        {
+            cond = s.top() == model.top();
+            s.pop();
+            model.pop();
+        }
+        t.swap(s);
+        EQUAL(cond && s.size() == 5000 && t.empty() && s != t);
+    }
+}
+
+// Times every push on its own and keeps the slowest one: a vector-backed
+// stack pays for each doubling at a single push, copying every element.
+template <typename Stack>
+time_t timePushes(long &sum, long &worst, time_t limit = 0)
+{
+    time_t start, end;
+    Stack s;
+
+    worst = 0;
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    for (int i = 0; i < 1e7; i++)
+    {
+        std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+        s.push(i);
+        long took = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - before).count();
+        if (took > worst)
+            worst = took;
+    }
+    while (!s.empty())
+    {
+        sum += s.top();
+        s.pop();
+    }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 1e7 pushes, worst single push "
+              << "] --------------------]\t\t\033[0m";
+    long sum(0), segmented_sum(0), worst(0), segmented_worst(0);
+    time_t diff = timePushes<ft::stack<int> >(sum, worst);
+    time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+    time_t segmented_diff = timePushes<ft::stack<int, ft::segmented_vector<int> > >(segmented_sum, segmented_worst, limit);
+    EQUAL(sum == segmented_sum && segmented_worst < worst);
+    std::cout << "\t\t(ft::stack " << diff << "ms, worst push " << worst << "us; segmented_vector "
+              << segmented_diff << "ms, worst push " << segmented_worst << "us)" << std::endl;
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing segmented_vector;" << RESET << std::endl;
+    TEST_CASE(testSegmentedVector);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,308 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   seqlock_map_tests.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../seqlock_map.hpp"
+#include "../map.hpp"
+#include "../utilities/rw_lock.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <cstdlib>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::seqlock_map readers can be slower up to the rw_lock readers * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::seqlock_map<int, std::string> smap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+void testSeqlockMap()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / assign / erase / bounds "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(39);
+        std::uniform_int_distribution<int> distr(0, 5e3);
+        std::map<int, std::string> m;
+        smap sm;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = m.erase(k) == sm.erase(k);
+            else if (i % 3 == 1)
+            {
+                cond = sm.assign(k, std::to_string(i)) == (m.count(k) == 0);
+                m[k] = std::to_string(i);
+            }
+            else
+                cond = m.insert(std::make_pair(k, std::to_string(k))).second == sm.insert(ft::make_pair(k, std::to_string(k)));
+        }
+        for (int k = -1; k < 5e3 + 2 && cond; k += 3)
+        {
+            std::map<int, std::string>::iterator lb = m.lower_bound(k), ub = m.upper_bound(k);
+            ft::pair<int, std::string> sm_lb, sm_ub;
+            std::string value;
+            cond = sm.lower_bound(k, sm_lb) == (lb != m.end()) && (lb == m.end() || (lb->first == sm_lb.first && lb->second == sm_lb.second));
+            cond = cond && sm.upper_bound(k, sm_ub) == (ub != m.end()) && (ub == m.end() || ub->first == sm_ub.first);
+            cond = cond && sm.find(k, value) == (m.count(k) == 1) && (m.count(k) == 0 || value == m[k]) && sm.count(k) == m.count(k);
+        }
+        cond = cond && sm.size() == m.size();
+        sm.clear();
+        EQUAL(cond && sm.empty() && sm.count(m.begin()->first) == 0);
+    }
+}
+
+struct Reader
+{
+    smap *sm;
+    int id;
+    int reads;
+    long wrong;
+};
+
+void *checkingReader(void *arg)
+{
+    Reader *r = static_cast<Reader *>(arg);
+    std::mt19937 generator(r->id);
+    std::uniform_int_distribution<int> distr(0, 4e3 - 1);
+
+    for (int i = 0; i < r->reads; i++)
+    {
+        int k = distr(generator);
+        std::string value;
+        ft::pair<int, std::string> element;
+        bool found = r->sm->find(k, value);
+        if ((k % 2 == 0 && !found) || (found && atoi(value.c_str()) != k))
+            r->wrong++;
+        if (r->sm->lower_bound(k, element) && (element.first < k || atoi(element.second.c_str()) != element.first))
+            r->wrong++;
+    }
+    return NULL;
+}
+
+void testReadersDuringWrites()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " readers during writes "
+              << "] --------------------]\t\t\033[0m";
+    {
+        smap sm;
+        std::map<int, std::string> m;
+        pthread_t threads[4];
+        Reader readers[4];
+        std::mt19937 generator(40);
+        std::uniform_int_distribution<int> distr(0, 4e3 - 1);
+        bool cond(true);
+
+        for (int k = 0; k < 4e3; k += 2)
+        {
+            sm.insert(ft::make_pair(k, std::to_string(k)));
+            m[k] = std::to_string(k);
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            Reader r = {&sm, i, 50000, 0};
+            readers[i] = r;
+            pthread_create(&threads[i], NULL, checkingReader, &readers[i]);
+        }
+        for (int i = 0; i < 2e5; i++) // Even keys stay, odd keys come and go; a value starts with its key.
+        {
+            int k = distr(generator);
+            std::string value = std::to_string(k) + " written at " + std::to_string(i);
+            if (k % 2 == 0 || i % 3)
+            {
+                sm.assign(k, value);
+                m[k] = value;
+            }
+            else
+                cond = cond && sm.erase(k) == m.erase(k);
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            pthread_join(threads[i], NULL);
+            cond = cond && readers[i].wrong == 0;
+        }
+        for (std::map<int, std::string>::iterator it = m.begin(); it != m.end() && cond; ++it)
+        {
+            std::string value;
+            cond = sm.find(it->first, value) && value == it->second;
+        }
+        EQUAL(cond && sm.size() == m.size());
+    }
+}
+
+struct LockedMap
+{
+    ft::rw_lock lock;
+    ft::map<int, std::string> map;
+};
+
+struct Bench
+{
+    LockedMap *lm;
+    smap *sm;
+    int id;
+    int reads;
+    long found;
+    int *done;
+};
+
+void *lockedReader(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->reads; i++)
+    {
+        int k = distr(generator);
+        ft::read_guard guard(b->lm->lock);
+        b->found += b->lm->map.count(k);
+    }
+    __atomic_fetch_add(b->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+void *seqlockReader(void *arg)
+{
+    Bench *b = static_cast<Bench *>(arg);
+    std::mt19937 generator(b->id);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+
+    for (int i = 0; i < b->reads; i++)
+        b->found += b->sm->count(distr(generator));
+    __atomic_fetch_add(b->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+// One writer keeps updating, at the same pace for both maps, until the readers are done.
+time_t runBench(void *(*fn)(void *), LockedMap *lm, smap *sm, int nthreads, long &writes)
+{
+    std::vector<pthread_t> threads(nthreads);
+    std::vector<Bench> benches(nthreads);
+    std::mt19937 generator(41);
+    std::uniform_int_distribution<int> distr(0, 1e5);
+    time_t start = get_time();
+    int done(0);
+
+    for (int i = 0; i < nthreads; i++)
+    {
+        Bench b = {lm, sm, i, 640000 / nthreads, 0, &done};
+        benches[i] = b;
+        pthread_create(&threads[i], NULL, fn, &benches[i]);
+    }
+    while (__atomic_load_n(&done, __ATOMIC_ACQUIRE) < nthreads)
+    {
+        int k = distr(generator);
+        if (lm)
+        {
+            ft::write_guard guard(lm->lock);
+            lm->map[k] = "value";
+        }
+        else
+            sm->assign(k, "value");
+        writes++;
+        usleep(50);
+    }
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    return (get_time() - start);
+}
+
+void testReadScaling()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 1 writer: rw_lock map vs seqlock "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t locked_diff(0), seqlock_diff(0), diff;
+        std::vector<time_t> locked_times, seqlock_times;
+        long writes(0);
+
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            LockedMap lm;
+            for (int k = 0; k < 1e5; k += 2)
+                lm.map[k] = "value";
+            locked_times.push_back(runBench(lockedReader, &lm, NULL, nthreads, writes));
+            locked_diff += locked_times.back();
+        }
+        diff = (locked_diff) ? (locked_diff * TIME_FAC) : TIME_FAC;
+
+        ualarm(diff * 1e3, 0);
+        for (int nthreads = 1; nthreads <= 64; nthreads *= 2)
+        {
+            smap sm;
+            for (int k = 0; k < 1e5; k += 2)
+                sm.assign(k, "value");
+            seqlock_times.push_back(runBench(seqlockReader, NULL, &sm, nthreads, writes));
+            seqlock_diff += seqlock_times.back();
+        }
+        ualarm(0, 0);
+        EQUAL(writes > 0);
+        for (size_t i = 0; i < locked_times.size(); i++)
+            std::cout << "\t\t(" << std::setw(2) << std::right << (1 << i) << " readers: rw_lock map " << locked_times[i]
+                      << "ms, seqlock " << seqlock_times[i] << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing seqlock_map;" << RESET << std::endl;
+    TEST_CASE(testSeqlockMap);
+    TEST_CASE(testReadersDuringWrites);
+    TEST_CASE(testReadScaling);
+    std::cout << std::endl;
+    return 0;
+}
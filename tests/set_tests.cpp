@@ -11,13 +11,16 @@
 /* ************************************************************************** */
 
 #include "../set.hpp"
+#include "../set_algebra.hpp"
 #include "../vector.hpp"
 #include "../utilities/pair.hpp"
 #include <set>
 
 #include <vector>
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <stdexcept>
 #include <utility>
 #include <ctime>
 #include <iomanip>
@@ -2117,6 +2120,350 @@ void testRetionalOperators()
     EQUAL(((foo <= bar) == (ft_foo <= ft_bar)) && (res == ft_res));
 }
 
+void testOrderStatistics()
+{
+    typedef ft::set<int, std::less<int>, std::allocator<int>, ft::subtree_size> os_set;
+
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " rank / select / count_range "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(11);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        std::set<int> st;
+        os_set ft_st;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 4)
+            {
+                st.insert(k);
+                ft_st.insert(k);
+            }
+            else
+            {
+                st.erase(k);
+                ft_st.erase(k);
+            }
+            if (i % 1000 == 0)
+            {
+                int lo = distr(generator), hi = distr(generator);
+                size_t rank = std::distance(st.begin(), st.lower_bound(lo));
+                size_t range = (lo < hi) ? std::distance(st.lower_bound(lo), st.lower_bound(hi)) : 0;
+                std::set<int>::iterator it = st.begin();
+                std::advance(it, rank);
+                cond = ft_st.rank(lo) == rank && ft_st.count_range(lo, hi) == range;
+                cond = cond && ((it == st.end()) ? ft_st.select(rank) == ft_st.end() : *ft_st.select(rank) == *it);
+                cond = cond && ft::distance(ft_st.begin(), ft_st.end()) == (long)st.size();
+            }
+        }
+        EQUAL(cond && st.size() == ft_st.size() && std::equal(st.begin(), st.end(), ft_st.begin()));
+    }
+}
+
+void testSplitJoin()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " split_at / append_ordered "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(19);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 200 && cond; round++)
+        {
+            std::set<int> st, upper;
+            ft::set<int> ft_st, ft_upper;
+            size_t n = distr(generator) % 2000;
+            for (size_t i = 0; i < n; i++)
+            {
+                int k = distr(generator);
+                st.insert(k);
+                ft_st.insert(k);
+            }
+            int k = distr(generator);
+            upper.insert(st.lower_bound(k), st.end());
+            st.erase(st.lower_bound(k), st.end());
+            ft_st.split_at(k, ft_upper);
+            cond = st.size() == ft_st.size() && upper.size() == ft_upper.size();
+            cond = cond && std::equal(st.begin(), st.end(), ft_st.begin()) && std::equal(upper.begin(), upper.end(), ft_upper.begin());
+            try
+            {
+                ft_upper.append_ordered(ft_st);
+                cond = cond && (st.empty() || upper.empty());
+            }
+            catch (std::invalid_argument &)
+            {
+                cond = cond && ft_upper.size() == upper.size() && ft_st.size() == st.size();
+            }
+            if (upper.empty())
+                ft_upper.swap(ft_st);
+            ft_st.append_ordered(ft_upper);
+            st.insert(upper.begin(), upper.end());
+            cond = cond && ft_upper.empty() && st.size() == ft_st.size() && std::equal(st.begin(), st.end(), ft_st.begin());
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " split_at into itself "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::set<int> st;
+        for (int i = 0; i < 10; i++)
+            st.insert(i * 3);
+        bool thrown(false);
+        try { st.split_at(5, st); } catch (const std::invalid_argument &) { thrown = true; }
+        EQUAL(thrown && st.size() == 10 && st.count(27) == 1);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " merge into itself "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::set<int> st;
+        for (int i = 0; i < 10; i++)
+            st.insert(i * 3);
+        st.merge(st);
+        bool cond = st.size() == 10 && *st.begin() == 0 && *(--st.end()) == 27;
+        for (int i = 0; i < 10 && cond; i++)
+            cond = st.count(i * 3) == 1;
+        EQUAL(cond);
+    }
+}
+
+// Counts its live copies, and throws from the copy that exhausts the budget.
+struct ThrowingKey
+{
+    int v;
+    static int live;
+    static int copies_left;
+
+    ThrowingKey(int x) : v(x) { ++live; }
+    ThrowingKey(const ThrowingKey &x) : v(x.v)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("ThrowingKey");
+        ++live;
+    }
+    ~ThrowingKey() { --live; }
+    bool operator<(const ThrowingKey &x) const { return v < x.v; }
+};
+int ThrowingKey::live = 0;
+int ThrowingKey::copies_left = -1;
+
+void testSetAlgebra()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " assign_sorted, copy throws "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        {
+            std::vector<ThrowingKey> src;
+            ft::set<ThrowingKey> st;
+            for (int i = 0; i < 1000; i++)
+                src.push_back(ThrowingKey(i * 2));
+            for (int i = 0; i < 10; i++)
+                st.insert(ThrowingKey(i * 3 + 1));
+            for (int budget = 0; budget < 1000 && cond; budget += 37)
+            {
+                ThrowingKey::copies_left = budget;
+                bool thrown(false);
+                try { st.assign_sorted(src.begin(), src.end()); } catch (const std::runtime_error &) { thrown = true; }
+                ThrowingKey::copies_left = -1;
+                cond = thrown && st.size() == 10 && st.begin()->v == 1 && (--st.end())->v == 28
+                       && ThrowingKey::live == 1010;
+            }
+            st.assign_sorted(src.begin(), src.end());
+            cond = cond && st.size() == 1000 && (--st.end())->v == 1998 && ThrowingKey::live == 2000;
+        }
+        EQUAL(cond && ThrowingKey::live == 0);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " assign_sorted, unsorted input "
+              << "] --------------------]\t\t\033[0m";
+    {
+        int thrown(0);
+        int unsorted[] = {1, 2, 5, 4};
+        int repeated[] = {1, 2, 2, 3};
+        ft::set<int> st;
+        ft::map<int, int> mp;
+        st.insert(7);
+        mp[7] = 7;
+        try { st.assign_sorted(unsorted, unsorted + 4); } catch (const std::invalid_argument &) { thrown++; }
+        try { st.assign_sorted(repeated, repeated + 4); } catch (const std::invalid_argument &) { thrown++; }
+        std::vector<ft::pair<int, int> > pairs;
+        for (int i = 0; i < 4; i++)
+            pairs.push_back(ft::make_pair(unsorted[i], i));
+        try { mp.assign_sorted(pairs.begin(), pairs.end()); } catch (const std::invalid_argument &) { thrown++; }
+        bool cond = thrown == 3 && st.size() == 1 && *st.begin() == 7 && mp.size() == 1 && mp[7] == 7;
+        st.assign_sorted(unsorted, unsorted + 3);
+        mp.assign_sorted(pairs.begin(), pairs.begin() + 3);
+        EQUAL(cond && st.size() == 3 && *(--st.end()) == 5 && mp.size() == 3 && mp[5] == 2);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " union / intersection / difference "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(23);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 100 && cond; round++)
+        {
+            std::set<int> a, b, expected;
+            ft::set<int> ft_a, ft_b, ft_result;
+            size_t na = distr(generator) % ((round % 3) ? 3000 : 30), nb = distr(generator) % 3000;
+            for (size_t i = 0; i < na; i++)
+            {
+                int k = distr(generator);
+                a.insert(k);
+                ft_a.insert(k);
+            }
+            for (size_t i = 0; i < nb; i++)
+            {
+                int k = distr(generator);
+                b.insert(k);
+                ft_b.insert(k);
+            }
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+            ft::set_union(ft_a, ft_b, ft_result);
+            cond = expected.size() == ft_result.size() && std::equal(expected.begin(), expected.end(), ft_result.begin());
+            expected.clear();
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+            ft::set_intersection(ft_b, ft_a, ft_result);
+            cond = cond && expected.size() == ft_result.size() && std::equal(expected.begin(), expected.end(), ft_result.begin());
+            cond = cond && ft::includes(ft_a, ft_result) && ft::includes(ft_b, ft_result);
+            cond = cond && ft::includes(ft_a, ft_b) == std::includes(a.begin(), a.end(), b.begin(), b.end());
+            expected.clear();
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+            ft::set_difference(ft_a, ft_b, ft_a);
+            cond = cond && expected.size() == ft_a.size() && std::equal(expected.begin(), expected.end(), ft_a.begin());
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " merge "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(29);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 100 && cond; round++)
+        {
+            std::set<int> a, b;
+            ft::set<int> ft_a, ft_b;
+            size_t na = distr(generator) % 3000, nb = distr(generator) % ((round % 2) ? 3000 : 10);
+            for (size_t i = 0; i < na; i++)
+            {
+                int k = distr(generator);
+                a.insert(k);
+                ft_a.insert(k);
+            }
+            for (size_t i = 0; i < nb; i++)
+            {
+                int k = distr(generator);
+                b.insert(k);
+                ft_b.insert(k);
+            }
+            std::set<int> kept;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(kept, kept.end()));
+            a.insert(b.begin(), b.end());
+            ft_a.merge(ft_b);
+            cond = a.size() == ft_a.size() && std::equal(a.begin(), a.end(), ft_a.begin());
+            cond = cond && kept.size() == ft_b.size() && std::equal(kept.begin(), kept.end(), ft_b.begin());
+        }
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " intersection vs find loop "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::set<int> a, b, result, ft_result;
+
+        for (int i = 0; i < 1e6; i++)
+        {
+            a.insert(i * 2);
+            b.insert(i * 3);
+        }
+        start = get_time();
+        for (ft::set<int>::iterator it = a.begin(); it != a.end(); ++it)
+            if (b.find(*it) != b.end())
+                result.insert(*it);
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        ft::set_intersection(a, b, ft_result);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(result.size() == ft_result.size() && std::equal(result.begin(), result.end(), ft_result.begin()));
+        std::cout << "\t\t(find loop " << ft_diff << "ms, set_intersection " << end - start << "ms)" << std::endl;
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " 1:10 intersection vs linear walk "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        std::mt19937 generator(30);
+        ft::set<int> a, b, ft_result;
+        std::vector<int> result;
+
+        for (int i = 0; i < 1e6; i++)
+            b.insert(generator() % 100000000);
+        for (int i = 0; i < 1e5; i++)
+            a.insert(generator() % 100000000);
+        start = get_time();
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+        end = get_time();
+        diff = end - start;
+        time_t ft_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        ft::set_intersection(a, b, ft_result);
+        bool cond = ft::includes(b, ft_result) && !ft::includes(ft_result, a);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(cond && result.size() == ft_result.size() && std::equal(result.begin(), result.end(), ft_result.begin()));
+        std::cout << "\t\t(linear walk " << ft_diff << "ms, set_intersection " << end - start << "ms)" << std::endl;
+    }
+}
+
+void testFreeze()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " freeze "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(35);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+
+        for (size_t round = 0; round < 100 && cond; round++)
+        {
+            std::set<int> st;
+            ft::set<int> ft_st;
+            size_t n = distr(generator) % 1000;
+            for (size_t i = 0; i < n; i++)
+            {
+                int k = distr(generator);
+                st.insert(k);
+                ft_st.insert(k);
+            }
+            ft::frozen_set<int> frozen = ft_st.freeze();
+            cond = frozen.size() == st.size() && std::equal(st.begin(), st.end(), frozen.begin()) && std::equal(st.rbegin(), st.rend(), frozen.rbegin());
+            for (size_t q = 0; q < 200 && cond; q++)
+            {
+                int k = distr(generator);
+                std::set<int>::iterator lb = st.lower_bound(k), ub = st.upper_bound(k);
+                ft::frozen_set<int>::const_iterator ft_lb = frozen.lower_bound(k), ft_ub = frozen.upper_bound(k);
+                cond = (lb == st.end()) == (ft_lb == frozen.end()) && (lb == st.end() || *lb == *ft_lb);
+                cond = cond && (ub == st.end()) == (ft_ub == frozen.end()) && (ub == st.end() || *ub == *ft_ub);
+                cond = cond && st.count(k) == frozen.count(k);
+            }
+        }
+        EQUAL(cond);
+    }
+}
+
 void alarm_handler(int seg)
 {
     (void)seg;
@@ -2173,5 +2520,12 @@ int main()
     std::cout << YELLOW << "Testing Non-Member Swap  ; " << RESET << std::endl;
     TEST_CASE(testNonMemberSwap);
     std::cout << std::endl;
+
+    std::cout << YELLOW << "Testing Order Statistics; " << RESET << std::endl;
+    TEST_CASE(testOrderStatistics);
+    TEST_CASE(testSplitJoin);
+    TEST_CASE(testSetAlgebra);
+    TEST_CASE(testFreeze);
+    std::cout << std::endl;
     return 0;
 }
@@ -12,9 +12,15 @@
 
 #include "../stack.hpp"
 #include "../vector.hpp"
+#include "../static_vector.hpp"
+#include "../segmented_vector.hpp"
 #include "../utilities/pair.hpp"
 #include <vector>
 #include <stack>
+#include <string>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
 #include <iostream>
 #include <ctime>
 #include <iomanip>
@@ -320,6 +326,191 @@ void	testRelationalOperators(void)
 	}
 }
 
+struct ThrowingItem
+{
+	int v;
+	static int live;
+	static int copies_left;
+
+	ThrowingItem(int x = 0) : v(x) { ++live; }
+	ThrowingItem(const ThrowingItem &x) : v(x.v)
+	{
+		if (copies_left-- == 0)
+			throw std::runtime_error("ThrowingItem");
+		++live;
+	}
+	~ThrowingItem() { --live; }
+};
+int ThrowingItem::live = 0;
+int ThrowingItem::copies_left = -1;
+
+// An allocator that claims it can hold 100 elements at most.
+template <class T>
+struct SmallAllocator : public std::allocator<T>
+{
+	template <class U>
+	struct rebind { typedef SmallAllocator<U> other; };
+	size_t max_size() const { return 100; }
+};
+
+void	testBatchMethods(void)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push_range & pop_n methods "
+              << "] --------------------]\t\t\033[0m";
+	{
+		bool cond(true);
+		std::vector<int> vec;
+		for (int i = 0; i < 1000; i++) vec.push_back(i);
+		ft::stack<int> mystack;
+		std::stack<int> stack;
+
+		mystack.push(-1);
+		stack.push(-1);
+		mystack.push_range(vec.begin(), vec.end());
+		for (size_t i = 0; i < vec.size(); i++) stack.push(vec[i]);
+		cond = mystack.size() == stack.size() && mystack.top() == 999;
+
+		std::vector<int> out;
+		mystack.pop_n(600, std::back_inserter(out));
+		cond = cond && out.size() == 600;
+		for (size_t i = 0; i < 600 && cond; i++)
+		{
+			cond = out[i] == stack.top();
+			stack.pop();
+		}
+		int arr[401];
+		int *last = mystack.pop_n(401, arr);
+		cond = cond && last == arr + 401 && arr[0] == 399 && arr[400] == -1 && mystack.empty();
+
+		ft::stack<int, std::vector<int> > std_container;
+		std_container.push_range(vec.begin(), vec.begin() + 10);
+		cond = cond && std_container.size() == 10 && std_container.top() == 9;
+		EQUAL(cond);
+	}
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push_range, copy throws / too long "
+              << "] --------------------]\t\t\033[0m";
+	{
+		bool cond(true);
+		{
+			std::vector<ThrowingItem> vec;
+			for (int i = 0; i < 10; i++) vec.push_back(ThrowingItem(i));
+			for (int budget = 0; budget < 15 && cond; budget++)
+			{
+				ft::stack<ThrowingItem> mystack;
+				for (int i = 0; i < 5; i++) mystack.push(ThrowingItem(-i));
+				ThrowingItem::copies_left = budget;
+				bool thrown(false);
+				try { mystack.push_range(vec.begin(), vec.end()); } catch (const std::runtime_error &) { thrown = true; }
+				ThrowingItem::copies_left = -1;
+				cond = thrown && mystack.size() == 5 && mystack.top().v == -4
+					   && ThrowingItem::live == int(mystack.size() + vec.size());
+			}
+		}
+		cond = cond && ThrowingItem::live == 0;
+
+		int arr[101] = {0};
+		ft::vector<int, SmallAllocator<int> > small;
+		small.insert(small.end(), arr, arr + 60);
+		try { small.insert(small.end(), arr, arr + 41); cond = false; } catch (const std::length_error &) { }
+		small.insert(small.end(), arr, arr + 40);
+		cond = cond && small.size() == 100 && small.capacity() == 100;
+		EQUAL(cond);
+	}
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " emplace & pop_value methods "
+              << "] --------------------]\t\t\033[0m";
+	{
+		ft::stack<std::string> mystack;
+		std::string token("a long token, longer than the small string buffer");
+		mystack.emplace(3, 'a');
+		mystack.emplace(token);
+		mystack.push(mystack.top()); // a reference into the stack, across a reallocation
+		std::string top = mystack.pop_value();
+		bool cond = top == token && mystack.top() == token && mystack.size() == 2;
+		mystack.push(std::string("moved"));
+		cond = cond && mystack.pop_value() == "moved" && mystack.pop_value() == token
+			   && mystack.pop_value() == "aaa" && mystack.empty();
+		EQUAL(cond);
+	}
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " batch methods on other containers "
+              << "] --------------------]\t\t\033[0m";
+	{
+		std::vector<std::string> tokens;
+		for (int i = 0; i < 1000; i++) tokens.push_back(std::to_string(i));
+
+		ft::stack<std::string, ft::static_vector<std::string, 16> > fixed;
+		fixed.push_range(tokens.begin(), tokens.begin() + 10);
+		fixed.emplace(3, 'a');
+		fixed.emplace(fixed.top()); // a reference into the stack
+		bool cond = fixed.size() == 12 && fixed.pop_value() == "aaa" && fixed.pop_value() == "aaa"
+					&& fixed.top() == "9";
+
+		ft::stack<std::string, ft::segmented_vector<std::string> > deep;
+		deep.emplace(2, 'b');
+		deep.push_range(tokens.begin(), tokens.end()); // across many chunks
+		deep.emplace(deep.top());
+		cond = cond && deep.size() == 1002 && deep.pop_value() == "999" && deep.top() == "999";
+		std::vector<std::string> out;
+		deep.pop_n(1000, std::back_inserter(out));
+		cond = cond && out.back() == "0" && deep.pop_value() == "bb" && deep.empty();
+		EQUAL(cond);
+	}
+}
+
+// The tokens of a source file, the way the tokenizer stacks them: all of a
+// line's tokens pushed, then handed back to the parser from the top.
+template <bool Batch>
+time_t timeTokens(const std::vector<std::string> &tokens, size_t &total, time_t limit = 0)
+{
+	time_t start, end;
+	ft::stack<std::string> mystack;
+	std::vector<std::string> parsed;
+
+	start = get_time();
+	if (limit)
+		ualarm(limit * 1e3, 0);
+	for (int round = 0; round < 20; round++)
+	{
+		for (size_t line = 0; line + 64 <= tokens.size(); line += 64)
+		{
+			if (Batch)
+			{
+				mystack.push_range(tokens.begin() + line, tokens.begin() + line + 64);
+				mystack.pop_n(64, std::back_inserter(parsed));
+			}
+			else
+			{
+				for (size_t i = line; i < line + 64; i++)
+					mystack.push(tokens[i]);
+				while (!mystack.empty())
+				{
+					parsed.push_back(mystack.top());
+					mystack.pop();
+				}
+			}
+			total += parsed.size();
+			parsed.clear();
+		}
+	}
+	if (limit)
+		ualarm(0, 0);
+	end = get_time();
+	return (end - start);
+}
+
+void	testBenchmark(void)
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " tokens: batch vs per element "
+              << "] --------------------]\t\t\033[0m";
+	std::vector<std::string> tokens;
+	for (int i = 0; i < 1 << 16; i++)
+		tokens.push_back((i % 3) ? std::string("identifier_number_") + char('a' + i % 26) + char('a' + i % 7) : std::string("+"));
+	size_t total(0), batch_total(0);
+	time_t diff = timeTokens<false>(tokens, total);
+	time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+	time_t batch_diff = timeTokens<true>(tokens, batch_total, limit);
+	EQUAL(total == batch_total);
+	std::cout << "\t\t(per element " << diff << "ms, batch " << batch_diff << "ms)" << std::endl;
+}
 
 void alarm_handler(int seg)
 {
@@ -344,5 +535,9 @@ int main()
     std::cout << YELLOW << "Testing relational operators;" << RESET << std::endl;
     TEST_CASE(testRelationalOperators);
 
+    std::cout << YELLOW << "Testing batch methods;" << RESET << std::endl;
+    TEST_CASE(testBatchMethods);
+    TEST_CASE(testBenchmark);
+
 	return 0;
 }
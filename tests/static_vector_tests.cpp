@@ -0,0 +1,300 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_vector_tests.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../static_vector.hpp"
+#include "../stack.hpp"
+#include "../vector.hpp"
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 3 // the stack over ft::static_vector can be slower up to the default ft::stack * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::static_vector<std::string, 64> svector;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+bool sameContent(const svector &v, const std::vector<std::string> &model)
+{
+    if (v.size() != model.size())
+        return false;
+    for (size_t i = 0; i < model.size(); i++)
+        if (v[i] != model[i] || v.at(i) != model[i])
+            return false;
+    return true;
+}
+
+struct ThrowingItem
+{
+    int v;
+    static int live;
+    static int copies_left;
+
+    ThrowingItem(int x = 0) : v(x) { ++live; }
+    ThrowingItem(const ThrowingItem &x) : v(x.v)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("ThrowingItem");
+        ++live;
+    }
+    ThrowingItem &operator=(const ThrowingItem &x)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("ThrowingItem");
+        v = x.v;
+        return *this;
+    }
+    ~ThrowingItem() { --live; }
+};
+int ThrowingItem::live = 0;
+int ThrowingItem::copies_left = -1;
+
+struct __attribute__((aligned(64))) WideItem
+{
+    char c;
+};
+
+void testStaticVector()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push_back / insert / erase / resize "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(47);
+        std::vector<std::string> model;
+        svector v;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            std::string s = std::to_string(i);
+            size_t pos = model.empty() ? 0 : generator() % model.size();
+            switch (generator() % 6)
+            {
+            case 0:
+                if (model.size() < 64)
+                {
+                    model.push_back(s);
+                    v.push_back(s);
+                }
+                break;
+            case 1:
+                if (!model.empty())
+                {
+                    model.pop_back();
+                    v.pop_back();
+                }
+                break;
+            case 2:
+                if (model.size() + 3 <= 64)
+                {
+                    model.insert(model.begin() + pos, 3, s);
+                    v.insert(v.begin() + pos, 3, s);
+                }
+                break;
+            case 3:
+                if (!model.empty())
+                {
+                    model.erase(model.begin() + pos, model.begin() + std::min(pos + 2, model.size()));
+                    v.erase(v.begin() + pos, v.begin() + std::min(pos + 2, v.size()));
+                }
+                break;
+            case 4:
+                if (model.size() + 2 <= 64)
+                {
+                    std::vector<std::string> two(2, s);
+                    model.insert(model.begin() + pos, two.begin(), two.end());
+                    v.insert(v.begin() + pos, two.begin(), two.end());
+                }
+                break;
+            default:
+                model.resize(pos, s);
+                v.resize(pos, s);
+            }
+            cond = sameContent(v, model);
+        }
+        svector copy(v), other(5, "x");
+        copy.swap(other);
+        cond = cond && other == v && copy == svector(5, "x") && (v.empty() || copy != v);
+        other = copy;
+        cond = cond && other == copy && !(other < copy) && other <= copy && other >= copy;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " overflow checks "
+              << "] --------------------]\t\t\033[0m";
+    {
+        int thrown(0);
+        ft::stack<int, ft::static_vector<int, 4> > s;
+        for (int i = 0; i < 4; i++)
+            s.push(i);
+        try { s.push(4); } catch (const std::length_error &) { thrown++; }
+        ft::static_vector<int, 4> v(4, 0);
+        try { v.insert(v.begin(), 1); } catch (const std::length_error &) { thrown++; }
+        try { v.resize(5); } catch (const std::length_error &) { thrown++; }
+        try { v.at(4); } catch (const std::out_of_range &) { thrown++; }
+        try { ft::static_vector<int, 4> big(5, 1); } catch (const std::length_error &) { thrown++; }
+        EQUAL(thrown == 5 && s.size() == 4 && s.top() == 3 && v.size() == 4 && v.capacity() == 4 && v.full());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert, copy throws "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        {
+            ft::static_vector<ThrowingItem, 16> two(2, ThrowingItem(-1));
+            for (int pos = 0; pos <= 8 && cond; pos++)
+                for (int budget = 0; budget < 12 && cond; budget++)
+                    for (int range = 0; range < 2 && cond; range++)
+                    {
+                        ft::static_vector<ThrowingItem, 16> v;
+                        for (int i = 0; i < 8; i++)
+                            v.push_back(ThrowingItem(i));
+                        ThrowingItem::copies_left = budget;
+                        bool thrown(false);
+                        try
+                        {
+                            if (range)
+                                v.insert(v.begin() + pos, two.begin(), two.end());
+                            else
+                                v.insert(v.begin() + pos, 3, ThrowingItem(-1));
+                        }
+                        catch (const std::runtime_error &) { thrown = true; }
+                        ThrowingItem::copies_left = -1;
+                        cond = ThrowingItem::live == int(v.size() + two.size())
+                               && (thrown || v.size() == (range ? 10u : 11u));
+                    }
+        }
+        EQUAL(cond && ThrowingItem::live == 0);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " over-aligned elements "
+              << "] --------------------]\t\t\033[0m";
+    {
+        char pad(0);
+        ft::static_vector<WideItem, 4> v(3, WideItem());
+        (void)pad;
+        EQUAL(reinterpret_cast<size_t>(&v[0]) % 64 == 0 && reinterpret_cast<size_t>(&v[2]) % 64 == 0);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " stack over static_vector "
+              << "] --------------------]\t\t\033[0m";
+    {
+        ft::stack<std::string, svector> s, t;
+        ft::stack<std::string> model;
+        for (int i = 0; i < 50; i++)
+        {
+            s.push(std::to_string(i));
+            model.push(std::to_string(i));
+        }
+        t = s;
+        bool cond = s == t && !(s < t) && s.size() == model.size();
+        while (cond && !model.empty())
+        {
+            cond = s.top() == model.top();
+            s.pop();
+            model.pop();
+        }
+        t.swap(s);
+        EQUAL(cond && s.size() == 50 && t.empty() && s != t);
+    }
+}
+
+// A depth-first walk: pushes down to a random depth under 256 and pops back,
+// the way a parser uses its stack.
+template <typename Stack>
+time_t timeWalks(long &sum, bool fresh, time_t limit = 0)
+{
+    time_t start, end;
+    std::mt19937 generator(48);
+    Stack reused;
+
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    for (int walk = 0; walk < 2e5; walk++)
+    {
+        Stack local;
+        Stack &s = fresh ? local : reused;
+        int depth = 64 + generator() % 192;
+        for (int i = 0; i < depth; i++)
+            s.push(i);
+        while (!s.empty())
+        {
+            sum += s.top();
+            s.pop();
+        }
+    }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    for (int fresh = 1; fresh >= 0; fresh--)
+    {
+        std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                  << (fresh ? " walks, a new stack each " : " walks, one stack reused ")
+                  << "] --------------------]\t\t\033[0m";
+        long sum(0), static_sum(0);
+        time_t diff = timeWalks<ft::stack<int> >(sum, fresh);
+        time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+        time_t static_diff = timeWalks<ft::stack<int, ft::static_vector<int, 256> > >(static_sum, fresh, limit);
+        EQUAL(sum == static_sum);
+        std::cout << "\t\t(ft::stack " << diff << "ms, static_vector " << static_diff << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing static_vector;" << RESET << std::endl;
+    TEST_CASE(testStaticVector);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
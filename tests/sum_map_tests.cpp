@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sum_map_tests.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../sum_map.hpp"
+#include "../map.hpp"
+#include "../vector.hpp"
+
+#include <vector>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::sum_map queries can be slower up to a linear scan * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::sum_map<int, long> smap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+long scanSum(ft::map<int, long> &m, int lo, int hi)
+{
+    long sum(0);
+    for (ft::map<int, long>::iterator it = m.lower_bound(lo); it != m.end() && it->first < hi; ++it)
+        sum += it->second;
+    return sum;
+}
+
+void testSums()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " total / prefix_sum / range_sum "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(13);
+        std::uniform_int_distribution<int> distr(0, 1e4);
+        ft::map<int, long> m;
+        smap sm;
+
+        for (size_t i = 0; i < 1e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 4 == 0)
+                cond = m.erase(k) == sm.erase(k);
+            else if (i % 4 == 1)
+            {
+                m[k] = i;
+                sm.assign(k, i);
+            }
+            else
+                cond = m.insert(ft::make_pair(k, (long)k)).second == sm.insert(ft::make_pair(k, (long)k)).second;
+            if (i % 500 == 0)
+            {
+                int lo = distr(generator), hi = distr(generator);
+                cond = cond && sm.total() == scanSum(m, 0, 1e4 + 1);
+                cond = cond && sm.prefix_sum(hi) == scanSum(m, 0, hi);
+                cond = cond && sm.range_sum(lo, hi) == scanSum(m, lo, hi);
+            }
+        }
+        cond = cond && m.size() == sm.size() && sm.range_sum(5, 5) == 0 && sm.prefix_sum(-1) == 0;
+        ft::map<int, long>::iterator it = m.begin();
+        for (smap::const_iterator it2 = sm.begin(); cond && it2 != sm.end(); ++it, ++it2)
+            cond = it->first == it2->first && it->second == it2->second && sm.at(it->first) == it->second;
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " copy / swap / bounds "
+              << "] --------------------]\t\t\033[0m";
+    {
+        smap sm, other;
+        for (int i = 0; i < 100; i++)
+            sm.insert(ft::make_pair(i * 2, (long)i));
+        smap copy(sm);
+        copy.assign(0, 1000);
+        bool cond = sm.total() == 4950 && copy.total() == 5950 && copy.prefix_sum(1) == 1000;
+        other.swap(copy);
+        cond = cond && copy.empty() && copy.total() == 0 && other.range_sum(0, 4) == 1001;
+        cond = cond && sm.lower_bound(3)->first == 4 && sm.upper_bound(4)->first == 6 && sm.lower_bound(1000) == sm.end();
+        sm.erase(sm.find(10));                              // 5
+        sm.erase(sm.lower_bound(100), sm.lower_bound(120)); // 50 to 59
+        cond = cond && sm.size() == 89 && sm.total() == 4950 - 5 - 545 && sm.range_sum(8, 22) == 4 + 6 + 7 + 8 + 9 + 10;
+        EQUAL(cond);
+    }
+}
+
+void testSumTime()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " range_sum vs linear scan "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t start, end, diff;
+        ft::map<int, long> m;
+        smap sm;
+        long sum(0), sm_sum(0);
+
+        for (int i = 0; i < 1e5; i++)
+        {
+            m.insert(ft::make_pair(i, (long)i));
+            sm.insert(ft::make_pair(i, (long)i));
+        }
+        start = get_time();
+        for (int i = 0; i < 1e5; i += 500)
+            sum += scanSum(m, i / 2, i);
+        end = get_time();
+        diff = end - start;
+        time_t scan_diff = diff;
+        diff = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+
+        start = get_time();
+        ualarm(diff * 1e3, 0);
+        for (int i = 0; i < 1e5; i += 500)
+            sm_sum += sm.range_sum(i / 2, i);
+        ualarm(0, 0);
+        end = get_time();
+        EQUAL(sum == sm_sum);
+        std::cout << "\t\t(linear scan " << scan_diff << "ms, range_sum " << end - start << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing sum_map;" << RESET << std::endl;
+    TEST_CASE(testSums);
+    TEST_CASE(testSumTime);
+    std::cout << std::endl;
+    return 0;
+}
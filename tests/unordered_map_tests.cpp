@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map_tests.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../unordered_map.hpp"
+#include "../map.hpp"
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::unordered_map methods can be slower up to std::unordered_map methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::unordered_map<int, std::string> umap;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename UMap, typename Map>
+bool sameContent(const UMap &um, const Map &m)
+{
+    if (um.size() != m.size())
+        return false;
+    size_t seen(0);
+    for (typename UMap::const_iterator it = um.begin(); it != um.end(); ++it, ++seen)
+    {
+        typename Map::const_iterator found = m.find(it->first);
+        if (found == m.end() || found->second != it->second)
+            return false;
+    }
+    return seen == m.size();
+}
+
+void testUnorderedMap()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " insert / [] / erase / find "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(41);
+        std::uniform_int_distribution<int> distr(0, 5e3);
+        std::map<int, std::string> m;
+        umap um;
+
+        for (size_t i = 0; i < 3e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = m.erase(k) == um.erase(k);
+            else if (i % 3 == 1)
+            {
+                m[k] = std::to_string(i);
+                um[k] = std::to_string(i);
+            }
+            else
+                cond = m.insert(std::make_pair(k, std::to_string(k))).second == um.insert(ft::make_pair(k, std::to_string(k))).second;
+        }
+        cond = cond && sameContent(um, m);
+        for (int k = -1; k < 5e3 + 2 && cond; k++)
+            cond = um.count(k) == m.count(k) && (um.find(k) == um.end()) == (m.find(k) == m.end());
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " tombstones / erase while iterating "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(42);
+        std::map<long, int> m;
+        ft::unordered_map<long, int> um;
+
+        for (int round = 0; round < 50 && cond; round++) // The same room is filled and emptied again.
+        {
+            for (int i = 0; i < 2e3; i++)
+            {
+                long k = long(generator()) << 16;
+                m[k] = i;
+                um[k] = i;
+            }
+            for (ft::unordered_map<long, int>::iterator it = um.begin(); it != um.end();)
+            {
+                if (it->second >= 100)
+                {
+                    m.erase(it->first);
+                    um.erase(it++);
+                }
+                else
+                    ++it;
+            }
+            cond = sameContent(um, m);
+        }
+        cond = cond && um.bucket_count() < 4 * 8192;
+        um.rehash(0);
+        cond = cond && sameContent(um, m) && um.load_factor() <= um.max_load_factor();
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " reserve / copy / swap / at "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        umap um(1000);
+        size_t buckets = um.bucket_count();
+
+        for (int i = 0; i < 1e3; i++)
+            um[i] = std::to_string(i);
+        cond = buckets >= 1000 && um.bucket_count() == buckets;
+        umap copy(um), other;
+        other = copy;
+        cond = cond && copy == um && other == um;
+        other[-1] = "more";
+        cond = cond && other != um;
+        copy.swap(other);
+        cond = cond && copy.size() == 1001 && other == um && um.at(42) == "42";
+        try
+        {
+            um.at(-1);
+            cond = false;
+        }
+        catch (const std::out_of_range &)
+        {
+        }
+        umap range(um.begin(), um.end());
+        cond = cond && range == um;
+        range.erase(range.begin(), range.end());
+        cond = cond && range.empty() && range.begin() == range.end() && range.find(3) == range.end();
+        um.clear();
+        cond = cond && um.empty() && um.bucket_count() == buckets && um.count(42) == 0;
+        EQUAL(cond);
+    }
+}
+
+template <typename Map, typename Pair>
+time_t timeOps(const std::vector<int> &keys, const std::vector<int> &missing, int op, long &result, time_t limit = 0)
+{
+    Map m;
+    time_t start, end;
+
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Pair(keys[i], int(i)));
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    if (op == 0)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += m.count(keys[i]);
+    else if (op == 1)
+        for (size_t i = 0; i < missing.size(); i++)
+            result += m.count(missing[i]);
+    else if (op == 2)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += m.count(i % 10 ? missing[i] : keys[i]);
+    else
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            result += m.erase(keys[i]);
+            m.insert(Pair(missing[i], int(i)));
+        }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    result += m.size();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"hits", "misses", "90% misses", "erase-heavy"};
+
+    for (size_t n = 1e3; n <= 1e6; n *= 1e3)
+    {
+        std::mt19937 generator(n);
+        std::vector<int> keys(n), missing(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            keys[i] = generator() | 1;
+            missing[i] = generator() & ~1;
+        }
+        int reps = 1e6 / n;
+        for (int op = 0; op < 4; op++)
+        {
+            std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                      << (" " + std::string(names[op]) + " " + std::to_string(n) + " keys ")
+                      << "] --------------------]\t\t\033[0m";
+            time_t diff(0), map_diff(0), u_diff(0);
+            long res(0), map_res(0), u_res(0);
+            for (int r = 0; r < reps; r++)
+                diff += timeOps<std::unordered_map<int, int>, std::pair<const int, int> >(keys, missing, op, res);
+            for (int r = 0; r < reps; r++)
+                map_diff += timeOps<ft::map<int, int>, ft::pair<const int, int> >(keys, missing, op, map_res);
+            time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+            for (int r = 0; r < reps; r++)
+                u_diff += timeOps<ft::unordered_map<int, int>, ft::pair<const int, int> >(keys, missing, op, u_res, (limit > u_diff) ? limit - u_diff : 1);
+            EQUAL(res == u_res && map_res == u_res);
+            std::cout << "\t\t(std::unordered_map " << diff << "ms, map " << map_diff << "ms, unordered_map " << u_diff << "ms)" << std::endl;
+        }
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing unordered_map;" << RESET << std::endl;
+    TEST_CASE(testUnorderedMap);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
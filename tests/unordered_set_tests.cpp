@@ -0,0 +1,198 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set_tests.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../unordered_set.hpp"
+#include "../set.hpp"
+
+#include <set>
+#include <unordered_set>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the ft::unordered_set methods can be slower up to std::unordered_set methods * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+template <typename USet, typename Set>
+bool sameContent(const USet &us, const Set &s)
+{
+    if (us.size() != s.size())
+        return false;
+    size_t seen(0);
+    for (typename USet::const_iterator it = us.begin(); it != us.end(); ++it, ++seen)
+        if (s.find(*it) == s.end())
+            return false;
+    return seen == s.size();
+}
+
+void testUnorderedSet()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " int keys "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(43);
+        std::uniform_int_distribution<int> distr(-1e4, 1e4);
+        std::set<int> s;
+        ft::unordered_set<int> us;
+
+        for (size_t i = 0; i < 2e5 && cond; i++)
+        {
+            int k = distr(generator);
+            if (i % 3 == 0)
+                cond = s.erase(k) == us.erase(k);
+            else
+                cond = s.insert(k).second == us.insert(k).second;
+        }
+        cond = cond && sameContent(us, s);
+        for (int k = -1e4 - 1; k < 1e4 + 2 && cond; k++)
+            cond = us.count(k) == s.count(k);
+        EQUAL(cond);
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " string keys / copy / compare "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(44);
+        std::uniform_int_distribution<int> distr(0, 3e3);
+        std::set<std::string> s;
+        ft::unordered_set<std::string> us;
+
+        for (size_t i = 0; i < 5e4 && cond; i++)
+        {
+            std::string k = std::to_string(distr(generator));
+            if (i % 3 == 0)
+                cond = s.erase(k) == us.erase(k);
+            else
+                cond = s.insert(k).second == us.insert(k).second;
+        }
+        cond = cond && sameContent(us, s);
+        ft::unordered_set<std::string> copy(us), other;
+        other = copy;
+        cond = cond && copy == us && other == us;
+        other.insert("more");
+        cond = cond && other != us;
+        other.swap(copy);
+        cond = cond && other == us && copy.size() == us.size() + 1;
+        ft::unordered_set<std::string> range(s.begin(), s.end());
+        cond = cond && range == us;
+        EQUAL(cond);
+    }
+}
+
+template <typename Set>
+time_t timeOps(const std::vector<int> &keys, const std::vector<int> &missing, int op, long &result, time_t limit = 0)
+{
+    Set s;
+    time_t start, end;
+
+    for (size_t i = 0; i < keys.size(); i++)
+        s.insert(keys[i]);
+    start = get_time();
+    if (limit)
+        ualarm(limit * 1e3, 0);
+    if (op == 0)
+        for (size_t i = 0; i < keys.size(); i++)
+            result += s.count(keys[i]);
+    else if (op == 1)
+        for (size_t i = 0; i < missing.size(); i++)
+            result += s.count(missing[i]);
+    else
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            result += s.erase(keys[i]);
+            s.insert(missing[i]);
+        }
+    if (limit)
+        ualarm(0, 0);
+    end = get_time();
+    result += s.size();
+    return (end - start);
+}
+
+void testBenchmark()
+{
+    const char *names[] = {"hits", "misses", "erase-heavy"};
+    size_t n = 1e6;
+    std::mt19937 generator(n);
+    std::vector<int> keys(n), missing(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        keys[i] = generator() | 1;
+        missing[i] = generator() & ~1;
+    }
+    for (int op = 0; op < 3; op++)
+    {
+        std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left
+                  << (" " + std::string(names[op]) + " " + std::to_string(n) + " keys ")
+                  << "] --------------------]\t\t\033[0m";
+        time_t diff, set_diff, u_diff;
+        long res(0), set_res(0), u_res(0);
+        diff = timeOps<std::unordered_set<int> >(keys, missing, op, res);
+        set_diff = timeOps<ft::set<int> >(keys, missing, op, set_res);
+        time_t limit = (diff) ? (diff * TIME_FAC) : TIME_FAC;
+        u_diff = timeOps<ft::unordered_set<int> >(keys, missing, op, u_res, limit);
+        EQUAL(res == u_res && set_res == u_res);
+        std::cout << "\t\t(std::unordered_set " << diff << "ms, set " << set_diff << "ms, unordered_set " << u_diff << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing unordered_set;" << RESET << std::endl;
+    TEST_CASE(testUnorderedSet);
+    TEST_CASE(testBenchmark);
+    std::cout << std::endl;
+    return 0;
+}
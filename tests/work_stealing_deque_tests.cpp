@@ -0,0 +1,346 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque_tests.cpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../work_stealing_deque.hpp"
+#include "../stack.hpp"
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <ctime>
+#include <iomanip>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+#include <random>
+
+#define BLUE "\e[0;34m"
+#define RED "\e[0;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define RESET "\e[0m"
+
+#define EQUAL(x) ((x) ? (std::cout << "\033[1;32mAC\033[0m\n") : (std::cout << "\033[1;31mWA\033[0m\n"))
+#define TIME_FAC 4 // the work-stealing scheduler can be slower up to a single locked ft::stack scheduler * TIME_FAC (MAX 20)
+
+#define TEST_CASE(fn)                                                                                                             \
+    cout << GREEN << "\t======================================================================================" << RESET << endl; \
+    cout << endl;                                                                                                                 \
+    cout << BLUE << "\t   Running " << #fn << " ... \t\t\t\t\t\t" << RESET << std::endl;                                          \
+    fn();                                                                                                                         \
+    cout << endl;                                                                                                                 \
+    cout << GREEN << "\t======================================================================================" << RESET << endl;
+using namespace std;
+
+typedef ft::work_stealing_deque<long> ldeque;
+
+time_t get_time(void)
+{
+    struct timeval time_now;
+
+    gettimeofday(&time_now, NULL);
+    time_t msecs_time = (time_now.tv_sec * 1e3) + (time_now.tv_usec / 1e3);
+    return (msecs_time);
+}
+
+struct Thief
+{
+    ldeque *d;
+    long *done;
+    std::vector<long> stolen;
+};
+
+void *thiefWorker(void *arg)
+{
+    Thief *t = static_cast<Thief *>(arg);
+    long v;
+
+    while (!ft::atomic_load(t->done) || !t->d->empty())
+    {
+        if (t->d->steal(v))
+            t->stolen.push_back(v);
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+void testWorkStealingDeque()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " push / pop / steal "
+              << "] --------------------]\t\t\033[0m";
+    {
+        bool cond(true);
+        std::mt19937 generator(46);
+        std::deque<long> model;
+        ldeque d(2);
+        long v;
+
+        for (long i = 0; i < 1e5 && cond; i++)
+        {
+            int op = generator() % 4;
+            if (op < 2)
+            {
+                model.push_back(i);
+                d.push(i);
+            }
+            else if (model.empty())
+                cond = !d.pop(v) && !d.steal(v) && d.empty();
+            else if (op == 2)
+            {
+                cond = d.pop(v) && v == model.back();
+                model.pop_back();
+            }
+            else
+            {
+                cond = d.steal(v) && v == model.front();
+                model.pop_front();
+            }
+            cond = cond && d.size() == model.size();
+        }
+        EQUAL(cond && d.capacity() >= model.size());
+    }
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " owner and 7 thieves: taken once "
+              << "] --------------------]\t\t\033[0m";
+    {
+        const int nthieves = 7, pushes = 1e6;
+        ldeque d;
+        long done(0), v;
+        std::vector<pthread_t> threads(nthieves);
+        std::vector<Thief> thieves(nthieves);
+        std::vector<char> seen(pushes, 0);
+        bool cond(true);
+
+        for (int i = 0; i < nthieves; i++)
+        {
+            thieves[i].d = &d;
+            thieves[i].done = &done;
+            pthread_create(&threads[i], NULL, thiefWorker, &thieves[i]);
+        }
+        for (long i = 0; i < pushes; i++)
+        {
+            d.push(i);
+            if (i % 3 == 0 && d.pop(v))
+                seen[v]++;
+        }
+        while (d.pop(v))
+            seen[v]++;
+        ft::atomic_store(&done, 1L);
+        for (int i = 0; i < nthieves; i++)
+            pthread_join(threads[i], NULL);
+        for (int i = 0; i < nthieves; i++)
+            for (size_t j = 0; j < thieves[i].stolen.size(); j++)
+                seen[thieves[i].stolen[j]]++;
+        for (int i = 0; i < pushes && cond; i++)
+            cond = seen[i] == 1;
+        EQUAL(cond && d.empty());
+    }
+}
+
+// ---------------- Fork/Join ----------------
+// fib(n) as a tree of tasks: a task above the cutoff spawns fib(n - 2) and
+// runs fib(n - 1) itself; the last child to finish completes its parent.
+struct Task
+{
+    int n;
+    Task *parent;
+    long pending;
+    long sum;
+};
+
+struct Scheduler
+{
+    std::vector<ft::work_stealing_deque<Task *> *> deques;
+    pthread_mutex_t lock; // For the locked variant: one shared stack.
+    ft::stack<Task *> shared;
+    bool stealing;
+    long done;
+    long result;
+};
+
+struct WorkerArg
+{
+    Scheduler *s;
+    int id;
+};
+
+const int cutoff = 12;
+
+long fib(int n)
+{
+    return (n < 2) ? n : fib(n - 1) + fib(n - 2);
+}
+
+void spawn(Scheduler *s, int id, Task *t)
+{
+    if (s->stealing)
+        s->deques[id]->push(t);
+    else
+    {
+        pthread_mutex_lock(&s->lock);
+        s->shared.push(t);
+        pthread_mutex_unlock(&s->lock);
+    }
+}
+
+bool next(Scheduler *s, int id, unsigned &seed, Task *&t)
+{
+    if (!s->stealing)
+    {
+        pthread_mutex_lock(&s->lock);
+        bool found = !s->shared.empty();
+        if (found)
+        {
+            t = s->shared.top();
+            s->shared.pop();
+        }
+        pthread_mutex_unlock(&s->lock);
+        return found;
+    }
+    if (s->deques[id]->pop(t))
+        return true;
+    seed = seed * 1103515245 + 12345;
+    return s->deques[(seed >> 16) % s->deques.size()]->steal(t);
+}
+
+void complete(Scheduler *s, Task *t, long value)
+{
+    while (t->parent)
+    {
+        Task *parent = t->parent;
+        delete t;
+        ft::atomic_fetch_add(&parent->sum, value);
+        if (ft::atomic_fetch_add(&parent->pending, -1L) != 1)
+            return;
+        value = ft::atomic_load(&parent->sum);
+        t = parent;
+    }
+    s->result = value;
+    ft::atomic_store(&s->done, 1L);
+}
+
+void run(Scheduler *s, int id, Task *t)
+{
+    while (t->n >= cutoff)
+    {
+        Task *left = new Task();
+        Task *right = new Task();
+        left->n = t->n - 1;
+        right->n = t->n - 2;
+        left->parent = right->parent = t;
+        t->pending = 2;
+        spawn(s, id, right);
+        t = left;
+    }
+    complete(s, t, fib(t->n));
+}
+
+void *schedulerWorker(void *arg)
+{
+    WorkerArg *w = static_cast<WorkerArg *>(arg);
+    unsigned seed = w->id;
+    Task *t;
+
+    while (!ft::atomic_load(&w->s->done))
+    {
+        if (next(w->s, w->id, seed, t))
+            run(w->s, w->id, t);
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+time_t runFib(bool stealing, int nthreads, int n, long &result)
+{
+    Scheduler s;
+    std::vector<pthread_t> threads(nthreads);
+    std::vector<WorkerArg> args(nthreads);
+    Task *root = new Task();
+
+    root->n = n;
+    s.stealing = stealing;
+    s.done = 0;
+    pthread_mutex_init(&s.lock, NULL);
+    for (int i = 0; i < nthreads; i++)
+        s.deques.push_back(new ft::work_stealing_deque<Task *>());
+    spawn(&s, 0, root);
+    time_t start = get_time();
+    for (int i = 0; i < nthreads; i++)
+    {
+        args[i].s = &s;
+        args[i].id = i;
+        pthread_create(&threads[i], NULL, schedulerWorker, &args[i]);
+    }
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    time_t diff = get_time() - start;
+    for (int i = 0; i < nthreads; i++)
+        delete s.deques[i];
+    delete root;
+    pthread_mutex_destroy(&s.lock);
+    result = s.result;
+    return (diff);
+}
+
+void testForkJoin()
+{
+    std::cout << "\t\033[1;37m[-------------------- [" << std::setw(40) << std::left << " fib(36): locked stack vs stealing "
+              << "] --------------------]\t\t\033[0m";
+    {
+        time_t locked_diff(0), stealing_diff(0), diff;
+        std::vector<time_t> locked_times, stealing_times;
+        long expected = fib(36), result;
+        bool cond(true);
+
+        for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+        {
+            locked_times.push_back(runFib(false, nthreads, 36, result));
+            locked_diff += locked_times.back();
+            cond = cond && result == expected;
+        }
+        diff = (locked_diff) ? (locked_diff * TIME_FAC) : TIME_FAC;
+
+        ualarm(diff * 1e3, 0);
+        for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+        {
+            stealing_times.push_back(runFib(true, nthreads, 36, result));
+            stealing_diff += stealing_times.back();
+            cond = cond && result == expected;
+        }
+        ualarm(0, 0);
+        EQUAL(cond);
+        for (size_t i = 0; i < locked_times.size(); i++)
+            std::cout << "\t\t(" << std::setw(2) << std::right << (1 << i) << " threads: locked stack " << locked_times[i]
+                      << "ms, work stealing " << stealing_times[i] << "ms)" << std::endl;
+    }
+}
+
+void alarm_handler(int seg)
+{
+    (void)seg;
+    std::cout << "\033[1;33mTLE\033[0m\n";
+    kill(getpid(), SIGINT);
+}
+
+int main()
+{
+    signal(SIGALRM, alarm_handler);
+
+    std::cout << YELLOW << "Testing work_stealing_deque;" << RESET << std::endl;
+    TEST_CASE(testWorkStealingDeque);
+    TEST_CASE(testForkJoin);
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,288 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_policies.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TREE_POLICIES_HPP
+#define TREE_POLICIES_HPP
+
+#include "utilities/atomic.hpp"
+#include "utilities/bloom_filter.hpp"
+#include "utilities/hash.hpp"
+#include "utilities/pair.hpp"
+#include <cstddef>
+
+namespace ft
+{
+// A tree policy decides what every RedBlackTree node keeps about its subtree
+// (the `_augment` member of the node). The tree calls update(node) bottom-up
+// after linking or unlinking a node and after every rotation, so update() only
+// has to recompute the node from its value and its two children.
+
+// ---------------- No Augmentation ----------------
+struct no_augment {
+  struct data_type { };
+  static const bool enabled = false;
+  static const bool counts  = false;
+  static const bool threads = false;
+  static const bool filters = false;
+  static const bool publishes = false;
+
+  template < class Node >
+  static void update ( Node * ) { }
+};
+
+// ---------------- Subtree Size ----------------
+// Order statistics: rank, select and distance in O(log n).
+struct subtree_size {
+  typedef std::size_t data_type;
+  static const bool enabled = true;
+  static const bool counts  = true;
+  static const bool threads = false;
+  static const bool filters = false;
+  static const bool publishes = false;
+
+  template < class Node >
+  static void update ( Node * node )
+  { node->_augment = 1 + count(node->_left) + count(node->_right); }
+
+  template < class Node >
+  static std::size_t count ( const Node * node )
+  { return ((node) ? node->_augment : 0); }
+
+  // Number of nodes before `node` in order ( the size of the tree for nullptr ).
+  template < class Node >
+  static std::size_t position ( const Node * node, const Node * root )
+  {
+    if (node == nullptr) return (count(root));
+    std::size_t pos = count(node->_left);
+    while (node->_parent) {
+      if (node->_isRight)
+        pos += count(node->_parent->_left) + 1;
+      node = node->_parent;
+    }
+    return (pos);
+  }
+};
+
+// ---------------- Monoid Augmentation ----------------
+// Keeps the combination of every value of a subtree, in order. Monoid provides:
+//   typedef ... data_type;
+//   static data_type identity ( );
+//   static data_type lift ( const value_type & value );
+//   static data_type combine ( const data_type & lhs, const data_type & rhs ); // associative
+template < class Monoid >
+struct monoid_augment {
+  typedef typename Monoid::data_type data_type;
+  static const bool enabled = true;
+  static const bool counts  = false;
+  static const bool threads = false;
+  static const bool filters = false;
+  static const bool publishes = false;
+
+  template < class Node >
+  static void update ( Node * node )
+  { node->_augment = Monoid::combine(Monoid::combine(get(node->_left), Monoid::lift(*node->_value)), get(node->_right)); }
+
+  template < class Node >
+  static data_type get ( const Node * node )
+  { return ((node) ? node->_augment : Monoid::identity()); }
+};
+
+// ---------------- Threaded ----------------
+// Also keeps the nodes in a doubly linked in-order list, so that iterators
+// step with a single load. Costs two pointers per node. Split and join patch
+// the list at their seams; copies, bulk builds and merges relink it in O(n).
+template < class Policy = no_augment >
+struct threaded : public Policy {
+  static const bool threads = true;
+};
+
+// ---------------- Filtered ----------------
+// Also keeps a blocked Bloom filter over the keys, checked by find(), count()
+// and erase(key) before they descend: most misses cost one cache line. The
+// keys are hashed with ft::hash, which is defined for integral, enum, pointer
+// and std::string keys; any other key fails to compile until ft::hash is
+// specialized for it. Keys that Compare finds equivalent must hash equal, or
+// lookups miss keys that are there: no case-insensitive compare over the
+// default std::string hash. Split, join, merge and bulk builds rebuild the
+// filter in O(n).
+template < class Policy = no_augment >
+struct filtered : public Policy {
+  static const bool filters = true;
+};
+
+// ---------------- Published ----------------
+// For a tree that readers walk without a lock while one writer relinks it
+// (ft::seqlock_map): the tree stores every child and root link with a relaxed
+// atomic store, to pair with the readers' atomic loads. That compiles to the
+// same plain store on the usual targets, but the walk is no longer a race.
+template < class Policy = no_augment >
+struct published : public Policy {
+  static const bool publishes = true;
+};
+
+// ---------------- Link Stores ----------------
+// How the tree writes a child or root link, plainly unless published.
+template < class Node, bool Publishes >
+struct tree_store {
+  static void set ( Node *& link, Node * node ) { link = node; }
+};
+template < class Node >
+struct tree_store< Node, true > {
+  static void set ( Node *& link, Node * node ) { atomic_store_relaxed(&link, node); }
+};
+
+// ---------------- Tree Links ----------------
+// The in-order links of a node under a threaded policy, and their upkeep.
+// Without threads there is nothing to keep.
+template < class Node, bool Threads >
+struct tree_links {
+  static void thread ( Node * ) { }
+  static void unthread ( Node * ) { }
+  static void chain ( Node *, Node * ) { }
+  static void rethread ( Node * ) { }
+};
+template < class Node >
+struct tree_links< Node, true > {
+  Node * _prev;
+  Node * _next;
+
+  tree_links ( ) : _prev(nullptr), _next(nullptr) { }
+
+  static void thread ( Node * node ) // node was just linked as a leaf
+  {
+    Node * parent = node->_parent;
+    if (parent == nullptr) {
+      node->_prev = node->_next = nullptr;
+    } else if (node->_isRight) {
+      chain(node, parent->_next);
+      chain(parent, node);
+    } else {
+      chain(parent->_prev, node);
+      chain(node, parent);
+    }
+  }
+  static void unthread ( Node * node )
+  {
+    chain(node->_prev, node->_next);
+    node->_prev = node->_next = nullptr;
+  }
+  static void chain ( Node * first, Node * second )
+  {
+    if (first)  first->_next = second;
+    if (second) second->_prev = first;
+  }
+  static void rethread ( Node * root )
+  { chain(rethread(root, nullptr), nullptr); }
+
+private:
+  static Node * rethread ( Node * node, Node * last ) // Returns the last node of the subtree.
+  {
+    if (node == nullptr) return (last);
+    last = rethread(node->_left, last);
+    chain(last, node);
+    return (rethread(node->_right, node));
+  }
+};
+
+// ---------------- Tree Filter ----------------
+// The filter of a tree under a filtered policy. Insertions add their key;
+// erasures only count the key they leave behind, and the filter is rebuilt
+// from the tree once these are half of it, or once the tree outgrows it, so
+// both stay O(1) amortized. Without a filter every key may be there.
+template < class Node, class Key, class Alloc, bool Filters >
+struct tree_filter {
+  explicit tree_filter ( const Alloc & ) { }
+  bool may_contain ( const Key & ) const { return (true); }
+  void added ( const Node *, const Node * ) { }
+  void removed ( const Node * ) { }
+  void rebuild ( const Node * ) { }
+  void clear ( void ) { }
+  void swap ( tree_filter & ) { }
+};
+template < class Node, class Key, class Alloc >
+struct tree_filter< Node, Key, Alloc, true > {
+  typedef std::size_t size_type;
+
+  ft::blocked_bloom<Alloc> _bloom;
+  size_type                _keys;  // Added since the last rebuild.
+  size_type                _stale; // Of those, erased since.
+
+  explicit tree_filter ( const Alloc & alloc ) : _bloom(alloc), _keys(0), _stale(0) { }
+
+  bool may_contain ( const Key & k ) const
+  { return (_bloom.may_contain(_hash(k))); }
+  void added ( const Node * node, const Node * root )
+  {
+    if (_keys >= _bloom.capacity())
+      return (rebuild(root));
+    _bloom.insert(_hash(key_of(*node->_value)));
+    ++_keys;
+  }
+  void removed ( const Node * root )
+  {
+    if (++_stale * 2 > _keys)
+      rebuild(root);
+  }
+  void rebuild ( const Node * root ) // Sized for twice the keys, to leave room for growth.
+  {
+    _keys = _count(root);
+    _stale = 0;
+    _bloom.reset((_keys) ? _keys * 2 : 0);
+    _add(root);
+  }
+  void clear ( void )
+  {
+    _bloom.reset(0);
+    _keys = _stale = 0;
+  }
+  void swap ( tree_filter & x )
+  {
+    size_type keys = _keys, stale = _stale;
+    _bloom.swap(x._bloom);
+    _keys = x._keys; _stale = x._stale;
+    x._keys = keys; x._stale = stale;
+  }
+
+  static const Key & key_of ( const Key & value ) { return (value); }
+  template < class T >
+  static const Key & key_of ( const ft::pair<const Key, T> & value ) { return (value.first); }
+
+private:
+  static uint64_t _hash ( const Key & k ) { return (hash_mix(ft::hash<Key>()(k))); }
+  static size_type _count ( const Node * node )
+  { return ((node) ? 1 + _count(node->_left) + _count(node->_right) : 0); }
+  void _add ( const Node * node )
+  {
+    for (; node; node = node->_right) {
+      _add(node->_left);
+      _bloom.insert(_hash(key_of(*node->_value)));
+    }
+  }
+};
+
+// ---------------- Policy Count ----------------
+// The size of a subtree when the policy counts nodes, the fallback otherwise.
+template < bool Counts >
+struct policy_count {
+  template < class Policy, class Node >
+  static std::size_t get ( const Node *, std::size_t fallback )
+  { return (fallback); }
+};
+template < >
+struct policy_count< true > {
+  template < class Policy, class Node >
+  static std::size_t get ( const Node * node, std::size_t )
+  { return (Policy::count(node)); }
+};
+}
+
+#endif
@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_MAP_HPP
+#define UNORDERED_MAP_HPP
+
+#include "Iterators/iterator_hash.hpp"
+#include "hash_table.hpp"
+#include <functional>
+#include <stdexcept>
+
+#define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
+
+namespace ft
+{
+// A hash map with open addressing (see HashTable): one flat array of values,
+// no allocation per element, and lookups that usually touch one group of
+// control bytes and one slot.
+// Inserting may move every element to a larger array, which invalidates the
+// iterators and references; erasing only invalidates the erased element.
+template
+<
+class Key,
+class T,
+class Hash = ft::hash<Key>,
+class Pred = std::equal_to<Key>,
+class Alloc = std::allocator< ft::pair<const Key,T> >
+>
+class unordered_map {
+public:
+  typedef Key                                           key_type;
+  typedef T                                             mapped_type;
+  typedef ft::pair<const key_type, mapped_type>         value_type;
+  typedef Hash                                          hasher;
+  typedef Pred                                          key_equal;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::reference            reference;
+  typedef typename allocator_type::const_reference      const_reference;
+  typedef typename allocator_type::pointer              pointer;
+  typedef typename allocator_type::const_pointer        const_pointer;
+  typedef typename allocator_type::difference_type      difference_type;
+  typedef typename allocator_type::size_type            size_type;
+  typedef ft::iterator_hash<value_type>                 iterator;
+  typedef ft::iterator_hash<const value_type>           const_iterator;
+
+  static const key_type & key_of ( const value_type & val ) { return (val.first); }
+private:
+  typedef ft::HashTable<unordered_map>                  table_type;
+
+private:
+  allocator_type  _alloc;
+  table_type      _table;
+
+public:
+  // [*] // explicit unordered_map ( size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type() );
+  // [*] // template < class InputIterator > unordered_map ( InputIterator first, InputIterator last, size_type n = 0, ... );
+  // [*] // unordered_map ( const unordered_map& x );
+  // [*] // unordered_map& operator=( const unordered_map& x );
+  // [*] // ~unordered_map ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit unordered_map ( size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type() )
+    : _alloc ( alloc )
+    , _table ( hf, eql, _alloc )
+  {
+    _table.reserve(n);
+  }
+  template < class InputIterator >
+  unordered_map ( InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type(), SFINAAE( InputIterator ) )
+    : _alloc ( alloc )
+    , _table ( hf, eql, _alloc )
+  {
+    _table.reserve(n);
+    insert(first, last);
+  }
+  unordered_map ( const unordered_map& x )
+    : _alloc ( x._alloc )
+    , _table ( x._table, _alloc )
+  { }
+  unordered_map& operator=( const unordered_map& x )
+  {
+    _table = x._table;
+    return (*this);
+  }
+  ~unordered_map ( ) { }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type max_size ( ) const;
+  bool empty ( ) const { return (this->size() == 0); }
+  size_type size ( ) const { return (_table.size()); }
+  size_type max_size ( ) const { return (_alloc.max_size()); }
+
+  // [*] // iterator begin ( );
+  // [*] // const_iterator begin ( ) const;
+  // [*] // iterator end ( );
+  // [*] // const_iterator end ( ) const;
+  iterator       begin ( )       { return (_iterator(0)); }
+  const_iterator begin ( ) const { return (_iterator(0)); }
+  iterator       end ( )         { return (_iterator(_table.capacity())); }
+  const_iterator end ( ) const   { return (_iterator(_table.capacity())); }
+
+  // [*] // mapped_type& at (const key_type& k);
+  // [*] // const mapped_type& at (const key_type& k) const;
+  // [*] // mapped_type& operator[] (const key_type& k);
+  mapped_type& at (const key_type& k)
+  {
+    size_type i = _table.find(k);
+    if ( i != _table.capacity() )
+      return (_table.slots()[i].second);
+    else
+      throw (std::out_of_range("unordered_map::at : key not found"));
+  }
+  const mapped_type& at (const key_type& k) const
+  {
+    size_type i = _table.find(k);
+    if ( i != _table.capacity() )
+      return (_table.slots()[i].second);
+    else
+      throw (std::out_of_range("unordered_map::at : key not found"));
+  }
+  mapped_type& operator[] (const key_type& k)
+  {
+    size_type i = _table.find(k);
+    if ( i == _table.capacity() )
+      i = _table.insert(ft::make_pair<key_type, mapped_type>(k, mapped_type())).first;
+    return (_table.slots()[i].second);
+  }
+
+  // [*] // pair<iterator,bool> insert ( const value_type& val );
+  // [*] // iterator insert ( const_iterator hint, const value_type& val );
+  // [*] // template < class InputIterator > void insert ( InputIterator first, InputIterator last );
+  pair<iterator,bool> insert ( const value_type& val )
+  {
+    ft::pair<size_type, bool> result = _table.insert(val);
+    return (ft::make_pair<iterator,bool>(_iterator(result.first), result.second));
+  }
+  iterator insert ( const_iterator hint, const value_type& val )
+  {
+    (void)hint;
+    return (this->insert(val).first);
+  }
+  template < class InputIterator >
+  void insert ( InputIterator first, InputIterator last, SFINAAE( InputIterator ) )
+  {
+    while (first != last)
+      this->insert(*(first++));
+  }
+
+  // [*] // size_type erase ( const key_type& k );
+  // [*] // void erase ( iterator position );
+  // [*] // void erase ( iterator first, iterator last );
+  size_type erase ( const key_type& k )
+  { return (_table.erase(k)); }
+  void erase ( iterator position )
+  { _table.erase_at(position.base() - _table.slots()); }
+  void erase ( iterator first, iterator last ) // Erasing moves nothing, so the iterators stay valid.
+  {
+    while (first != last)
+      this->erase(first++);
+  }
+
+  // [*] // void swap ( unordered_map& x );
+  // [*] // void clear ( );
+  void swap ( unordered_map& x )
+  { _table.swap(x._table); }
+  void clear ( ) { _table.clear(); }
+
+  // [*] // iterator find (const key_type& k);
+  // [*] // const_iterator find (const key_type& k) const;
+  // [*] // size_type count( const key_type& k ) const;
+  // [*] // pair<iterator,iterator> equal_range (const key_type& k);
+  // [*] // pair<const_iterator,const_iterator> equal_range (const key_type& k) const;
+  iterator find (const key_type& k)
+  { return (_iterator(_table.find(k))); }
+  const_iterator find (const key_type& k) const
+  { return (_iterator(_table.find(k))); }
+  size_type count( const key_type& k ) const
+  { return ((_table.find(k) != _table.capacity()) ? 1 : 0); }
+  pair<iterator,iterator> equal_range (const key_type& k)
+  {
+    iterator it = find(k);
+    if (it == end())
+      return (ft::make_pair(it, it));
+    iterator next = it;
+    return (ft::make_pair(it, ++next));
+  }
+  pair<const_iterator,const_iterator> equal_range (const key_type& k) const
+  {
+    const_iterator it = find(k);
+    if (it == end())
+      return (ft::make_pair(it, it));
+    const_iterator next = it;
+    return (ft::make_pair(it, ++next));
+  }
+
+  // [*] // size_type bucket_count ( ) const;
+  // [*] // float load_factor ( ) const;
+  // [*] // float max_load_factor ( ) const;
+  // [*] // void rehash ( size_type n );
+  // [*] // void reserve ( size_type n );
+  // Every slot is a bucket of one; the table grows at 7/8 full.
+  size_type bucket_count ( ) const { return (_table.capacity()); }
+  float load_factor ( ) const { return ((_table.capacity()) ? float(size()) / _table.capacity() : 0.0f); }
+  float max_load_factor ( ) const { return (0.875f); }
+  void rehash ( size_type n ) { _table.rehash(n); }
+  void reserve ( size_type n ) { _table.reserve(n); }
+
+  // [*] // hasher hash_function ( ) const;
+  // [*] // key_equal key_eq ( ) const;
+  hasher hash_function ( ) const { return (_table.hash_function()); }
+  key_equal key_eq ( ) const { return (_table.key_eq()); }
+
+private:
+  iterator _iterator ( size_type i ) const
+  { return (iterator(_table.ctrl() + i, _table.slots() + i)); }
+};
+
+template< class Key, class T, class Hash, class Pred, class Alloc >
+void swap (unordered_map<Key,T,Hash,Pred,Alloc>& x, unordered_map<Key,T,Hash,Pred,Alloc>& y)
+{
+  x.swap(y);
+}
+
+template< class Key, class T, class Hash, class Pred, class Alloc >
+bool operator==( const ft::unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,Pred,Alloc>& rhs )
+{
+  if (lhs.size() != rhs.size()) return (false);
+  typedef typename ft::unordered_map<Key,T,Hash,Pred,Alloc>::const_iterator const_iterator;
+  for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+    const_iterator found = rhs.find(it->first);
+    if (found == rhs.end() || !(found->second == it->second))
+      return (false);
+  }
+  return (true);
+}
+
+template< class Key, class T, class Hash, class Pred, class Alloc >
+bool operator!=( const ft::unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,Pred,Alloc>& rhs )
+{
+  return (!(lhs == rhs));
+}
+}
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aligned_storage.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ALIGNED_STORAGE_HPP
+#define ALIGNED_STORAGE_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+// Raw room for N objects of type T, aligned as T itself asks, even past
+// the alignment of long double or void *. Nothing is constructed in it:
+// the owner placement-news into data() and destroys what it built.
+// C++98 has no alignas, so this takes the GCC / Clang attribute instead.
+template < class T, std::size_t N = 1 >
+struct aligned_storage {
+  char  _bytes[(N ? N : 1) * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+
+  T *       data ( void )       { return (reinterpret_cast<T *>(_bytes)); }
+  const T * data ( void ) const { return (reinterpret_cast<const T *>(_bytes)); }
+};
+}
+
+#endif
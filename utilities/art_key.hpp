@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   art_key.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ART_KEY_HPP
+#define ART_KEY_HPP
+
+#include <string>
+#include <cstddef>
+
+namespace ft
+{
+// Turns a key into bytes whose lexicographic order is the order of the keys,
+// for the radix tree of ft::art_map. No encoding may be a prefix of another.
+// An encoder provides size(key) and encode(key, out); encoders of keys that
+// have prefixes (strings) also provide prefix_size() and encode_prefix().
+template < class Key >
+struct art_key;
+
+// Big-endian, with the sign bit flipped so negative values come first.
+template < class Int, bool Signed >
+struct art_integer_key {
+  typedef Int key_type;
+
+  static std::size_t size ( const key_type & ) { return (sizeof(key_type)); }
+  static void encode ( const key_type & key, unsigned char * out )
+  {
+    unsigned long long bits = static_cast<unsigned long long>(key);
+    if (Signed)
+      bits ^= 1ULL << (8 * sizeof(key_type) - 1);
+    for (std::size_t i = sizeof(key_type); i-- > 0; bits >>= 8)
+      out[i] = static_cast<unsigned char>(bits);
+  }
+};
+
+template < > struct art_key< unsigned char > : art_integer_key< unsigned char, false > { };
+template < > struct art_key< unsigned short > : art_integer_key< unsigned short, false > { };
+template < > struct art_key< unsigned int > : art_integer_key< unsigned int, false > { };
+template < > struct art_key< unsigned long > : art_integer_key< unsigned long, false > { };
+template < > struct art_key< unsigned long long > : art_integer_key< unsigned long long, false > { };
+template < > struct art_key< signed char > : art_integer_key< signed char, true > { };
+template < > struct art_key< short > : art_integer_key< short, true > { };
+template < > struct art_key< int > : art_integer_key< int, true > { };
+template < > struct art_key< long > : art_integer_key< long, true > { };
+template < > struct art_key< long long > : art_integer_key< long long, true > { };
+template < > struct art_key< char > : art_integer_key< char, (char(-1) < 0) > { };
+
+// The bytes as they are, a 0 byte escaped as 0x00 0xFF, and 0x00 0x00 at the
+// end: "ab" < "ab\0" < "ab\1" still holds and no key is a prefix of another.
+// The prefix encoding leaves the end out, so it starts every key that starts
+// with the prefix.
+template < >
+struct art_key< std::string > {
+  typedef std::string key_type;
+
+  static std::size_t prefix_size ( const key_type & key )
+  {
+    std::size_t n = key.size();
+    for (std::string::size_type i = 0; i < key.size(); ++i)
+      n += (key[i] == '\0');
+    return (n);
+  }
+  static unsigned char * encode_prefix ( const key_type & key, unsigned char * out )
+  {
+    for (std::string::size_type i = 0; i < key.size(); ++i) {
+      *out++ = static_cast<unsigned char>(key[i]);
+      if (key[i] == '\0')
+        *out++ = 0xFF;
+    }
+    return (out);
+  }
+  static std::size_t size ( const key_type & key ) { return (prefix_size(key) + 2); }
+  static void encode ( const key_type & key, unsigned char * out )
+  {
+    out = encode_prefix(key, out);
+    out[0] = 0;
+    out[1] = 0;
+  }
+};
+
+// The encoding of one key, on the stack unless it is long.
+template < class Encoder >
+class art_key_bytes {
+public:
+  typedef typename Encoder::key_type key_type;
+
+private:
+  unsigned char _inline[32];
+  unsigned char * _data;
+  std::size_t   _size;
+
+  art_key_bytes ( const art_key_bytes & );
+  art_key_bytes & operator= ( const art_key_bytes & );
+
+public:
+  explicit art_key_bytes ( const key_type & key ) : _data(_inline), _size(Encoder::size(key))
+  {
+    if (_size > sizeof(_inline))
+      _data = new unsigned char[_size];
+    Encoder::encode(key, _data);
+  }
+  art_key_bytes ( const key_type & prefix, bool ) : _data(_inline), _size(Encoder::prefix_size(prefix))
+  {
+    if (_size > sizeof(_inline))
+      _data = new unsigned char[_size];
+    Encoder::encode_prefix(prefix, _data);
+  }
+  ~art_key_bytes ( )
+  {
+    if (_data != _inline)
+      delete[] _data;
+  }
+
+  const unsigned char * data ( void ) const { return (_data); }
+  std::size_t size ( void ) const { return (_size); }
+  unsigned char operator[] ( std::size_t i ) const { return (_data[i]); }
+};
+}
+
+#endif
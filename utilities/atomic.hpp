@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   atomic.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+namespace ft
+{
+// Thin wrappers over the GCC / Clang __atomic builtins, as there is no
+// <atomic> in C++98. Loads acquire, stores release and read-modify-writes
+// do both, which is what the containers here rely on.
+template < class T >
+T atomic_load ( const T * p )
+{ return (__atomic_load_n(p, __ATOMIC_ACQUIRE)); }
+
+template < class T >
+void atomic_store ( T * p, T value )
+{ __atomic_store_n(p, value, __ATOMIC_RELEASE); }
+
+template < class T >
+T atomic_fetch_add ( T * p, T value ) // Returns the previous value.
+{ return (__atomic_fetch_add(p, value, __ATOMIC_ACQ_REL)); }
+
+template < class T >
+T atomic_exchange ( T * p, T value )
+{ return (__atomic_exchange_n(p, value, __ATOMIC_ACQ_REL)); }
+
+template < class T >
+bool atomic_compare_exchange ( T * p, T & expected, T desired ) // On failure, expected gets the current value.
+{ return (__atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)); }
+
+template < class T >
+bool atomic_compare_exchange_seq_cst ( T * p, T & expected, T desired ) // Ordered with every other seq_cst operation.
+{ return (__atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)); }
+
+// For words only the calling thread writes, or whose readers cope with a
+// stale value: no ordering at all.
+template < class T >
+T atomic_load_relaxed ( const T * p )
+{ return (__atomic_load_n(p, __ATOMIC_RELAXED)); }
+
+template < class T >
+void atomic_store_relaxed ( T * p, T value )
+{ __atomic_store_n(p, value, __ATOMIC_RELAXED); }
+
+inline void atomic_fence ( ) // Full barrier: orders an earlier store before a later load.
+{ __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+}
+
+#endif
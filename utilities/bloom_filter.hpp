@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bloom_filter.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BLOOM_FILTER_HPP
+#define BLOOM_FILTER_HPP
+
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+namespace ft
+{
+// A blocked Bloom filter over 64-bit hashes: the high half of a hash picks a
+// 512-bit block, one cache line, and every bit of the key is set inside it,
+// so a query costs a single cache miss. No false negatives; with the default
+// 12 bits and 6 probes per key, under 1% false positives at full capacity.
+template < class Alloc = std::allocator<uint64_t> >
+class blocked_bloom {
+public:
+  typedef typename Alloc::template rebind<uint64_t>::other  allocator_type;
+  typedef std::size_t                                       size_type;
+
+  static const size_type block_words  = 8;
+  static const size_type bits_per_key = 12;
+  static const unsigned  probes       = 6;
+
+private:
+  allocator_type _alloc;
+  uint64_t       * _storage; // The allocation, block_words - 1 words longer than the blocks to align them.
+  uint64_t       * _words;
+  size_type      _blocks;
+
+public:
+  explicit blocked_bloom ( const Alloc & alloc = Alloc() )
+    : _alloc(alloc), _storage(nullptr), _words(nullptr), _blocks(0)
+  { }
+  blocked_bloom ( const blocked_bloom & copy )
+    : _alloc(copy._alloc), _storage(nullptr), _words(nullptr), _blocks(0)
+  { *this = copy; }
+  blocked_bloom & operator= ( const blocked_bloom & copy )
+  {
+    if (this == &copy) return (*this);
+    _resize(copy._blocks);
+    if (_blocks)
+      std::memcpy(_words, copy._words, _blocks * block_words * sizeof(uint64_t));
+    return (*this);
+  }
+  ~blocked_bloom ( ) { _resize(0); }
+
+  // Empties the filter and sizes it for `keys` keys.
+  void reset ( size_type keys )
+  {
+    _resize((keys * bits_per_key + block_words * 64 - 1) / (block_words * 64));
+    clear();
+  }
+  void clear ( void )
+  {
+    if (_blocks)
+      std::memset(_words, 0, _blocks * block_words * sizeof(uint64_t));
+  }
+  void swap ( blocked_bloom & x )
+  {
+    uint64_t * storage = _storage, * words = _words;
+    size_type blocks = _blocks;
+    _storage = x._storage; _words = x._words; _blocks = x._blocks;
+    x._storage = storage; x._words = words; x._blocks = blocks;
+  }
+
+  size_type capacity ( void ) const { return (_blocks * block_words * 64 / bits_per_key); } // In keys.
+  size_type bytes ( void ) const { return (_blocks * block_words * sizeof(uint64_t)); }
+
+  void insert ( uint64_t hash )
+  {
+    uint64_t * block = _block(hash);
+    uint64_t bits = hash * 0x9e3779b97f4a7c15ULL;
+    for (unsigned i = 0; i < probes; ++i, bits >>= 9)
+      block[(bits >> 6) & (block_words - 1)] |= uint64_t(1) << (bits & 63);
+  }
+  bool may_contain ( uint64_t hash ) const
+  {
+    if (_blocks == 0) return (false);
+    const uint64_t * block = _block(hash);
+    uint64_t bits = hash * 0x9e3779b97f4a7c15ULL;
+    for (unsigned i = 0; i < probes; ++i, bits >>= 9)
+      if (!(block[(bits >> 6) & (block_words - 1)] & (uint64_t(1) << (bits & 63))))
+        return (false);
+    return (true);
+  }
+
+private:
+  uint64_t * _block ( uint64_t hash ) const
+  { return (_words + ((hash >> 32) * _blocks >> 32) * block_words); }
+  void _resize ( size_type blocks )
+  {
+    if (blocks == _blocks) return ;
+    if (_storage)
+      _alloc.deallocate(_storage, _blocks * block_words + block_words - 1);
+    _storage = _words = nullptr;
+    _blocks = 0;
+    if (blocks == 0) return ;
+    _storage = _alloc.allocate(blocks * block_words + block_words - 1);
+    _blocks = blocks;
+    uintptr_t line = block_words * sizeof(uint64_t);
+    _words = reinterpret_cast<uint64_t *>((reinterpret_cast<uintptr_t>(_storage) + line - 1) / line * line);
+  }
+};
+}
+
+#endif
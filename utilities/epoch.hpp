@@ -0,0 +1,214 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+#define EPOCH_HPP
+
+#include "atomic.hpp"
+#include "hash.hpp"
+#include <stdint.h>
+#include <memory>
+
+namespace ft
+{
+// Epoch-based reclamation for lock-free containers. A thread pins the current
+// epoch for as long as it may hold node pointers; an unlinked node is retired
+// under the epoch it was unlinked in and reclaimed once the global epoch is
+// two ahead, as by then every thread that could have seen it has unpinned.
+// Records are claimed per pin rather than per thread; a thread first tries
+// the record it used last, so it rarely has to scan. They are only freed with
+// the domain.
+// Owner needs `static Node *& limbo ( Node * )`, a link the retired node does
+// not use any more, and `void reclaim ( Node * )`.
+template < class Node, class Owner, class Alloc >
+class epoch_domain {
+public:
+  struct record {
+    unsigned long _epoch;     // Pinned epoch, read by the other threads.
+    int           _active;
+    int           _pins;
+    record        * _next;
+    Node          * _limbo[3];
+    unsigned long _limboEpoch[3];
+    size_t        _retired;
+    uint64_t      _seed;      // Private random state for the pin's owner.
+    char          _pad[64];   // Keeps the next record off this cache line.
+  };
+
+private:
+  typedef typename Alloc::template rebind<record>::other allocator_record_type;
+
+  static const size_t  _advanceEvery = 64;
+
+  static unsigned long  _ids;
+
+  Owner                 * _owner;
+  unsigned long         _id;      // Unique, so a thread's last record is never mistaken for another domain's.
+  unsigned long         _epoch;
+  record                * _records;
+  allocator_record_type _alloc;
+
+  epoch_domain ( const epoch_domain & );
+  epoch_domain & operator= ( const epoch_domain & );
+
+public:
+  epoch_domain ( Owner * owner, const Alloc & alloc ) : _owner(owner) , _id(atomic_fetch_add(&_ids, 1UL) + 1) , _epoch(0) , _records(nullptr) , _alloc(alloc)
+  { }
+  ~epoch_domain ( )
+  {
+    reclaim_all();
+    while (_records) {
+      record * next = _records->_next;
+      _alloc.deallocate(_records, 1);
+      _records = next;
+    }
+  }
+
+  // ---------------- pinning ----------------
+  record * enter ( )
+  {
+    static __thread record        * last = 0;
+    static __thread unsigned long lastId = 0;
+    record                        * rec = nullptr;
+
+    if (lastId == _id && _claim(last))
+      rec = last;
+    for (record * it = atomic_load(&_records); !rec && it; it = it->_next)
+      if (_claim(it))
+        rec = it;
+    if (!rec)
+      rec = _newRecord();
+    last = rec;
+    lastId = _id;
+    rec->_pins = 1;
+    unsigned long e = atomic_load(&_epoch);
+    for (;;) {
+      atomic_store(&rec->_epoch, e);
+      atomic_fence();
+      unsigned long now = atomic_load(&_epoch);
+      if (now == e)
+        break;
+      e = now;
+    }
+    _collect(rec, e);
+    return (rec);
+  }
+  void retain ( record * rec ) { atomic_fetch_add(&rec->_pins, 1); }
+  void release ( record * rec )
+  {
+    if (atomic_fetch_add(&rec->_pins, -1) == 1)
+      atomic_store(&rec->_active, 0);
+  }
+
+  // ---------------- reclamation ----------------
+  // n must be unreachable for threads that pin from now on.
+  void retire ( record * rec, Node * n )
+  {
+    atomic_fence();
+    unsigned long e = atomic_load(&_epoch);
+    size_t        b = e % 3;
+    if (rec->_limboEpoch[b] != e) { // Holds an epoch three or more behind.
+      _free(rec->_limbo[b]);
+      rec->_limbo[b] = nullptr;
+      rec->_limboEpoch[b] = e;
+    }
+    Owner::limbo(n) = rec->_limbo[b];
+    rec->_limbo[b] = n;
+    if (++rec->_retired >= _advanceEvery) {
+      rec->_retired = 0;
+      _tryAdvance();
+      _collect(rec, atomic_load(&_epoch));
+    }
+  }
+  // Only while no thread is pinned.
+  void reclaim_all ( )
+  {
+    for (record * rec = _records; rec; rec = rec->_next)
+      for (size_t b = 0; b < 3; ++b) {
+        _free(rec->_limbo[b]);
+        rec->_limbo[b] = nullptr;
+      }
+  }
+
+private:
+  static bool _claim ( record * rec )
+  {
+    int idle = 0;
+    return (atomic_load(&rec->_active) == 0 && atomic_compare_exchange(&rec->_active, idle, 1));
+  }
+  record * _newRecord ( )
+  {
+    record * rec = _alloc.allocate(1);
+    rec->_epoch = 0;
+    rec->_active = 1;
+    rec->_pins = 0;
+    for (size_t b = 0; b < 3; ++b) {
+      rec->_limbo[b] = nullptr;
+      rec->_limboEpoch[b] = 0;
+    }
+    rec->_retired = 0;
+    rec->_seed = ft::hash_mix(reinterpret_cast<uintptr_t>(rec)) | 1;
+    record * head = atomic_load(&_records);
+    do {
+      rec->_next = head;
+    } while (!atomic_compare_exchange(&_records, head, rec));
+    return (rec);
+  }
+  // The epoch moves on once every pinned record has seen it.
+  void _tryAdvance ( )
+  {
+    unsigned long e = atomic_load(&_epoch);
+    for (record * rec = atomic_load(&_records); rec; rec = rec->_next)
+      if (atomic_load(&rec->_active) && atomic_load(&rec->_epoch) != e)
+        return ;
+    atomic_compare_exchange(&_epoch, e, e + 1);
+  }
+  void _collect ( record * rec, unsigned long e )
+  {
+    for (size_t b = 0; b < 3; ++b)
+      if (rec->_limbo[b] && rec->_limboEpoch[b] + 2 <= e) {
+        _free(rec->_limbo[b]);
+        rec->_limbo[b] = nullptr;
+      }
+  }
+  void _free ( Node * n )
+  {
+    while (n) {
+      Node * next = Owner::limbo(n);
+      _owner->reclaim(n);
+      n = next;
+    }
+  }
+};
+
+template < class Node, class Owner, class Alloc >
+unsigned long epoch_domain<Node, Owner, Alloc>::_ids = 0;
+
+// Pins for the scope of a container operation.
+template < class Domain >
+class epoch_guard {
+private:
+  Domain                      & _domain;
+  typename Domain::record     * _record;
+
+  epoch_guard ( const epoch_guard & );
+  epoch_guard & operator= ( const epoch_guard & );
+
+public:
+  explicit epoch_guard ( Domain & domain ) : _domain(domain) , _record(domain.enter()) { }
+  ~epoch_guard ( ) { _domain.release(_record); }
+
+  typename Domain::record * pin ( ) const { return (_record); }
+};
+}
+
+#endif
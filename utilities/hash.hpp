@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include "is_integral.hpp"
+#include <string>
+#include <cstddef>
+#include <stdint.h>
+
+namespace ft
+{
+// The splitmix64 finalizer: every input bit flips about half the output bits,
+// so both the low and the high bits can pick a bucket or a shard.
+inline uint64_t hash_mix ( uint64_t x )
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return (x);
+}
+
+// Integral and enum keys by default; other keys need a specialization or
+// their own functor. For them the default is left undefined, so that a
+// double or a class with a conversion does not hash through a cast (which
+// is undefined for a negative double) but fails to compile instead.
+template < class Key, bool = ft::is_integral<Key>::value || __is_enum(Key) >
+struct hash_integral;
+
+template < class Key >
+struct hash_integral< Key, true > {
+  std::size_t operator() ( const Key & key ) const
+  { return (std::size_t(hash_mix(static_cast<uint64_t>(key)))); }
+};
+
+template < class Key >
+struct hash : public hash_integral< Key > { };
+
+template < class T >
+struct hash< T * > {
+  std::size_t operator() ( T * const & key ) const
+  { return (std::size_t(hash_mix(reinterpret_cast<uintptr_t>(key)))); }
+};
+
+template < >
+struct hash< std::string > { // FNV-1a, then mixed.
+  std::size_t operator() ( const std::string & key ) const
+  {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (std::string::size_type i = 0; i < key.size(); ++i) {
+      h ^= static_cast<unsigned char>(key[i]);
+      h *= 0x100000001b3ULL;
+    }
+    return (std::size_t(hash_mix(h)));
+  }
+};
+}
+
+#endif
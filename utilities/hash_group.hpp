@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_group.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_GROUP_HPP
+#define HASH_GROUP_HPP
+
+#include <cstring>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+// Every slot of an open-addressing table has a control byte: the low 7 bits
+// of its hash when it is full, or one of these negative values.
+typedef signed char hash_ctrl;
+
+static const hash_ctrl hash_ctrl_empty    = -128;
+static const hash_ctrl hash_ctrl_deleted  = -2;
+static const hash_ctrl hash_ctrl_sentinel = -1; // Ends the iteration, right after the last slot.
+
+// The control bytes of a table with no slots: probing stops at once and
+// iteration is already at the end.
+inline hash_ctrl * hash_empty_group ( void )
+{
+  static hash_ctrl group[16] = { hash_ctrl_sentinel,
+    hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty,
+    hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty,
+    hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty };
+  return (group);
+}
+
+// 16 consecutive control bytes, compared at once. Each match is a bit mask
+// whose bit i stands for the byte i.
+#if defined(__SSE2__)
+struct hash_group {
+  static const int width = 16;
+
+  __m128i ctrl;
+
+  explicit hash_group ( const hash_ctrl * pos ) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) { }
+
+  unsigned match ( hash_ctrl h2 ) const
+  { return (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))); }
+  unsigned match_empty ( void ) const
+  { return (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash_ctrl_empty), ctrl))); }
+  unsigned match_empty_or_deleted ( void ) const // Below the sentinel.
+  { return (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl_sentinel), ctrl))); }
+};
+#else
+struct hash_group {
+  static const int width = 16;
+
+  hash_ctrl ctrl[16];
+
+  explicit hash_group ( const hash_ctrl * pos ) { std::memcpy(ctrl, pos, sizeof(ctrl)); }
+
+  unsigned match ( hash_ctrl h2 ) const
+  {
+    unsigned mask = 0;
+    for (int i = 0; i < width; ++i)
+      mask |= unsigned(ctrl[i] == h2) << i;
+    return (mask);
+  }
+  unsigned match_empty ( void ) const { return (match(hash_ctrl_empty)); }
+  unsigned match_empty_or_deleted ( void ) const
+  {
+    unsigned mask = 0;
+    for (int i = 0; i < width; ++i)
+      mask |= unsigned(ctrl[i] < hash_ctrl_sentinel) << i;
+    return (mask);
+  }
+};
+#endif
+}
+
+#endif
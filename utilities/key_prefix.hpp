@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   key_prefix.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef KEY_PREFIX_HPP
+#define KEY_PREFIX_HPP
+
+#include <string>
+#include <stdint.h>
+#include "pair.hpp"
+
+namespace ft
+{
+// Same ordering as std::less<std::string>. Picking it as the Compare of a map or
+// a set makes every tree node cache the first 8 bytes of its key (big-endian)
+// and the key length, so most comparisons never touch the string buffer.
+struct string_prefix_less {
+  typedef std::string first_argument_type;
+  typedef std::string second_argument_type;
+  typedef bool        result_type;
+
+  bool operator() ( const std::string & lhs, const std::string & rhs ) const
+  { return (lhs < rhs); }
+};
+
+// What a tree node caches about its key for a given comparator.
+// compare() returns -1 / 1 when the cached bits alone decide the order, and 0
+// when the real comparator has to be called. The default caches nothing.
+template < class Compare, class Key >
+struct key_prefix {
+  key_prefix ( ) { }
+  template < class V >
+  explicit key_prefix ( const V & ) { }
+
+  template < class V >
+  void load ( const V & ) { }
+
+  static int compare ( const key_prefix &, const key_prefix & )
+  { return (0); }
+};
+
+template < >
+struct key_prefix< ft::string_prefix_less, std::string > {
+  uint64_t               _prefix;
+  std::string::size_type _length;
+
+  key_prefix ( ) : _prefix(0), _length(0) { }
+  explicit key_prefix ( const std::string & key ) { load(key); }
+  template < class T >
+  explicit key_prefix ( const ft::pair<const std::string, T> & val ) { load(val.first); }
+
+  void load ( const std::string & key )
+  {
+    const char * data = key.data();
+    std::string::size_type n = (key.size() < 8) ? key.size() : 8;
+
+    _prefix = 0;
+    for (std::string::size_type i = 0; i < 8; ++i) {
+      _prefix <<= 8;
+      if (i < n) _prefix |= static_cast<unsigned char>(data[i]);
+    }
+    _length = key.size();
+  }
+  template < class T >
+  void load ( const ft::pair<const std::string, T> & val ) { load(val.first); }
+
+  // Shorter keys are zero padded, so equal prefixes only decide the order when
+  // one of the keys fits entirely in its prefix: it is then a prefix of the other.
+  static int compare ( const key_prefix & lhs, const key_prefix & rhs )
+  {
+    if (lhs._prefix != rhs._prefix)
+      return ((lhs._prefix < rhs._prefix) ? -1 : 1);
+    if (lhs._length == rhs._length || (lhs._length > 8 && rhs._length > 8))
+      return (0);
+    return ((lhs._length < rhs._length) ? -1 : 1);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,268 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_search.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_SEARCH_HPP
+#define NODE_SEARCH_HPP
+
+#include "is_integral.hpp"
+#include <functional>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+# include <nmmintrin.h>
+#endif
+
+namespace ft
+{
+// Searches the n sorted keys of one B-tree node. lower() is the number of
+// keys less than k, upper() the number not greater than k.
+// With std::less on an arithmetic key, simd is true and both count the
+// whole node without a branch: SSE2 (SSE4.2 for 64-bit integers) where the
+// type allows it, a loop the compiler can vectorize elsewhere. Otherwise it
+// is a binary search with the comparator, and the node keeps no key array.
+template < class Key, bool Arithmetic >
+struct node_search_count {
+  static const bool simd = false;
+
+  template < class Compare >
+  static int lower ( const Key * keys, int n, const Key & k, const Compare & comp )
+  {
+    int lo = 0;
+    while (lo < n) {
+      int mid = (lo + n) / 2;
+      if (comp(keys[mid], k)) lo = mid + 1;
+      else n = mid;
+    }
+    return (lo);
+  }
+  template < class Compare >
+  static int upper ( const Key * keys, int n, const Key & k, const Compare & comp )
+  {
+    int lo = 0;
+    while (lo < n) {
+      int mid = (lo + n) / 2;
+      if (!comp(k, keys[mid])) lo = mid + 1;
+      else n = mid;
+    }
+    return (lo);
+  }
+};
+
+template < class Key >
+struct node_search_count< Key, true > {
+  static const bool simd = true;
+
+  template < class Compare >
+  static int lower ( const Key * keys, int n, const Key & k, const Compare & )
+  {
+    int count = 0;
+    for (int i = 0; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  template < class Compare >
+  static int upper ( const Key * keys, int n, const Key & k, const Compare & )
+  {
+    int count = 0;
+    for (int i = 0; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+
+template< class T >
+struct is_floating_point { static const bool value = false; };
+
+template<> struct is_floating_point<float>       { static const bool value = true; };
+template<> struct is_floating_point<double>      { static const bool value = true; };
+template<> struct is_floating_point<long double> { static const bool value = true; };
+
+template < class Key, class Compare >
+struct node_search : public node_search_count< Key, false > { };
+
+template < class Key >
+struct node_search< Key, std::less<Key> >
+  : public node_search_count< Key, ft::is_integral<Key>::value || ft::is_floating_point<Key>::value > { };
+
+#if defined(__SSE2__)
+// ---------------- SSE2 ----------------
+// A lane compares to all ones, so subtracting the masks counts the matches.
+inline int node_search_sum ( __m128i counts )
+{
+  counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(1, 0, 3, 2)));
+  counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, _MM_SHUFFLE(2, 3, 0, 1)));
+  return (_mm_cvtsi128_si32(counts));
+}
+
+template < >
+struct node_search< int, std::less<int> > {
+  static const bool simd = true;
+
+  static int lower ( const int * keys, int n, const int & k, const std::less<int> & )
+  {
+    __m128i probe = _mm_set1_epi32(k);
+    __m128i counts = _mm_setzero_si128();
+    int     i = 0;
+    for (; i + 4 <= n; i += 4)
+      counts = _mm_sub_epi32(counts, _mm_cmplt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), probe));
+    int count = node_search_sum(counts);
+    for (; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  static int upper ( const int * keys, int n, const int & k, const std::less<int> & )
+  {
+    __m128i probe = _mm_set1_epi32(k);
+    __m128i counts = _mm_setzero_si128();
+    int     i = 0;
+    for (; i + 4 <= n; i += 4) // keys[i] <= k is !(keys[i] > k): count the greater ones instead.
+      counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), probe));
+    int count = i - node_search_sum(counts);
+    for (; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+
+template < >
+struct node_search< unsigned int, std::less<unsigned int> > {
+  static const bool simd = true;
+
+  // SSE2 only compares signed lanes: flipping the sign bit keeps the order.
+  static int lower ( const unsigned int * keys, int n, const unsigned int & k, const std::less<unsigned int> & )
+  {
+    __m128i flip = _mm_set1_epi32(INT32_MIN);
+    __m128i probe = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(k)), flip);
+    __m128i counts = _mm_setzero_si128();
+    int     i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128i lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), flip);
+      counts = _mm_sub_epi32(counts, _mm_cmplt_epi32(lanes, probe));
+    }
+    int count = node_search_sum(counts);
+    for (; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  static int upper ( const unsigned int * keys, int n, const unsigned int & k, const std::less<unsigned int> & )
+  {
+    __m128i flip = _mm_set1_epi32(INT32_MIN);
+    __m128i probe = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(k)), flip);
+    __m128i counts = _mm_setzero_si128();
+    int     i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128i lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), flip);
+      counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(lanes, probe));
+    }
+    int count = i - node_search_sum(counts);
+    for (; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+
+template < >
+struct node_search< float, std::less<float> > {
+  static const bool simd = true;
+
+  static int lower ( const float * keys, int n, const float & k, const std::less<float> & )
+  {
+    __m128  probe = _mm_set1_ps(k);
+    int     count = 0;
+    int     i = 0;
+    for (; i + 4 <= n; i += 4)
+      count += __builtin_popcount(_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(keys + i), probe)));
+    for (; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  static int upper ( const float * keys, int n, const float & k, const std::less<float> & )
+  {
+    __m128  probe = _mm_set1_ps(k);
+    int     count = 0;
+    int     i = 0;
+    for (; i + 4 <= n; i += 4)
+      count += __builtin_popcount(_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(keys + i), probe)));
+    for (; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+
+template < >
+struct node_search< double, std::less<double> > {
+  static const bool simd = true;
+
+  static int lower ( const double * keys, int n, const double & k, const std::less<double> & )
+  {
+    __m128d probe = _mm_set1_pd(k);
+    int     count = 0;
+    int     i = 0;
+    for (; i + 2 <= n; i += 2)
+      count += __builtin_popcount(_mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(keys + i), probe)));
+    for (; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  static int upper ( const double * keys, int n, const double & k, const std::less<double> & )
+  {
+    __m128d probe = _mm_set1_pd(k);
+    int     count = 0;
+    int     i = 0;
+    for (; i + 2 <= n; i += 2)
+      count += __builtin_popcount(_mm_movemask_pd(_mm_cmple_pd(_mm_loadu_pd(keys + i), probe)));
+    for (; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+#endif
+
+#if defined(__SSE4_2__)
+// ---------------- SSE4.2 ----------------
+template < class Key >
+struct node_search_int64 {
+  static const bool simd = true;
+
+  static int lower ( const Key * keys, int n, const Key & k, const std::less<Key> & )
+  {
+    __m128i probe = _mm_set1_epi64x(static_cast<long long>(k));
+    int     count = 0;
+    int     i = 0;
+    for (; i + 2 <= n; i += 2) // keys[i] < k is k > keys[i].
+      count += __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(probe, _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i))))));
+    for (; i < n; ++i)
+      count += (keys[i] < k);
+    return (count);
+  }
+  static int upper ( const Key * keys, int n, const Key & k, const std::less<Key> & )
+  {
+    __m128i probe = _mm_set1_epi64x(static_cast<long long>(k));
+    int     count = 0;
+    int     i = 0;
+    for (; i + 2 <= n; i += 2)
+      count += 2 - __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), probe))));
+    for (; i < n; ++i)
+      count += (keys[i] <= k);
+    return (count);
+  }
+};
+
+template < > struct node_search< long, std::less<long> > : public node_search_int64< long > { };
+template < > struct node_search< long long, std::less<long long> > : public node_search_int64< long long > { };
+#endif
+}
+
+#endif
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rw_lock.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RW_LOCK_HPP
+#define RW_LOCK_HPP
+
+#include <pthread.h>
+#include <stdexcept>
+
+namespace ft
+{
+// A pthread reader-writer lock, with scoped guards for both sides.
+class rw_lock {
+private:
+  pthread_rwlock_t _lock;
+
+  rw_lock ( const rw_lock & );
+  rw_lock & operator= ( const rw_lock & );
+
+public:
+  rw_lock ( )
+  {
+    if (pthread_rwlock_init(&_lock, nullptr) != 0)
+      throw (std::runtime_error("rw_lock : pthread_rwlock_init failed"));
+  }
+  ~rw_lock ( ) { pthread_rwlock_destroy(&_lock); }
+
+  void lock ( )          { pthread_rwlock_wrlock(&_lock); }
+  void unlock ( )        { pthread_rwlock_unlock(&_lock); }
+  void lock_shared ( )   { pthread_rwlock_rdlock(&_lock); }
+  void unlock_shared ( ) { pthread_rwlock_unlock(&_lock); }
+};
+
+class read_guard {
+private:
+  rw_lock & _lock;
+
+  read_guard ( const read_guard & );
+  read_guard & operator= ( const read_guard & );
+
+public:
+  explicit read_guard ( rw_lock & lock ) : _lock(lock) { _lock.lock_shared(); }
+  ~read_guard ( ) { _lock.unlock_shared(); }
+};
+
+class write_guard {
+private:
+  rw_lock & _lock;
+
+  write_guard ( const write_guard & );
+  write_guard & operator= ( const write_guard & );
+
+public:
+  explicit write_guard ( rw_lock & lock ) : _lock(lock) { _lock.lock(); }
+  ~write_guard ( ) { _lock.unlock(); }
+};
+}
+
+#endif
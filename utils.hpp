@@ -14,9 +14,12 @@
 #define UTILS_HPP
 
 #include <memory>
+#include "utilities/atomic.hpp"
 #include "utilities/enable_if.hpp"
 #include "utilities/equal.hpp"
+#include "utilities/hash.hpp"
 #include "utilities/is_integral.hpp"
+#include "utilities/key_prefix.hpp"
 #include "utilities/lexicographical_compare.hpp"
 #include "utilities/pair.hpp"
 
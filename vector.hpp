@@ -16,6 +16,7 @@
 #include "Iterators/iterator_vector.hpp"
 #include "Iterators/reverse_iterator.hpp"
 #include "utils.hpp"
+#include <utility>
 
 #define SFINAAE(X) typename ft::enable_if<!ft::is_integral<X>::value, X>::type* = 0
 
@@ -52,6 +53,46 @@ private:
     if (n >= this->size())
       throw ( std::out_of_range ( "vector" ) );
   }
+  size_type _grown ( void ) const { return ((this->capacity() == 0) ? 1 : this->size() * 2); }
+  // Appends [first, last) with at most one reallocation and no temporary copy.
+  template< class InputIt >
+  bool _append ( InputIt, InputIt, std::input_iterator_tag ) { return (false); } // Single pass: needs the temporary.
+  template< class ForwardIt >
+  bool _append ( ForwardIt first, ForwardIt last, std::forward_iterator_tag )
+  {
+    size_type count = ft::distance(first, last);
+    if (count > this->max_size() - this->size())
+      throw (std::length_error("vector::insert"));
+    if (this->size() + count > this->capacity()) {
+      size_type new_cap = this->_grown();
+      if (new_cap > this->max_size())
+        new_cap = this->max_size();
+      if (new_cap < this->size() + count)
+        new_cap = this->size() + count;
+      pointer new_start = _alloc.allocate( new_cap );
+      pointer ptr = new_start;
+      try {
+        for (pointer old = _start; old < _end_S; ++old, ++ptr)
+          _alloc.construct(ptr, *old);
+        for (; first != last; ++first, ++ptr) // [first, last) may be ours: the old storage is still there.
+          _alloc.construct(ptr, *first);
+      } catch (...) { // Leaves *this as it was.
+        while (ptr != new_start)
+          _alloc.destroy(--ptr);
+        _alloc.deallocate(new_start, new_cap);
+        throw ;
+      }
+      this->clear();
+      if (_start) _alloc.deallocate(_start, this->capacity());
+      _start = new_start;
+      _end_S = ptr;
+      _end_C = new_start + new_cap;
+    } else {
+      for (; first != last; ++first, ++_end_S)
+        _alloc.construct(_end_S, *first);
+    }
+    return (true);
+  }
 
 public:
 
@@ -319,6 +360,8 @@ public:
   template< class InputIt >
   void insert( iterator pos, InputIt _first, InputIt _last, SFINAAE(InputIt) )
   {
+    if (pos == this->end() && this->_append(_first, _last, typename ft::iterator_traits<InputIt>::iterator_category()))
+      return ;
     vector<value_type> tmp(_first, _last);
     iterator first = tmp.begin();
     iterator last = tmp.end();
@@ -383,15 +426,32 @@ public:
     return (iterator(ptr_first));
   }
   // [*] // void push_back( const T& value );
-  void push_back ( const value_type value )
+  void push_back ( const_reference value )
   {
     if (_end_S == _end_C) {
-      size_type new_capacity = (this->capacity() == 0) ? 1 : this->size() * 2;
-      this->reserve(new_capacity);
-    }
-    _alloc.construct(_end_S, value);
+      value_type copy(value); // value may be one of ours.
+      this->reserve(this->_grown());
+      _alloc.construct(_end_S, copy);
+    } else
+      _alloc.construct(_end_S, value);
     _end_S++;
   }
+#if __cplusplus >= 201103L
+  // [*] // void push_back( T&& value );
+  void push_back ( value_type&& value ) { this->emplace_back(std::move(value)); }
+  // [*] // template< class... Args > void emplace_back( Args&&... args );
+  template< class... Args >
+  void emplace_back ( Args&&... args )
+  {
+    if (_end_S == _end_C) {
+      value_type made(std::forward<Args>(args)...); // args may be ours.
+      this->reserve(this->_grown());
+      _alloc.construct(_end_S, std::move(made));
+    } else
+      _alloc.construct(_end_S, std::forward<Args>(args)...);
+    _end_S++;
+  }
+#endif
   // [*] // void pop_back();
   void pop_back ( void )
   {
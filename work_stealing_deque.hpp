@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: zwina <zwina@student.1337.ma>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by zwina             #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by zwina            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include "utilities/atomic.hpp"
+#include <memory>
+
+namespace ft
+{
+// The Chase-Lev deque of a work-stealing scheduler: one owner thread pushes
+// and pops at the bottom, as on a stack, while any other thread may steal
+// from the top. The owner only pays a fence when it pops, and a CAS when it
+// races a thief for the last element; thieves CAS the top. The elements sit
+// in a circular buffer that the owner doubles when it is full. A thief may
+// still be reading an old buffer, so those are kept until the deque is
+// destroyed, which at most doubles the memory. Thieves read an element
+// before they know whether they won it, so T must be a word the __atomic
+// builtins handle: a pointer to a task, an index.
+template
+<
+class T,
+class Alloc = std::allocator<T>
+>
+class work_stealing_deque {
+public:
+  typedef T                                             value_type;
+  typedef Alloc                                         allocator_type;
+  typedef typename allocator_type::size_type            size_type;
+
+private:
+  struct Buffer {
+    long        _mask;      // The capacity, a power of 2, minus 1.
+    value_type  * _items;
+    Buffer      * _retired; // The buffer it replaced.
+
+    value_type get ( long i ) const           { return (atomic_load_relaxed(&_items[i & _mask])); }
+    void       put ( long i, value_type val ) { atomic_store_relaxed(&_items[i & _mask], val); }
+  };
+  struct Line { // One index per cache line: the owner and the thieves each have theirs.
+    long  _index;
+    char  _pad[64 - sizeof(long)];
+  };
+  typedef typename allocator_type::template rebind<Buffer>::other  allocator_buffer_type;
+
+  allocator_type        _alloc;
+  allocator_buffer_type _alloc_buffer;
+  Line                  _top;    // Where thieves steal.
+  Line                  _bottom; // One past the owner's last element.
+  Buffer                * _buffer;
+
+  work_stealing_deque ( const work_stealing_deque & );
+  work_stealing_deque & operator= ( const work_stealing_deque & );
+
+public:
+  // [*] // explicit work_stealing_deque ( size_type capacity = 64, const allocator_type& alloc = allocator_type() );
+  // [*] // ~work_stealing_deque ( );
+  // [*] // allocator_type get_allocator() const;
+  explicit work_stealing_deque ( size_type capacity = 64, const allocator_type& alloc = allocator_type() )
+    : _alloc ( alloc )
+    , _alloc_buffer ( alloc )
+    , _buffer ( nullptr )
+  {
+    long size = 2;
+    while (size_type(size) < capacity)
+      size *= 2;
+    _top._index = _bottom._index = 0;
+    _buffer = _newBuffer(size, nullptr);
+  }
+  ~work_stealing_deque ( )
+  {
+    while (_buffer) {
+      Buffer * retired = _buffer->_retired;
+      _alloc.deallocate(_buffer->_items, _buffer->_mask + 1);
+      _alloc_buffer.deallocate(_buffer, 1);
+      _buffer = retired;
+    }
+  }
+  allocator_type get_allocator ( ) const { return (_alloc); }
+
+  // [*] // bool empty ( ) const;
+  // [*] // size_type size ( ) const;
+  // [*] // size_type capacity ( ) const;
+  // Snapshots, exact only for the owner while nobody steals.
+  bool empty ( ) const { return (size() == 0); }
+  size_type size ( ) const
+  {
+    long size = atomic_load(&_bottom._index) - atomic_load(&_top._index);
+    return ((size > 0) ? size_type(size) : 0);
+  }
+  size_type capacity ( ) const { return (size_type(atomic_load(&_buffer)->_mask + 1)); }
+
+  // [*] // void push ( const value_type& val );       // The owner only.
+  // [*] // bool pop ( value_type& val );              // The owner only; false when empty.
+  // [*] // bool steal ( value_type& val );            // Any thread; false when empty or when it lost a race.
+  void push ( const value_type& val )
+  {
+    long bottom = atomic_load_relaxed(&_bottom._index);
+    long top = atomic_load(&_top._index);
+    Buffer * buffer = atomic_load_relaxed(&_buffer);
+    if (bottom - top > buffer->_mask)
+      buffer = _grow(buffer, top, bottom);
+    buffer->put(bottom, val);
+    atomic_store(&_bottom._index, bottom + 1); // Publishes the element to the thieves.
+  }
+  bool pop ( value_type& val )
+  {
+    long bottom = atomic_load_relaxed(&_bottom._index) - 1;
+    Buffer * buffer = atomic_load_relaxed(&_buffer);
+    atomic_store_relaxed(&_bottom._index, bottom);
+    atomic_fence(); // The thieves see the claim before we read their top.
+    long top = atomic_load_relaxed(&_top._index);
+    if (top > bottom) { // Empty.
+      atomic_store_relaxed(&_bottom._index, bottom + 1);
+      return (false);
+    }
+    val = buffer->get(bottom);
+    if (top < bottom)
+      return (true);
+    bool won = atomic_compare_exchange_seq_cst(&_top._index, top, top + 1); // The last one: race the thieves for it.
+    atomic_store_relaxed(&_bottom._index, bottom + 1);
+    return (won);
+  }
+  bool steal ( value_type& val )
+  {
+    long top = atomic_load(&_top._index);
+    atomic_fence();
+    long bottom = atomic_load(&_bottom._index);
+    if (top >= bottom)
+      return (false);
+    val = atomic_load(&_buffer)->get(top);
+    return (atomic_compare_exchange_seq_cst(&_top._index, top, top + 1));
+  }
+
+private:
+  Buffer * _newBuffer ( long size, Buffer * retired )
+  {
+    Buffer * buffer = _alloc_buffer.allocate(1);
+    try {
+      buffer->_items = _alloc.allocate(size);
+    } catch (...) {
+      _alloc_buffer.deallocate(buffer, 1);
+      throw ;
+    }
+    buffer->_mask = size - 1;
+    buffer->_retired = retired;
+    return (buffer);
+  }
+  Buffer * _grow ( Buffer * buffer, long top, long bottom )
+  {
+    Buffer * bigger = _newBuffer(2 * (buffer->_mask + 1), buffer);
+    for (long i = top; i < bottom; ++i)
+      bigger->put(i, buffer->get(i));
+    atomic_store(&_buffer, bigger);
+    return (bigger);
+  }
+};
+}
+
+#endif